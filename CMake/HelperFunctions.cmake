@@ -99,6 +99,8 @@ function(SetDefaultCompileDefinitions ProjectName)
             $<$<CXX_COMPILER_ID:MSVC>:_CRT_SECURE_NO_WARNINGS>
             $<$<CXX_COMPILER_ID:MSVC>:_ENABLE_EXTENDED_ALIGNED_STORAGE>
             $<$<CXX_COMPILER_ID:MSVC>:_SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING>
+            # Profiling zones (SLIB_PROFILE_*) compile to nothing unless enabled
+            $<$<BOOL:${SLIB_ENABLE_PROFILING}>:SLIB_ENABLE_PROFILING>
             PRIVATE
             # Clang.
             $<$<CXX_COMPILER_ID:Clang>:_MSC_EXTENSIONS> # enable MS extensions
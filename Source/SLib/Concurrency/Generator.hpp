@@ -0,0 +1,143 @@
+﻿/**
+ * @File Generator.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+
+#include <SLib/Concurrency/Task.hpp>
+
+namespace slib {
+
+/**
+ * 同步生成器: 每次 co_yield 产出一个值，调用方通过范围 for 逐个取用. 产出的值以引用形式暴露，
+ * 在迭代器前进之前保持有效，不发生拷贝. 协程中的异常在迭代器前进时重新抛出.
+ */
+template<typename T>
+class [[nodiscard]] Generator
+{
+public:
+    using ValueType = std::remove_cvref_t<T>;
+    using Reference = std::conditional_t<std::is_reference_v<T>, T, const T&>;
+    using Pointer   = std::add_pointer_t<Reference>;
+
+    struct promise_type : detail::CoroutineFrameAllocation
+    {
+        Generator get_return_object() noexcept { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        std::suspend_always yield_value(Reference value) noexcept
+        {
+            current = std::addressof(value);
+            return {};
+        }
+
+        /**
+         * @brief 产出临时值: 临时对象存放在协程帧中，直到生成器恢复执行.
+         */
+        std::suspend_always yield_value(std::remove_reference_t<Reference>&& value) noexcept
+            requires(!std::is_reference_v<T>)
+        {
+            current = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+
+        template<typename U>
+        std::suspend_never await_transform(U&&) = delete; ///< 生成器中不允许 co_await
+
+        Pointer current = nullptr;
+        std::exception_ptr error;
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = ValueType;
+        using reference         = Reference;
+        using pointer           = Pointer;
+
+        Iterator() noexcept = default;
+
+        explicit Iterator(Handle handle) noexcept : _handle(handle) { }
+
+        friend bool operator==(const Iterator& it, std::default_sentinel_t) noexcept { return !it._handle || it._handle.done(); }
+
+        Iterator& operator++()
+        {
+            _handle.resume();
+            if (_handle.done() && _handle.promise().error)
+                std::rethrow_exception(std::exchange(_handle.promise().error, nullptr));
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        reference operator*() const noexcept { return static_cast<reference>(*_handle.promise().current); }
+
+        pointer operator->() const noexcept { return _handle.promise().current; }
+
+    private:
+        Handle _handle;
+    };
+
+    Generator() noexcept = default;
+
+    explicit Generator(Handle handle) noexcept : _handle(handle) { }
+
+    Generator(Generator&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) { }
+
+    Generator& operator=(Generator&& other) noexcept
+    {
+        if (this != &other) {
+            if (_handle)
+                _handle.destroy();
+            _handle = std::exchange(other._handle, nullptr);
+        }
+        return *this;
+    }
+
+    Generator(const Generator&)            = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    /**
+     * @brief 开始 (或继续) 迭代. 生成器只能遍历一次.
+     */
+    Iterator begin()
+    {
+        Iterator it(_handle);
+        if (_handle && !_handle.done())
+            ++it;
+        return it;
+    }
+
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    Handle _handle;
+};
+
+} // namespace slib
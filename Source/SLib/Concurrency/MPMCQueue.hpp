@@ -0,0 +1,143 @@
+﻿/**
+ * @File MPMCQueue.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * 有界多生产者多消费者队列 (Dmitry Vyukov 的 bounded MPMC queue).
+ *
+ * 每个槽位带一个序号: 序号等于写位置时槽位可写，等于写位置 + 1 时可读. 生产者与消费者分别只在各自的位置上 CAS，
+ * 两者互不争用，也不需要锁. 容量向上取为 2 的幂.
+ */
+template<typename T>
+class MPMCQueue
+{
+public:
+    explicit MPMCQueue(Size capacity)
+        : _mask(NextPowerOfTwo(Max<Size>(capacity, 2)) - 1),
+          _cells(static_cast<Cell*>(::operator new((_mask + 1) * sizeof(Cell), std::align_val_t{alignof(Cell)})))
+    {
+        for (Size i = 0; i <= _mask; ++i)
+            std::construct_at(&_cells[i].sequence, i);
+    }
+
+    MPMCQueue(const MPMCQueue&)            = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    ~MPMCQueue()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            while (tryPop()) { }
+        }
+        ::operator delete(_cells, std::align_val_t{alignof(Cell)});
+    }
+
+    SLIB_NODISCARD Size capacity() const { return _mask + 1; }
+
+    /**
+     * @brief 队列满时返回 false.
+     */
+    template<typename... Args>
+    bool tryEmplace(Args&&... args)
+    {
+        Cell* cell;
+        Size pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell           = &_cells[pos & _mask];
+            const Size seq = cell->sequence.load(std::memory_order_acquire);
+            const auto dif = static_cast<i64>(seq) - static_cast<i64>(pos);
+            if (dif == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (dif < 0) {
+                return false;
+            }
+            else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        ::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(const T& value) { return tryEmplace(value); }
+
+    bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+    /**
+     * @brief 队列空时返回 std::nullopt.
+     */
+    SLIB_NODISCARD Opt<T> tryPop()
+    {
+        Cell* cell;
+        Size pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell           = &_cells[pos & _mask];
+            const Size seq = cell->sequence.load(std::memory_order_acquire);
+            const auto dif = static_cast<i64>(seq) - static_cast<i64>(pos + 1);
+            if (dif == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (dif < 0) {
+                return std::nullopt;
+            }
+            else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* p = cell->ptr();
+        Opt<T> value(std::move(*p));
+        std::destroy_at(p);
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief 近似的元素数.
+     */
+    SLIB_NODISCARD Size size() const
+    {
+        const Size head = _dequeuePos.load(std::memory_order_acquire);
+        const Size tail = _enqueuePos.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    SLIB_NODISCARD bool empty() const { return size() == 0; }
+
+private:
+    struct Cell
+    {
+        std::atomic<Size> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T* ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    const Size _mask;
+    Cell* const _cells;
+
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<Size> _enqueuePos{0};
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<Size> _dequeuePos{0};
+};
+
+} // namespace slib
@@ -0,0 +1,96 @@
+﻿/**
+ * @File MPSCQueue.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * 侵入式队列节点，入队对象需公开继承它.
+ */
+struct MPSCNode
+{
+    std::atomic<MPSCNode*> mpscNext{nullptr};
+};
+
+/**
+ * 无界多生产者单消费者侵入式队列 (Dmitry Vyukov 的 intrusive MPSC node-based queue).
+ *
+ * 入队只有一次 exchange，无等待且不分配内存; 出队仅限单个消费者. 队列不拥有节点，节点在出队之前必须保持有效.
+ * 生产者在 exchange 与链接 next 之间被抢占时，消费者会暂时看到队列为空 (tryPop 返回 nullptr)，稍后重试即可.
+ */
+template<typename T>
+    requires std::is_base_of_v<MPSCNode, T>
+class MPSCQueue
+{
+public:
+    MPSCQueue() = default;
+
+    MPSCQueue(const MPSCQueue&)            = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    /**
+     * @brief 任意线程调用.
+     */
+    void push(T* item) { pushNode(item); }
+
+    /**
+     * @brief 仅消费者调用，队列空时返回 nullptr.
+     */
+    SLIB_NODISCARD T* tryPop()
+    {
+        MPSCNode* tail = _tail;
+        MPSCNode* next = tail->mpscNext.load(std::memory_order_acquire);
+        if (tail == &_stub) {
+            if (!next)
+                return nullptr;
+            _tail = next;
+            tail  = next;
+            next  = next->mpscNext.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            _tail = next;
+            return static_cast<T*>(tail);
+        }
+
+        if (tail != _head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // tail 是最后一个节点: 重新放入哨兵，以便把 tail 取出
+        pushNode(&_stub);
+        next = tail->mpscNext.load(std::memory_order_acquire);
+        if (next) {
+            _tail = next;
+            return static_cast<T*>(tail);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 仅消费者调用. 与进行中的 push 并发时结果只是近似的.
+     */
+    SLIB_NODISCARD bool empty() const { return _tail == &_stub && !_stub.mpscNext.load(std::memory_order_acquire); }
+
+private:
+    void pushNode(MPSCNode* node)
+    {
+        node->mpscNext.store(nullptr, std::memory_order_relaxed);
+        MPSCNode* prev = _head.exchange(node, std::memory_order_acq_rel);
+        prev->mpscNext.store(node, std::memory_order_release);
+    }
+
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<MPSCNode*> _head{&_stub};
+    alignas(SLIB_CACHE_LINE_SIZE) MPSCNode* _tail = &_stub;
+    MPSCNode _stub;
+};
+
+} // namespace slib
@@ -0,0 +1,125 @@
+﻿/**
+ * @File SPSCQueue.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * 有界单生产者单消费者环形队列.
+ *
+ * 读写索引单调递增，用掩码取槽位，容量向上取为 2 的幂. 生产者与消费者各自的索引以及对方索引的本地缓存位于
+ * 不同的缓存行: 只有当缓存值显示队列满 (或空) 时才去读取对方的原子索引，稳态下每次操作不产生跨核缓存行传输.
+ */
+template<typename T>
+class SPSCQueue
+{
+public:
+    explicit SPSCQueue(Size capacity)
+        : _mask(NextPowerOfTwo(Max<Size>(capacity, 2)) - 1),
+          _slots(static_cast<Slot*>(::operator new((_mask + 1) * sizeof(Slot), std::align_val_t{alignof(Slot)})))
+    {
+    }
+
+    SPSCQueue(const SPSCQueue&)            = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    ~SPSCQueue()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            const Size tail = _tail.load(std::memory_order_relaxed);
+            for (Size i = _head.load(std::memory_order_relaxed); i != tail; ++i)
+                std::destroy_at(_slots[i & _mask].ptr());
+        }
+        ::operator delete(_slots, std::align_val_t{alignof(Slot)});
+    }
+
+    SLIB_NODISCARD Size capacity() const { return _mask + 1; }
+
+    /**
+     * @brief 仅生产者调用，队列满时返回 false.
+     */
+    template<typename... Args>
+    bool tryEmplace(Args&&... args)
+    {
+        const Size tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _headCache > _mask) {
+            _headCache = _head.load(std::memory_order_acquire);
+            if (tail - _headCache > _mask)
+                return false;
+        }
+
+        ::new (static_cast<void*>(_slots[tail & _mask].storage)) T(std::forward<Args>(args)...);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(const T& value) { return tryEmplace(value); }
+
+    bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+    /**
+     * @brief 仅消费者调用，队列空时返回 std::nullopt.
+     */
+    SLIB_NODISCARD Opt<T> tryPop()
+    {
+        const Size head = _head.load(std::memory_order_relaxed);
+        if (head == _tailCache) {
+            _tailCache = _tail.load(std::memory_order_acquire);
+            if (head == _tailCache)
+                return std::nullopt;
+        }
+
+        T* p = _slots[head & _mask].ptr();
+        Opt<T> value(std::move(*p));
+        std::destroy_at(p);
+        _head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief 近似的元素数.
+     */
+    SLIB_NODISCARD Size size() const
+    {
+        const Size head = _head.load(std::memory_order_acquire);
+        const Size tail = _tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    SLIB_NODISCARD bool empty() const { return size() == 0; }
+
+private:
+    struct Slot
+    {
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T* ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    const Size _mask;
+    Slot* const _slots;
+
+    // 消费者: 读索引与写索引的缓存
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<Size> _head{0};
+    Size _tailCache = 0;
+
+    // 生产者: 写索引与读索引的缓存
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<Size> _tail{0};
+    Size _headCache = 0;
+};
+
+} // namespace slib
@@ -0,0 +1,34 @@
+﻿/**
+ * @File ShardedCounter.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "ShardedCounter.hpp"
+
+#include <thread>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kMaxShards = 256;
+
+std::atomic<u32> sNextThreadIndex{0};
+thread_local u32 tThreadIndex = ~u32(0);
+
+} // namespace
+
+Size slib::detail::ShardCount()
+{
+    static const Size count = Min(NextPowerOfTwo(Max<Size>(std::thread::hardware_concurrency(), 1)), kMaxShards);
+    return count;
+}
+
+u32 slib::detail::ThreadShardIndex()
+{
+    if (SLIB_UNLIKELY(tThreadIndex == ~u32(0)))
+        tThreadIndex = sNextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    return tThreadIndex;
+}
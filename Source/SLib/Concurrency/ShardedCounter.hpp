@@ -0,0 +1,225 @@
+﻿/**
+ * @File ShardedCounter.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+
+#if defined(SLIB_IN_LINUX)
+#  include <sched.h>
+#endif
+
+namespace slib {
+
+namespace detail {
+
+/**
+ * @brief 分片数: 不小于逻辑核数的 2 的幂，上限 256. 进程内固定不变.
+ */
+Size ShardCount();
+
+/**
+ * @brief 线程首次调用时轮转分配的编号.
+ */
+u32 ThreadShardIndex();
+
+/**
+ * @brief 当前线程应使用的分片编号 (未取模). Linux 上取当前 CPU 编号: glibc 2.35 起 sched_getcpu 直接读取 rseq 区域，
+ *        只需约 1ns; 其他平台或获取失败时退化为线程编号.
+ */
+SLIB_FORCE_INLINE u32 CurrentShard()
+{
+#if defined(SLIB_IN_LINUX)
+    const int cpu = sched_getcpu();
+    if (SLIB_LIKELY(cpu >= 0))
+        return static_cast<u32>(cpu);
+#endif
+    return ThreadShardIndex();
+}
+
+} // namespace detail
+
+/**
+ * 分片计数器. 每个分片独占一个缓存行，递增只对当前 CPU 的分片做一次 relaxed fetch_add (无等待)，
+ * 不同核心上的递增互不争用缓存行; 读取时汇总所有分片，代价与分片数成正比.
+ *
+ * 线程可能在取得分片编号后被迁移，因此分片仍使用原子操作，只是几乎不会发生竞争.
+ */
+class ShardedCounter
+{
+public:
+    ShardedCounter() : _mask(detail::ShardCount() - 1), _slots(std::make_unique<Slot[]>(_mask + 1)) { }
+
+    ShardedCounter(const ShardedCounter&)            = delete;
+    ShardedCounter& operator=(const ShardedCounter&) = delete;
+
+    SLIB_FORCE_INLINE void add(i64 n) { _slots[detail::CurrentShard() & _mask].value.fetch_add(n, std::memory_order_relaxed); }
+
+    SLIB_FORCE_INLINE void increment() { add(1); }
+
+    SLIB_FORCE_INLINE void decrement() { add(-1); }
+
+    /**
+     * @brief 各分片之和. 与并发的递增之间没有快照语义.
+     */
+    SLIB_NODISCARD i64 value() const
+    {
+        i64 sum = 0;
+        for (Size i = 0; i <= _mask; ++i)
+            sum += _slots[i].value.load(std::memory_order_relaxed);
+        return sum;
+    }
+
+    void reset()
+    {
+        for (Size i = 0; i <= _mask; ++i)
+            _slots[i].value.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct alignas(SLIB_CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<i64> value{0};
+    };
+
+    const Size _mask;
+    std::unique_ptr<Slot[]> _slots;
+};
+
+/**
+ * 分片的以 2 为底的对数直方图: 第 0 个桶记录 0，第 i 个桶记录 [2^(i-1), 2^i). 每个分片持有完整的一组桶，
+ * 记录一次只触及当前分片的一个桶与总和.
+ */
+class ShardedHistogram
+{
+public:
+    static constexpr Size kBucketCount = 65;
+
+    using Buckets = std::array<u64, kBucketCount>;
+
+    ShardedHistogram() : _mask(detail::ShardCount() - 1), _slots(std::make_unique<Slot[]>(_mask + 1)) { }
+
+    ShardedHistogram(const ShardedHistogram&)            = delete;
+    ShardedHistogram& operator=(const ShardedHistogram&) = delete;
+
+    SLIB_NODISCARD static constexpr Size BucketOf(u64 value) { return value == 0 ? 0 : static_cast<Size>(FloorLog2(value)) + 1; }
+
+    /**
+     * @brief 第 i 个桶的下界 (含).
+     */
+    SLIB_NODISCARD static constexpr u64 BucketLowerBound(Size i) { return i == 0 ? 0 : u64(1) << (i - 1); }
+
+    SLIB_FORCE_INLINE void record(u64 value, u64 count = 1)
+    {
+        Slot& slot = _slots[detail::CurrentShard() & _mask];
+        slot.buckets[BucketOf(value)].fetch_add(count, std::memory_order_relaxed);
+        slot.sum.fetch_add(value * count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 汇总各分片的桶计数.
+     */
+    SLIB_NODISCARD Buckets buckets() const
+    {
+        Buckets result{};
+        for (Size i = 0; i <= _mask; ++i)
+            for (Size b = 0; b < kBucketCount; ++b)
+                result[b] += _slots[i].buckets[b].load(std::memory_order_relaxed);
+        return result;
+    }
+
+    SLIB_NODISCARD u64 count() const
+    {
+        u64 n = 0;
+        for (u64 c : buckets())
+            n += c;
+        return n;
+    }
+
+    SLIB_NODISCARD u64 sum() const
+    {
+        u64 s = 0;
+        for (Size i = 0; i <= _mask; ++i)
+            s += _slots[i].sum.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    void reset()
+    {
+        for (Size i = 0; i <= _mask; ++i) {
+            for (auto& b : _slots[i].buckets)
+                b.store(0, std::memory_order_relaxed);
+            _slots[i].sum.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(SLIB_CACHE_LINE_SIZE) Slot
+    {
+        std::array<std::atomic<u64>, kBucketCount> buckets{};
+        std::atomic<u64> sum{0};
+    };
+
+    const Size _mask;
+    std::unique_ptr<Slot[]> _slots;
+};
+
+/**
+ * 分片的最大值记录器. 更新时先做一次 relaxed 读取，只有新值更大时才写入当前分片，
+ * 稳态下 (最大值很少刷新) 几乎只有读操作.
+ */
+class MaxGauge
+{
+public:
+    static constexpr i64 kEmpty = std::numeric_limits<i64>::min();
+
+    MaxGauge() : _mask(detail::ShardCount() - 1), _slots(std::make_unique<Slot[]>(_mask + 1)) { }
+
+    MaxGauge(const MaxGauge&)            = delete;
+    MaxGauge& operator=(const MaxGauge&) = delete;
+
+    SLIB_FORCE_INLINE void update(i64 value)
+    {
+        auto& slot  = _slots[detail::CurrentShard() & _mask].value;
+        i64 current = slot.load(std::memory_order_relaxed);
+        while (value > current && !slot.compare_exchange_weak(current, value, std::memory_order_relaxed)) { }
+    }
+
+    /**
+     * @brief 所有分片的最大值，没有任何更新时为 kEmpty.
+     */
+    SLIB_NODISCARD i64 value() const
+    {
+        i64 result = kEmpty;
+        for (Size i = 0; i <= _mask; ++i)
+            result = Max(result, _slots[i].value.load(std::memory_order_relaxed));
+        return result;
+    }
+
+    void reset()
+    {
+        for (Size i = 0; i <= _mask; ++i)
+            _slots[i].value.store(kEmpty, std::memory_order_relaxed);
+    }
+
+private:
+    struct alignas(SLIB_CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<i64> value{kEmpty};
+    };
+
+    const Size _mask;
+    std::unique_ptr<Slot[]> _slots;
+};
+
+} // namespace slib
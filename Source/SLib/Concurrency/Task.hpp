@@ -0,0 +1,658 @@
+﻿/**
+ * @File Task.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include <SLib/Error.hpp>
+#include <SLib/Concurrency/ThreadPool.hpp>
+#include <SLib/Memory/RecyclingAllocator.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+template<typename T = void>
+class Task;
+
+namespace detail {
+
+/**
+ * 协程帧通过 RecyclingAllocator 分配，频繁创建的短生命周期协程不会走到 malloc.
+ */
+struct CoroutineFrameAllocation
+{
+    static void* operator new(Size size) { return RecyclingAllocator::Allocate(size); }
+
+    static void operator delete(void* p, Size size) noexcept { RecyclingAllocator::Deallocate(p, size); }
+};
+
+class TaskPromiseBase : public CoroutineFrameAllocation
+{
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        template<typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept
+        {
+            // 对称转移: 直接切换到等待方，不增加调用栈深度
+            const std::coroutine_handle<> next = h.promise()._continuation;
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() noexcept { }
+    };
+
+public:
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() noexcept { _error = std::current_exception(); }
+
+    void setContinuation(std::coroutine_handle<> continuation) noexcept { _continuation = continuation; }
+
+protected:
+    void rethrowIfFailed() const
+    {
+        if (_error)
+            std::rethrow_exception(_error);
+    }
+
+private:
+    std::coroutine_handle<> _continuation;
+    std::exception_ptr _error;
+};
+
+template<typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+    Task<T> get_return_object() noexcept;
+
+    template<typename U>
+        requires std::is_convertible_v<U&&, T>
+    void return_value(U&& value)
+    {
+        _value.emplace(std::forward<U>(value));
+    }
+
+    T result() &&
+    {
+        rethrowIfFailed();
+        return std::move(*_value);
+    }
+
+private:
+    Opt<T> _value;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept { }
+
+    void result() && { rethrowIfFailed(); }
+};
+
+} // namespace detail
+
+// ==================
+// Task
+// ==================
+
+/**
+ * 惰性启动的协程任务: 创建时不执行，被 co_await (或交给 SyncWait / Spawn) 时才开始运行.
+ * 完成时通过对称转移恢复等待方，长链式的 co_await 不会耗尽调用栈. 协程中未捕获的异常在 co_await 处重新抛出.
+ */
+template<typename T>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = detail::TaskPromise<T>;
+    using Handle       = std::coroutine_handle<promise_type>;
+    using ValueType    = T;
+
+    Task() noexcept = default;
+
+    explicit Task(Handle handle) noexcept : _handle(handle) { }
+
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) { }
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other) {
+            if (_handle)
+                _handle.destroy();
+            _handle = std::exchange(other._handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    SLIB_NODISCARD bool valid() const noexcept { return static_cast<bool>(_handle); }
+
+    SLIB_NODISCARD bool done() const noexcept { return !_handle || _handle.done(); }
+
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            Handle handle;
+
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().setContinuation(awaiting);
+                return handle;
+            }
+
+            T await_resume()
+            {
+                SLIB_ASSERT(handle, "Awaiting an empty Task.");
+                return std::move(handle.promise()).result();
+            }
+        };
+
+        return Awaiter{_handle};
+    }
+
+private:
+    Handle _handle;
+};
+
+template<typename T>
+Task<T> detail::TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+inline Task<void> detail::TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+// ==================
+// Executor
+// ==================
+
+namespace detail {
+
+/**
+ * 立即开始、结束时自行销毁的协程，用于 Spawn 和 WhenAny 的分支.
+ */
+struct DetachedTask
+{
+    struct promise_type : CoroutineFrameAllocation
+    {
+        DetachedTask get_return_object() noexcept { return {}; }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception() noexcept
+        {
+            Guardian([] { std::rethrow_exception(std::current_exception()); });
+        }
+    };
+};
+
+/**
+ * 销毁当前 (分离的) 协程帧并对称转移到 next. 之后不能再访问协程中的任何局部变量.
+ */
+struct DestroyAndTransfer
+{
+    std::coroutine_handle<> next;
+
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> self) noexcept
+    {
+        const std::coroutine_handle<> target = next;
+        self.destroy();
+        return target;
+    }
+
+    void await_resume() noexcept { }
+};
+
+class ScheduleAwaiter
+{
+public:
+    explicit ScheduleAwaiter(ThreadPool& pool) : _pool(pool), _task([this] { _handle.resume(); }) { }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        _handle = handle;
+        _pool.post(_task);
+    }
+
+    void await_resume() noexcept { }
+
+private:
+    ThreadPool& _pool;
+    std::coroutine_handle<> _handle;
+    TaskHandle _task; ///< 位于协程帧中，恢复后随帧一起销毁，因此必须用 post 提交
+};
+
+/**
+ * 线程间一次性事件. 通知在持锁状态下完成，等待方返回后可以立即销毁事件对象.
+ */
+class SyncWaitEvent
+{
+public:
+    void set()
+    {
+        std::lock_guard lock(_mutex);
+        _done = true;
+        _cv.notify_one();
+    }
+
+    void wait()
+    {
+        std::unique_lock lock(_mutex);
+        _cv.wait(lock, [this] { return _done; });
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _done = false;
+};
+
+struct SyncWaitDriver
+{
+    struct promise_type : CoroutineFrameAllocation
+    {
+        SyncWaitEvent* event = nullptr;
+
+        SyncWaitDriver get_return_object() noexcept { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        auto final_suspend() noexcept
+        {
+            struct Awaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                void await_suspend(std::coroutine_handle<promise_type> h) noexcept { h.promise().event->set(); }
+
+                void await_resume() noexcept { }
+            };
+
+            return Awaiter{};
+        }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+template<typename T>
+using VoidToMonostate = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+/**
+ * @brief 等待 task 并把结果或异常写入 out / error，本身从不抛出.
+ */
+template<typename D, typename T>
+D AwaitInto(Task<T>& task, Opt<VoidToMonostate<T>>& out, std::exception_ptr& error)
+{
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            out.emplace();
+        }
+        else {
+            out.emplace(co_await std::move(task));
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief 在线程池上恢复当前协程: co_await Schedule(pool) 之后的代码运行在某个工作线程上.
+ */
+SLIB_NODISCARD inline detail::ScheduleAwaiter Schedule(ThreadPool& pool)
+{
+    return detail::ScheduleAwaiter(pool);
+}
+
+/**
+ * @brief 阻塞当前线程直到任务完成，返回结果或重新抛出异常. 不要在线程池的工作线程中调用.
+ */
+template<typename T>
+T SyncWait(Task<T> task)
+{
+    Opt<detail::VoidToMonostate<T>> value;
+    std::exception_ptr error;
+    detail::SyncWaitEvent event;
+
+    detail::SyncWaitDriver driver = detail::AwaitInto<detail::SyncWaitDriver>(task, value, error);
+    driver.handle.promise().event = &event;
+    driver.handle.resume();
+    event.wait();
+    driver.handle.destroy();
+
+    if (error)
+        std::rethrow_exception(error);
+    if constexpr (!std::is_void_v<T>)
+        return std::move(*value);
+}
+
+/**
+ * @brief 分离执行: 任务在线程池上开始运行，完成后自行销毁. 未捕获的异常交由 Guardian 报告.
+ */
+inline void Spawn(ThreadPool& pool, Task<void> task)
+{
+    [](ThreadPool& p, Task<void> t) -> detail::DetachedTask {
+        co_await Schedule(p);
+        co_await std::move(t);
+    }(pool, std::move(task));
+}
+
+/**
+ * @brief 将任务中的异常转换为 Result 的错误值.
+ */
+template<typename T>
+Task<Result<detail::VoidToMonostate<T>>> AsResult(Task<T> task)
+{
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            co_return std::monostate{};
+        }
+        else {
+            co_return co_await std::move(task);
+        }
+    } catch (const std::exception& e) {
+        co_return Unexpected(FailureType::Failed, e.what());
+    } catch (...) {
+        co_return Unexpected(FailureType::Failed, "Unknown exception");
+    }
+}
+
+// ==================
+// WhenAll / WhenAny
+// ==================
+
+namespace detail {
+
+/**
+ * 计数器初值为分支数 + 1: 每个分支完成时减一，等待方启动全部分支后再减一，最后一个到达者负责恢复等待方.
+ * 这样即使所有分支都同步完成，等待方也不会在 await_suspend 返回前被恢复.
+ */
+class WhenAllLatch
+{
+public:
+    explicit WhenAllLatch(Size count) : _count(count + 1) { }
+
+    /// @return 最后到达时返回等待方，否则返回 noop
+    std::coroutine_handle<> arrive() noexcept
+    {
+        return _count.fetch_sub(1, std::memory_order_acq_rel) == 1 ? _continuation : std::noop_coroutine();
+    }
+
+    /// @return 是否需要挂起
+    bool suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        _continuation = continuation;
+        return _count.fetch_sub(1, std::memory_order_acq_rel) > 1;
+    }
+
+private:
+    std::atomic<Size> _count;
+    std::coroutine_handle<> _continuation;
+};
+
+struct WhenAllPart
+{
+    struct promise_type : CoroutineFrameAllocation
+    {
+        WhenAllLatch* latch = nullptr;
+
+        WhenAllPart get_return_object() noexcept { return WhenAllPart{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        auto final_suspend() noexcept
+        {
+            struct Awaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept { return h.promise().latch->arrive(); }
+
+                void await_resume() noexcept { }
+            };
+
+            return Awaiter{};
+        }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    explicit WhenAllPart(std::coroutine_handle<promise_type> h) noexcept : handle(h) { }
+
+    WhenAllPart(WhenAllPart&& other) noexcept : handle(std::exchange(other.handle, nullptr)) { }
+
+    WhenAllPart(const WhenAllPart&)            = delete;
+    WhenAllPart& operator=(const WhenAllPart&) = delete;
+    WhenAllPart& operator=(WhenAllPart&&)      = delete;
+
+    ~WhenAllPart()
+    {
+        if (handle)
+            handle.destroy();
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+template<typename Parts>
+struct WhenAllAwaiter
+{
+    WhenAllLatch& latch;
+    Parts& parts;
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        for (WhenAllPart& part : parts) {
+            part.handle.promise().latch = &latch;
+            part.handle.resume();
+        }
+        return latch.suspend(awaiting);
+    }
+
+    void await_resume() noexcept { }
+};
+
+} // namespace detail
+
+/**
+ * @brief 并发等待所有任务，按参数顺序返回结果 (void 任务对应 std::monostate).
+ *        各任务依次启动，遇到第一个挂起点 (例如 co_await Schedule(pool)) 后即转入下一个，因此可以并行执行.
+ *        任一任务失败时，在所有任务结束后重新抛出第一个 (按参数顺序) 异常.
+ */
+template<typename... Ts>
+Task<std::tuple<detail::VoidToMonostate<Ts>...>> WhenAll(Task<Ts>... tasks)
+{
+    constexpr Size N = sizeof...(Ts);
+
+    std::tuple<Opt<detail::VoidToMonostate<Ts>>...> values;
+    std::array<std::exception_ptr, N> errors;
+    detail::WhenAllLatch latch(N);
+
+    auto parts = [&]<Size... I>(std::index_sequence<I...>) {
+        auto taskRefs = std::tie(tasks...);
+        return std::array<detail::WhenAllPart, N>{
+            detail::AwaitInto<detail::WhenAllPart>(std::get<I>(taskRefs), std::get<I>(values), errors[I])...};
+    }(std::index_sequence_for<Ts...>{});
+
+    co_await detail::WhenAllAwaiter<decltype(parts)>{latch, parts};
+
+    for (const std::exception_ptr& e : errors)
+        if (e)
+            std::rethrow_exception(e);
+
+    co_return std::apply([](auto&... v) { return std::tuple<detail::VoidToMonostate<Ts>...>(std::move(*v)...); }, values);
+}
+
+/**
+ * @brief 并发等待一组同类型任务. T 为 void 时返回 Task<void>，否则按输入顺序返回结果数组.
+ */
+template<typename T>
+auto WhenAll(std::vector<Task<T>> tasks) -> Task<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>>
+{
+    const Size n = tasks.size();
+
+    std::vector<Opt<detail::VoidToMonostate<T>>> values(n);
+    std::vector<std::exception_ptr> errors(n);
+    detail::WhenAllLatch latch(n);
+
+    std::vector<detail::WhenAllPart> parts;
+    parts.reserve(n);
+    for (Size i = 0; i < n; ++i)
+        parts.push_back(detail::AwaitInto<detail::WhenAllPart>(tasks[i], values[i], errors[i]));
+
+    co_await detail::WhenAllAwaiter<decltype(parts)>{latch, parts};
+
+    for (const std::exception_ptr& e : errors)
+        if (e)
+            std::rethrow_exception(e);
+
+    if constexpr (!std::is_void_v<T>) {
+        std::vector<T> results;
+        results.reserve(n);
+        for (auto& v : values)
+            results.push_back(std::move(*v));
+        co_return results;
+    }
+}
+
+template<typename T>
+struct WhenAnyResult
+{
+    Size index; ///< 最先完成的任务下标
+    detail::VoidToMonostate<T> value;
+};
+
+namespace detail {
+
+/**
+ * WhenAny 的共享状态. 输给最先完成者的分支会继续运行到结束 (协程无法被抢占取消)，
+ * 因此任务与状态由各分支共同持有，而不是放在等待方的协程帧中.
+ */
+template<typename T>
+struct WhenAnyState
+{
+    explicit WhenAnyState(std::vector<Task<T>>&& t) : tasks(std::move(t)), latch(1) { }
+
+    std::vector<Task<T>> tasks;
+    WhenAllLatch latch; ///< 只有获胜者到达
+    std::atomic<bool> decided{false};
+    Size index = 0;
+    Opt<VoidToMonostate<T>> value;
+    std::exception_ptr error;
+};
+
+template<typename T>
+DetachedTask WhenAnyBranch(Ptr<WhenAnyState<T>> state, Size i)
+{
+    Opt<VoidToMonostate<T>> value;
+    std::exception_ptr error;
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(state->tasks[i]);
+            value.emplace();
+        }
+        else {
+            value.emplace(co_await std::move(state->tasks[i]));
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    if (!state->decided.exchange(true, std::memory_order_acq_rel)) {
+        state->index = i;
+        state->value = std::move(value);
+        state->error = error;
+        co_await DestroyAndTransfer{state->latch.arrive()};
+    }
+}
+
+template<typename T>
+struct WhenAnyAwaiter
+{
+    const Ptr<WhenAnyState<T>>& state;
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        for (Size i = 0; i < state->tasks.size(); ++i)
+            WhenAnyBranch<T>(state, i);
+        return state->latch.suspend(awaiting);
+    }
+
+    void await_resume() noexcept { }
+};
+
+} // namespace detail
+
+/**
+ * @brief 等待最先完成的任务，返回其下标与结果; 若它失败则重新抛出其异常. 其余任务继续在后台运行直到结束.
+ */
+template<typename T>
+Task<WhenAnyResult<T>> WhenAny(std::vector<Task<T>> tasks)
+{
+    SLIB_CHECK(!tasks.empty(), "WhenAny requires at least one task.");
+
+    auto state = MakePtr<detail::WhenAnyState<T>>(std::move(tasks));
+    co_await detail::WhenAnyAwaiter<T>{state};
+
+    if (state->error)
+        std::rethrow_exception(state->error);
+    co_return WhenAnyResult<T>{state->index, std::move(*state->value)};
+}
+
+} // namespace slib
@@ -0,0 +1,330 @@
+﻿/**
+ * @File ThreadPool.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "ThreadPool.hpp"
+
+#include <thread>
+
+#include <SLib/Error.hpp>
+#include <SLib/Concurrency/WorkStealingDeque.hpp>
+
+#if defined(SLIB_IN_LINUX)
+#  include <pthread.h>
+#  include <sched.h>
+#elif defined(SLIB_IN_WINDOWS)
+#  include <windows.h>
+#endif
+
+using namespace slib;
+
+namespace {
+
+/// 进入休眠前的自旋轮数.
+constexpr u32 kSpinRounds  = 64;
+constexpr u32 kYieldRounds = 16;
+
+/// 等待时协助执行任务的最大嵌套层数. 超过后只执行本地队列中的任务 (均为当前栈帧派生的子任务)，
+/// 避免窃取来的无关任务层层嵌套导致栈溢出.
+constexpr u32 kMaxHelpDepth = 32;
+
+SLIB_FORCE_INLINE void CpuRelax()
+{
+#if SLIB_ARCH_X86
+    _mm_pause();
+#elif SLIB_ARCH_ARM64 && !SLIB_COMPILER_MSVC
+    __asm__ __volatile__("yield");
+#endif
+}
+
+SLIB_FORCE_INLINE u64 NextRandom(u64& state)
+{
+    // xorshift64*，仅用于随机选择窃取对象
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545'F491'4F6C'DD1DULL;
+}
+
+bool PinCurrentThread(Size cpu)
+{
+#if defined(SLIB_IN_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(SLIB_IN_WINDOWS)
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << (cpu % (sizeof(DWORD_PTR) * 8))) != 0;
+#else
+    // macOS 不支持硬绑定，忽略
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace
+
+struct alignas(SLIB_CACHE_LINE_SIZE) slib::detail::ThreadPoolWorker
+{
+    ThreadPool* pool = nullptr;
+    Size index       = 0;
+    u64 rng          = 0;
+    WorkStealingDeque<TaskHandle*> deque;
+    std::thread thread;
+};
+
+namespace {
+
+struct ExternalContext
+{
+    u64 rng = 0x9E37'79B9'7F4A'7C15ULL ^ std::hash<std::thread::id>{}(std::this_thread::get_id());
+};
+
+thread_local detail::ThreadPoolWorker* tWorker = nullptr;
+thread_local ExternalContext tExternal;
+thread_local u32 tHelpDepth = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(const ThreadPoolOptions& options)
+{
+    const Size hardware = Max<Size>(std::thread::hardware_concurrency(), 1);
+    const Size count    = options.threads > 0 ? options.threads : hardware;
+
+    _workers.reserve(count);
+    for (Size i = 0; i < count; ++i) {
+        auto worker   = std::make_unique<Worker>();
+        worker->pool  = this;
+        worker->index = i;
+        worker->rng   = 0x9E37'79B9'7F4A'7C15ULL * (i + 1);
+        _workers.push_back(std::move(worker));
+    }
+
+    // 所有 Worker 构造完成后再启动线程，窃取时可以安全地遍历 _workers
+    for (Size i = 0; i < count; ++i) {
+        Worker& worker = *_workers[i];
+        const Size cpu = options.pinThreads ? (options.firstCpu + i) % hardware : Size(-1);
+        worker.thread  = std::thread([this, &worker, cpu] {
+            if (cpu != Size(-1))
+                PinCurrentThread(cpu);
+            tWorker = &worker;
+            Guardian([this, &worker] { workerLoop(worker); });
+            tWorker = nullptr;
+        });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    _stop.store(true, std::memory_order_seq_cst);
+    _wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    _wakeEpoch.notify_all();
+
+    for (auto& worker : _workers)
+        if (worker->thread.joinable())
+            worker->thread.join();
+}
+
+void ThreadPool::submit(TaskHandle& task)
+{
+    SLIB_DEBUG_ASSERT(!task.done());
+    task._detached = false;
+    enqueue(task);
+}
+
+void ThreadPool::post(TaskHandle& task)
+{
+    task._detached = true;
+    enqueue(task);
+}
+
+void ThreadPool::enqueue(TaskHandle& task)
+{
+    if (Worker* self = currentWorker()) {
+        self->deque.push(&task);
+    }
+    else {
+        std::lock_guard lock(_injectMutex);
+        task._next = nullptr;
+        if (_injectTail)
+            _injectTail->_next = &task;
+        else
+            _injectHead = &task;
+        _injectTail = &task;
+        _injectCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    wakeWorker();
+}
+
+void ThreadPool::wait(TaskHandle& task)
+{
+    join(task);
+    if (task._error)
+        std::rethrow_exception(std::exchange(task._error, nullptr));
+}
+
+void ThreadPool::join(TaskHandle& task) noexcept
+{
+    Worker* self    = currentWorker();
+    const bool help = tHelpDepth < kMaxHelpDepth;
+
+    ++tHelpDepth;
+    u32 idle = 0;
+    while (!task.done()) {
+        if (TaskHandle* other = findTask(self, help)) {
+            execute(*other);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < kSpinRounds) {
+            CpuRelax();
+            continue;
+        }
+        if (idle < kSpinRounds + kYieldRounds) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // 长时间等待: 在完成计数上休眠，任一任务完成时被唤醒后重新检查
+        const u32 epoch = _doneEpoch.load(std::memory_order_seq_cst);
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        if (!task._done.load(std::memory_order_seq_cst))
+            _doneEpoch.wait(epoch, std::memory_order_seq_cst);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        idle = 0;
+    }
+    --tHelpDepth;
+}
+
+bool ThreadPool::shouldSplit() const noexcept
+{
+    const Worker* self = currentWorker();
+    return self == nullptr || self->deque.empty();
+}
+
+ThreadPool::Worker* ThreadPool::currentWorker() const noexcept
+{
+    Worker* w = tWorker;
+    return w != nullptr && w->pool == this ? w : nullptr;
+}
+
+TaskHandle* ThreadPool::findTask(Worker* self, bool steal) noexcept
+{
+    if (self) {
+        if (auto task = self->deque.pop())
+            return *task;
+    }
+    if (!steal)
+        return nullptr;
+
+    if (_injectCount.load(std::memory_order_relaxed) > 0) {
+        if (TaskHandle* task = popInjected())
+            return task;
+    }
+
+    const Size n = _workers.size();
+    u64& rng     = self ? self->rng : tExternal.rng;
+    Size victim  = static_cast<Size>(NextRandom(rng) % n);
+    for (Size i = 0; i < n; ++i, victim = victim + 1 == n ? 0 : victim + 1) {
+        Worker& other = *_workers[victim];
+        if (&other == self)
+            continue;
+        if (auto task = other.deque.steal())
+            return *task;
+    }
+    return nullptr;
+}
+
+TaskHandle* ThreadPool::popInjected() noexcept
+{
+    std::lock_guard lock(_injectMutex);
+    TaskHandle* task = _injectHead;
+    if (task) {
+        _injectHead = task->_next;
+        if (!_injectHead)
+            _injectTail = nullptr;
+        _injectCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+void ThreadPool::execute(TaskHandle& task) noexcept
+{
+    if (task._detached) {
+        // 先把可调用对象移到栈上，执行期间任务对象可能已被销毁
+        TaskHandle::Function func = std::move(task._func);
+        try {
+            func();
+        } catch (...) {
+            Guardian([] { std::rethrow_exception(std::current_exception()); });
+        }
+        return;
+    }
+
+    try {
+        task._func();
+    } catch (...) {
+        task._error = std::current_exception();
+    }
+
+    // 设置 _done 之后等待方可能立即销毁任务，此后只能访问线程池自身的状态
+    task._done.store(true, std::memory_order_seq_cst);
+    if (_waiters.load(std::memory_order_seq_cst) > 0) {
+        _doneEpoch.fetch_add(1, std::memory_order_release);
+        _doneEpoch.notify_all();
+    }
+}
+
+void ThreadPool::wakeWorker() noexcept
+{
+    // 与 workerLoop 中 "_sleepers 自增后再检查队列" 构成 Dekker 式同步，保证不会丢失唤醒
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_sleepers.load(std::memory_order_relaxed) > 0) {
+        _wakeEpoch.fetch_add(1, std::memory_order_release);
+        _wakeEpoch.notify_one();
+    }
+}
+
+void ThreadPool::workerLoop(Worker& self)
+{
+    u32 idle = 0;
+    while (true) {
+        if (TaskHandle* task = findTask(&self, true)) {
+            execute(*task);
+            idle = 0;
+            continue;
+        }
+
+        if (_stop.load(std::memory_order_acquire))
+            return;
+
+        if (++idle < kSpinRounds) {
+            CpuRelax();
+            continue;
+        }
+        if (idle < kSpinRounds + kYieldRounds) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const u32 epoch = _wakeEpoch.load(std::memory_order_seq_cst);
+        _sleepers.fetch_add(1, std::memory_order_seq_cst);
+        if (TaskHandle* task = findTask(&self, true)) {
+            _sleepers.fetch_sub(1, std::memory_order_relaxed);
+            execute(*task);
+        }
+        else if (!_stop.load(std::memory_order_seq_cst)) {
+            _wakeEpoch.wait(epoch, std::memory_order_seq_cst);
+            _sleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+        else {
+            _sleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+        idle = 0;
+    }
+}
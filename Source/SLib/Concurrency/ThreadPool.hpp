@@ -0,0 +1,318 @@
+﻿/**
+ * @File ThreadPool.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/Math/Common.hpp>
+#include <SLib/Interface/ISingleton.hpp>
+#include <SLib/Utility/InlineFunction.hpp>
+
+namespace slib {
+
+class ThreadPool;
+
+namespace detail {
+struct ThreadPoolWorker;
+} // namespace detail
+
+/**
+ * 可被线程池调度的任务. 可调用对象保存在内联缓冲区中，任务本身由调用方持有 (通常位于栈上)，因此提交任务不分配内存.
+ * 提交后直到 ThreadPool::wait / join 返回之前，任务对象不可移动或销毁.
+ */
+class TaskHandle
+{
+public:
+    using Function = InlineFunction<void(), 48>;
+
+    template<typename F>
+    explicit TaskHandle(F&& f) : _func(std::forward<F>(f))
+    {
+    }
+
+    TaskHandle(const TaskHandle&)            = delete;
+    TaskHandle& operator=(const TaskHandle&) = delete;
+
+    SLIB_NODISCARD bool done() const noexcept { return _done.load(std::memory_order_acquire); }
+
+private:
+    friend class ThreadPool;
+
+    Function _func;
+    std::exception_ptr _error;
+    TaskHandle* _next = nullptr; ///< 注入队列的侵入式链表
+    bool _detached    = false;
+    std::atomic<bool> _done{false};
+};
+
+struct ThreadPoolOptions
+{
+    Size threads    = 0;     ///< 工作线程数，0 表示硬件并发数
+    bool pinThreads = false; ///< 是否将第 i 个工作线程绑定到第 (firstCpu + i) 个逻辑核
+    Size firstCpu   = 0;
+};
+
+/**
+ * 工作窃取线程池. 每个工作线程拥有一个 Chase-Lev 双端队列: 工作线程提交的任务压入自己的队列底部，
+ * 空闲时从其他队列顶部窃取; 外部线程提交的任务进入共享的注入队列.
+ *
+ * wait / join 在等待期间会执行其他任务，因此可以在任务内部嵌套提交与等待 (fork-join) 而不会死锁.
+ * 工作线程运行在 Guardian 中，任务抛出的异常被捕获并在 wait 时于等待方重新抛出.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(const ThreadPoolOptions& options = {});
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief 进程级共享的线程池，首次调用时创建，作为单例在 ShutdownSingletons 中销毁.
+     */
+    SLIB_FORCE_INLINE static ThreadPool& Global() { return Singleton<ThreadPool>::Get(); }
+
+    SLIB_NODISCARD Size size() const { return _workers.size(); }
+
+    /**
+     * @brief 提交任务. 任务在完成并被 wait / join 之前必须保持存活.
+     */
+    void submit(TaskHandle& task);
+
+    /**
+     * @brief 提交不需要等待的任务. 线程池在开始执行任务后不再访问任务对象，因此任务可以在执行期间销毁自身
+     *        (例如恢复一个协程，而任务对象位于该协程帧中). 任务抛出的异常交由 Guardian 报告.
+     */
+    void post(TaskHandle& task);
+
+    /**
+     * @brief 等待任务完成 (期间协助执行其他任务)，并重新抛出任务中的异常.
+     */
+    void wait(TaskHandle& task);
+
+    /**
+     * @brief 等待任务完成但不抛出异常，异常保留在任务中.
+     */
+    void join(TaskHandle& task) noexcept;
+
+    /**
+     * @brief 惰性二分 (lazy binary splitting) 的判断依据: 当前线程的本地队列为空说明先前拆出的任务已被窃取，
+     *        其他线程有空闲算力，值得继续拆分.
+     */
+    SLIB_NODISCARD bool shouldSplit() const noexcept;
+
+private:
+    using Worker = detail::ThreadPoolWorker;
+
+    Worker* currentWorker() const noexcept;
+    TaskHandle* findTask(Worker* self, bool steal) noexcept;
+    TaskHandle* popInjected() noexcept;
+    void enqueue(TaskHandle& task);
+    void execute(TaskHandle& task) noexcept;
+    void wakeWorker() noexcept;
+    void workerLoop(Worker& self);
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    std::mutex _injectMutex;
+    TaskHandle* _injectHead = nullptr;
+    TaskHandle* _injectTail = nullptr;
+    std::atomic<Size> _injectCount{0};
+
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<u32> _wakeEpoch{0};
+    std::atomic<u32> _sleepers{0};
+    std::atomic<bool> _stop{false};
+
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<u32> _doneEpoch{0};
+    std::atomic<u32> _waiters{0};
+};
+
+// ==================
+// Parallel loops
+// ==================
+
+/// 自动粒度下每个工作线程的目标块数. 惰性二分只在有空闲线程时才拆分，因此较小的粒度几乎没有额外开销.
+constexpr Size kParallelChunksPerWorker = 16;
+
+namespace detail {
+
+template<typename F>
+SLIB_FORCE_INLINE void InvokeRange(F& body, Size begin, Size end)
+{
+    if constexpr (std::is_invocable_v<F&, Size, Size>) {
+        body(begin, end);
+    }
+    else {
+        for (Size i = begin; i < end; ++i)
+            body(i);
+    }
+}
+
+SLIB_FUNC inline Size ParallelGrain(const ThreadPool& pool, Size n, Size grain)
+{
+    return grain > 0 ? grain : Max<Size>(n / ((pool.size() + 1) * kParallelChunksPerWorker), 1);
+}
+
+/**
+ * 惰性二分执行器: 每处理完一个粒度块检查一次是否值得拆分，拆分时右半部分作为任务提交，左半部分就地递归.
+ * 任一块抛出异常后，尚未开始的块会被跳过.
+ */
+template<typename F>
+class ParallelForRunner
+{
+public:
+    ParallelForRunner(ThreadPool& pool, F& body, Size grain) : _pool(pool), _body(body), _grain(grain) { }
+
+    void run(Size begin, Size end)
+    {
+        while (end - begin > _grain) {
+            if (_cancelled.load(std::memory_order_relaxed))
+                return;
+
+            if (_pool.shouldSplit()) {
+                const Size mid = begin + (end - begin) / 2;
+                TaskHandle right([this, mid, end] { run(mid, end); });
+                _pool.submit(right);
+                guarded(right, [&] { run(begin, mid); });
+                _pool.wait(right);
+                return;
+            }
+
+            guarded([&] { InvokeRange(_body, begin, begin + _grain); });
+            begin += _grain;
+        }
+        if (!_cancelled.load(std::memory_order_relaxed))
+            guarded([&] { InvokeRange(_body, begin, end); });
+    }
+
+private:
+    template<typename G>
+    void guarded(G&& g)
+    {
+        try {
+            g();
+        } catch (...) {
+            _cancelled.store(true, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    template<typename G>
+    void guarded(TaskHandle& pending, G&& g)
+    {
+        try {
+            g();
+        } catch (...) {
+            // 已提交的任务引用当前栈帧，必须等它结束后才能继续展开
+            _cancelled.store(true, std::memory_order_relaxed);
+            _pool.join(pending);
+            throw;
+        }
+    }
+
+    ThreadPool& _pool;
+    F& _body;
+    Size _grain;
+    std::atomic<bool> _cancelled{false};
+};
+
+template<typename T, typename M, typename C>
+class ParallelReduceRunner
+{
+public:
+    ParallelReduceRunner(ThreadPool& pool, const T& identity, M& map, C& combine, Size grain)
+        : _pool(pool), _identity(identity), _map(map), _combine(combine), _grain(grain)
+    {
+    }
+
+    T run(Size begin, Size end)
+    {
+        T acc = _identity;
+        while (end - begin > _grain) {
+            if (_pool.shouldSplit()) {
+                const Size mid = begin + (end - begin) / 2;
+                T rightValue   = _identity;
+                TaskHandle right([this, mid, end, &rightValue] { rightValue = run(mid, end); });
+                _pool.submit(right);
+
+                T leftValue = _identity;
+                try {
+                    leftValue = run(begin, mid);
+                } catch (...) {
+                    _pool.join(right);
+                    throw;
+                }
+                _pool.wait(right);
+                return _combine(_combine(std::move(acc), std::move(leftValue)), std::move(rightValue));
+            }
+
+            acc = _combine(std::move(acc), _map(begin, begin + _grain));
+            begin += _grain;
+        }
+        return _combine(std::move(acc), _map(begin, end));
+    }
+
+private:
+    ThreadPool& _pool;
+    const T& _identity;
+    M& _map;
+    C& _combine;
+    Size _grain;
+};
+
+} // namespace detail
+
+/**
+ * @brief 并行执行 [begin, end). body 可以是 body(i) 或 body(rangeBegin, rangeEnd)，后者便于在块内向量化.
+ *        grain 为 0 时按线程数自动选择粒度. body 抛出的异常在调用方重新抛出.
+ */
+template<typename F>
+void ParallelFor(ThreadPool& pool, Size begin, Size end, F&& body, Size grain = 0)
+{
+    if (begin >= end)
+        return;
+
+    detail::ParallelForRunner<std::remove_reference_t<F>> runner(pool, body, detail::ParallelGrain(pool, end - begin, grain));
+    runner.run(begin, end);
+}
+
+template<typename F>
+void ParallelFor(Size begin, Size end, F&& body, Size grain = 0)
+{
+    ParallelFor(ThreadPool::Global(), begin, end, std::forward<F>(body), grain);
+}
+
+/**
+ * @brief 并行归约: 结果为 combine(identity, map(b0, e0), map(b1, e1), ...)，各块按区间顺序合并，
+ *        因此 combine 只需满足结合律. 块的划分取决于运行时的窃取情况，浮点归约的舍入结果可能每次不同;
+ *        需要可复现的浮点求和时请使用 Reduce.hpp 中的 Parallel* 函数.
+ */
+template<typename T, typename M, typename C>
+SLIB_NODISCARD T ParallelReduce(ThreadPool& pool, Size begin, Size end, const T& identity, M&& map, C&& combine, Size grain = 0)
+{
+    if (begin >= end)
+        return identity;
+
+    detail::ParallelReduceRunner<T, std::remove_reference_t<M>, std::remove_reference_t<C>> runner(
+        pool, identity, map, combine, detail::ParallelGrain(pool, end - begin, grain));
+    return runner.run(begin, end);
+}
+
+template<typename T, typename M, typename C>
+SLIB_NODISCARD T ParallelReduce(Size begin, Size end, const T& identity, M&& map, C&& combine, Size grain = 0)
+{
+    return ParallelReduce(ThreadPool::Global(), begin, end, identity, std::forward<M>(map), std::forward<C>(combine), grain);
+}
+
+} // namespace slib
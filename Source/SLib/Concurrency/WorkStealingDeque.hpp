@@ -0,0 +1,144 @@
+﻿/**
+ * @File WorkStealingDeque.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * Chase-Lev 工作窃取双端队列 (内存序取自 Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models", 2013).
+ *
+ * 拥有者线程在底部 push/pop (LIFO，缓存友好)，其他线程在顶部 steal (FIFO，偷走最早、通常也是最大的任务).
+ * 元素需可平凡复制，通常为指针. 扩容时旧数组保留到队列析构，因为并发的 steal 可能仍在读取它.
+ */
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class WorkStealingDeque
+{
+    struct Array
+    {
+        explicit Array(i64 capacity) : mask(capacity - 1), slots(std::make_unique<std::atomic<T>[]>(static_cast<Size>(capacity))) { }
+
+        SLIB_NODISCARD i64 capacity() const { return mask + 1; }
+
+        SLIB_NODISCARD T get(i64 i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+
+        void put(i64 i, T x) { slots[i & mask].store(x, std::memory_order_relaxed); }
+
+        i64 mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+public:
+    explicit WorkStealingDeque(Size capacity = 256)
+    {
+        auto array = std::make_unique<Array>(static_cast<i64>(NextPowerOfTwo(Max<Size>(capacity, 2))));
+        _array.store(array.get(), std::memory_order_relaxed);
+        _arrays.push_back(std::move(array));
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&)            = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief 仅拥有者线程调用.
+     */
+    void push(T x)
+    {
+        const i64 b = _bottom.load(std::memory_order_relaxed);
+        const i64 t = _top.load(std::memory_order_acquire);
+        Array* a    = _array.load(std::memory_order_relaxed);
+        if (b - t > a->capacity() - 1)
+            a = grow(a, t, b);
+
+        a->put(b, x);
+        _bottom.store(b + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief 仅拥有者线程调用，从底部取出最近 push 的元素.
+     */
+    SLIB_NODISCARD Opt<T> pop()
+    {
+        const i64 b = _bottom.load(std::memory_order_relaxed) - 1;
+        Array* a    = _array.load(std::memory_order_relaxed);
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        i64 t = _top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        Opt<T> x = a->get(b);
+        if (t == b) {
+            // 只剩最后一个元素，与窃取者竞争
+            if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                x = std::nullopt;
+            _bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return x;
+    }
+
+    /**
+     * @brief 任意线程调用，从顶部窃取最早 push 的元素. 与其他线程竞争失败时也返回 std::nullopt.
+     */
+    SLIB_NODISCARD Opt<T> steal()
+    {
+        i64 t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const i64 b = _bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return std::nullopt;
+
+        const T x = _array.load(std::memory_order_acquire)->get(t);
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return std::nullopt;
+        return x;
+    }
+
+    /**
+     * @brief 近似的元素数，仅用于启发式判断.
+     */
+    SLIB_NODISCARD Size size() const
+    {
+        const i64 b = _bottom.load(std::memory_order_relaxed);
+        const i64 t = _top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<Size>(b - t) : 0;
+    }
+
+    SLIB_NODISCARD bool empty() const { return size() == 0; }
+
+private:
+    Array* grow(Array* a, i64 t, i64 b)
+    {
+        auto bigger = std::make_unique<Array>(a->capacity() * 2);
+        for (i64 i = t; i < b; ++i)
+            bigger->put(i, a->get(i));
+
+        Array* raw = bigger.get();
+        _arrays.push_back(std::move(bigger));
+        _array.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<i64> _top{0};
+    alignas(SLIB_CACHE_LINE_SIZE) std::atomic<i64> _bottom{0};
+    std::atomic<Array*> _array{nullptr};
+    std::vector<std::unique_ptr<Array>> _arrays;
+};
+
+} // namespace slib
@@ -0,0 +1,422 @@
+﻿/**
+ * @File CrashHandler.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "CrashHandler.hpp"
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#include <SLib/Math/Common.hpp>
+
+#if defined(SLIB_IN_LINUX) || defined(SLIB_IN_MAC)
+#  define SLIB_CRASH_HANDLER_POSIX 1
+#  include <csignal>
+#  include <fcntl.h>
+#  include <sys/syscall.h>
+#  include <ucontext.h>
+#  include <unistd.h>
+#  if defined(__GLIBC__)
+#    include <execinfo.h>
+#  endif
+#else
+#  define SLIB_CRASH_HANDLER_POSIX 0
+#endif
+
+using namespace slib;
+
+namespace {
+
+// ==================
+// 最近日志的环形缓冲
+// ==================
+
+struct LogSlot
+{
+    std::atomic<u32> size{0};
+    char text[CrashHandler::kLogEntryBytes];
+};
+
+constinit std::array<LogSlot, CrashHandler::kLogEntries> sLogRing{};
+constinit std::atomic<u64> sLogNext{0};
+
+constinit std::array<std::atomic<CrashHandler::Callback>, CrashHandler::kMaxCallbacks> sCallbacks{};
+
+} // namespace
+
+void CrashHandler::RecordLog(StringView line)
+{
+    const u64 index = sLogNext.fetch_add(1, std::memory_order_relaxed);
+    LogSlot& slot   = sLogRing[index % kLogEntries];
+    const Size size = Min<Size>(line.size(), kLogEntryBytes);
+
+    // 写入期间 size 为 0，读取方跳过未写完的条目
+    slot.size.store(0, std::memory_order_relaxed);
+    std::memcpy(slot.text, line.data(), size);
+    slot.size.store(static_cast<u32>(size), std::memory_order_release);
+}
+
+bool CrashHandler::AddCallback(Callback callback)
+{
+    for (auto& slot : sCallbacks) {
+        Callback expected = nullptr;
+        if (slot.compare_exchange_strong(expected, callback, std::memory_order_acq_rel))
+            return true;
+    }
+    return false;
+}
+
+#if SLIB_CRASH_HANDLER_POSIX
+
+namespace {
+
+constexpr std::array kSignals = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+constexpr Size kAltStackBytes = 64 * 1024;
+constexpr Size kMaxFrames     = 64;
+constexpr Size kMaxPath       = 512;
+
+struct HandlerState
+{
+    std::mutex mutex;
+    std::atomic<bool> installed{false};
+    std::array<struct sigaction, kSignals.size()> previous{};
+    char dumpPath[kMaxPath]{};
+    bool writeToStderr = true;
+};
+
+HandlerState& GetState()
+{
+    static auto* state = new HandlerState;
+    return *state;
+}
+
+// 处理中的线程，用于区分处理函数自身再次崩溃与其他线程同时崩溃
+constinit std::atomic<long> sCrashingThread{0};
+
+thread_local std::unique_ptr<char[]> tAltStack;
+
+long CurrentThreadId()
+{
+#  if defined(SLIB_IN_LINUX)
+    return static_cast<long>(syscall(SYS_gettid));
+#  else
+    return static_cast<long>(getpid());
+#  endif
+}
+
+/**
+ * 只使用栈上缓冲与 write(2) 的输出，可同时写到两个文件描述符.
+ */
+class DumpWriter
+{
+public:
+    DumpWriter(int fd0, int fd1) : _fds{fd0, fd1} { }
+
+    ~DumpWriter() { flush(); }
+
+    DumpWriter& text(const char* s) { return text(s, std::strlen(s)); }
+
+    DumpWriter& text(const char* s, Size n)
+    {
+        while (n > 0) {
+            if (_size == sizeof(_buffer))
+                flush();
+            const Size chunk = Min(n, sizeof(_buffer) - _size);
+            std::memcpy(_buffer + _size, s, chunk);
+            _size += chunk;
+            s     += chunk;
+            n     -= chunk;
+        }
+        return *this;
+    }
+
+    DumpWriter& hex(u64 value)
+    {
+        char digits[18] = {'0', 'x'};
+        for (int i = 0; i < 16; ++i)
+            digits[17 - i] = "0123456789abcdef"[(value >> (i * 4)) & 0xF];
+        return text(digits, sizeof(digits));
+    }
+
+    DumpWriter& dec(i64 value)
+    {
+        char digits[24];
+        Size pos = sizeof(digits);
+        u64 v    = value < 0 ? u64(0) - static_cast<u64>(value) : static_cast<u64>(value);
+        do {
+            digits[--pos] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        } while (v);
+        if (value < 0)
+            digits[--pos] = '-';
+        return text(digits + pos, sizeof(digits) - pos);
+    }
+
+    void flush()
+    {
+        for (int fd : _fds) {
+            if (fd < 0)
+                continue;
+            Size done = 0;
+            while (done < _size) {
+                const auto n = ::write(fd, _buffer + done, _size - done);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    break;
+                done += static_cast<Size>(n);
+            }
+        }
+        _size = 0;
+    }
+
+    SLIB_NODISCARD int fd(Size i) const { return _fds[i]; }
+
+private:
+    int _fds[2];
+    char _buffer[1024];
+    Size _size = 0;
+};
+
+const char* SignalName(int signal)
+{
+    switch (signal) {
+    case SIGSEGV : return "SIGSEGV";
+    case SIGBUS  : return "SIGBUS";
+    case SIGFPE  : return "SIGFPE";
+    case SIGILL  : return "SIGILL";
+    case SIGABRT : return "SIGABRT";
+    default      : return "signal";
+    }
+}
+
+void WriteRegisters(DumpWriter& out, const void* context)
+{
+#  if defined(SLIB_IN_LINUX) && defined(__x86_64__)
+    // 顺序与 REG_R8 ... REG_TRAPNO 一致
+    constexpr const char* kNames[] = {"r8",  "r9",  "r10", "r11", "r12", "r13", "r14", "r15",    "rdi", "rsi",   "rbp",
+                                      "rbx", "rdx", "rax", "rcx", "rsp", "rip", "efl", "csgsfs", "err", "trapno"};
+    const auto& regs               = static_cast<const ucontext_t*>(context)->uc_mcontext.gregs;
+    for (Size i = 0; i < std::size(kNames); ++i)
+        out.text(i % 4 == 0 ? "\n  " : "  ").text(kNames[i]).text("=").hex(static_cast<u64>(regs[i]));
+    out.text("\n");
+#  elif defined(SLIB_IN_LINUX) && defined(__aarch64__)
+    const auto& mc = static_cast<const ucontext_t*>(context)->uc_mcontext;
+    for (Size i = 0; i < 31; ++i)
+        out.text(i % 4 == 0 ? "\n  x" : "  x").dec(static_cast<i64>(i)).text("=").hex(mc.regs[i]);
+    out.text("\n  sp=").hex(mc.sp).text("  pc=").hex(mc.pc).text("  pstate=").hex(mc.pstate).text("\n");
+#  else
+    (void)context;
+    out.text(" (not available on this platform)\n");
+#  endif
+}
+
+void WriteBacktrace(DumpWriter& out)
+{
+#  if defined(__GLIBC__)
+    void* frames[kMaxFrames];
+    const int count = backtrace(frames, static_cast<int>(kMaxFrames));
+    for (int i = 0; i < count; ++i)
+        out.text("  #").dec(i).text(" ").hex(reinterpret_cast<u64>(frames[i])).text("\n");
+
+    // backtrace_symbols_fd 不分配内存，给出 "模块(符号+偏移)" 形式的近似符号
+    out.text("Symbols:\n");
+    out.flush();
+    for (Size i = 0; i < 2; ++i) {
+        if (out.fd(i) >= 0)
+            backtrace_symbols_fd(frames, count, out.fd(i));
+    }
+#  else
+    out.text("  (not available on this platform)\n");
+#  endif
+}
+
+/**
+ * @brief 复制 /proc/self/maps 中的可执行映射，便于把原始地址离线换算为模块偏移.
+ */
+void WriteMappings(DumpWriter& out)
+{
+#  if defined(SLIB_IN_LINUX)
+    const int fd = ::open("/proc/self/maps", O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+
+    char chunk[1024];
+    char line[512];
+    Size lineSize = 0;
+    for (;;) {
+        const auto n = ::read(fd, chunk, sizeof(chunk));
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        for (Size i = 0; i < static_cast<Size>(n); ++i) {
+            if (lineSize < sizeof(line))
+                line[lineSize++] = chunk[i];
+            if (chunk[i] != '\n')
+                continue;
+            // 形如 "start-end perms offset dev inode path"，只保留可执行的映射
+            const char* space = static_cast<const char*>(std::memchr(line, ' ', lineSize));
+            if (space && space + 3 < line + lineSize && space[3] == 'x')
+                out.text("  ").text(line, lineSize);
+            lineSize = 0;
+        }
+    }
+    ::close(fd);
+#  else
+    (void)out;
+#  endif
+}
+
+void WriteRecentLogs(DumpWriter& out)
+{
+    const u64 next  = sLogNext.load(std::memory_order_acquire);
+    const u64 first = next > CrashHandler::kLogEntries ? next - CrashHandler::kLogEntries : 0;
+    for (u64 i = first; i < next; ++i) {
+        const LogSlot& slot = sLogRing[i % CrashHandler::kLogEntries];
+        const u32 size      = slot.size.load(std::memory_order_acquire);
+        if (size == 0)
+            continue;
+        out.text("  ").text(slot.text, size).text("\n");
+    }
+}
+
+void CrashSignalHandler(int signal, siginfo_t* info, void* context)
+{
+    const long tid = CurrentThreadId();
+    long expected  = 0;
+    if (!sCrashingThread.compare_exchange_strong(expected, tid)) {
+        // 处理函数自身崩溃时交给默认处理; 其他线程同时崩溃时等待第一个线程结束进程
+        if (expected == tid) {
+            ::signal(signal, SIG_DFL);
+            ::raise(signal);
+            return;
+        }
+        for (;;)
+            ::pause();
+    }
+
+    auto& state    = GetState();
+    const int file = state.dumpPath[0] ? ::open(state.dumpPath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644) : -1;
+    {
+        DumpWriter out(state.writeToStderr ? STDERR_FILENO : -1, file);
+        out.text("\n*** SLib crash: ").text(SignalName(signal)).text(" (signal ").dec(signal).text(")");
+        out.text(", fault address ").hex(reinterpret_cast<u64>(info ? info->si_addr : nullptr));
+        out.text(", pid ").dec(getpid()).text(", tid ").dec(tid).text(" ***\n");
+
+        out.text("Registers:");
+        WriteRegisters(out, context);
+
+        out.text("Backtrace:\n");
+        WriteBacktrace(out);
+
+        out.text("Executable mappings:\n");
+        WriteMappings(out);
+
+        out.text("Recent log:\n");
+        WriteRecentLogs(out);
+        out.text("*** end of crash dump ***\n");
+    }
+    if (file >= 0)
+        ::close(file);
+
+    for (const auto& slot : sCallbacks) {
+        if (auto callback = slot.load(std::memory_order_acquire))
+            callback();
+    }
+
+    // 恢复默认处理并重新发出信号. 信号在处理期间被屏蔽，返回后才以默认方式递送
+    ::signal(signal, SIG_DFL);
+    ::raise(signal);
+}
+
+} // namespace
+
+Result<void> CrashHandler::Install(const CrashHandlerOptions& options)
+{
+    auto& state = GetState();
+    std::lock_guard lock(state.mutex);
+
+    if (state.installed.load(std::memory_order_relaxed))
+        return Unexpected(FailureType::AlreadyExists, "Crash handler is already installed");
+    if (options.dumpPath.size() >= kMaxPath)
+        return Unexpected(FailureType::InvalidArgument, "Crash dump path is too long");
+
+    std::memcpy(state.dumpPath, options.dumpPath.data(), options.dumpPath.size());
+    state.dumpPath[options.dumpPath.size()] = '\0';
+    state.writeToStderr                     = options.writeToStderr;
+
+#  if defined(__GLIBC__)
+    // backtrace 第一次调用时会加载 libgcc，不能发生在信号处理中
+    void* warmup[1];
+    backtrace(warmup, 1);
+#  endif
+
+    PrepareThread();
+
+    struct sigaction action{};
+    action.sa_sigaction = CrashSignalHandler;
+    action.sa_flags     = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+    for (Size i = 0; i < kSignals.size(); ++i)
+        sigaction(kSignals[i], &action, &state.previous[i]);
+
+    state.installed.store(true, std::memory_order_release);
+    return {};
+}
+
+void CrashHandler::Uninstall()
+{
+    auto& state = GetState();
+    std::lock_guard lock(state.mutex);
+
+    if (!state.installed.load(std::memory_order_relaxed))
+        return;
+    for (Size i = 0; i < kSignals.size(); ++i)
+        sigaction(kSignals[i], &state.previous[i], nullptr);
+    state.installed.store(false, std::memory_order_release);
+}
+
+bool CrashHandler::IsInstalled()
+{
+    return GetState().installed.load(std::memory_order_acquire);
+}
+
+void CrashHandler::PrepareThread()
+{
+    if (tAltStack)
+        return;
+
+    auto stack = std::make_unique<char[]>(kAltStackBytes);
+    stack_t ss{};
+    ss.ss_sp    = stack.get();
+    ss.ss_size  = kAltStackBytes;
+    ss.ss_flags = 0;
+    if (sigaltstack(&ss, nullptr) == 0)
+        tAltStack = std::move(stack);
+}
+
+#else
+
+Result<void> CrashHandler::Install(const CrashHandlerOptions&)
+{
+    return Unexpected(FailureType::Unsupported, "Crash handler requires POSIX signals");
+}
+
+void CrashHandler::Uninstall() { }
+
+bool CrashHandler::IsInstalled()
+{
+    return false;
+}
+
+void CrashHandler::PrepareThread() { }
+
+#endif
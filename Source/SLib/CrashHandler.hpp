@@ -0,0 +1,68 @@
+﻿/**
+ * @File CrashHandler.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <SLib/Math/Numeric.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+struct CrashHandlerOptions
+{
+    String dumpPath;           ///< 额外追加写入的转储文件，为空时只写 stderr
+    bool writeToStderr = true; ///< 是否同时写到 stderr
+};
+
+/**
+ * 进程级的崩溃处理. 在 SIGSEGV、SIGBUS、SIGFPE、SIGILL、SIGABRT 到来时，于备用信号栈上写出一份简要的转储:
+ * 信号与故障地址、寄存器、原始调用栈地址、可执行映射 (用于离线符号化)，以及最近的日志. 转储只使用预先分配的缓冲与
+ * write(2)，之后依次调用登记的回调 (例如刷新异步日志)，最后恢复默认处理并重新发出信号，保留原有的退出状态与 core dump.
+ *
+ * 正常路径上的唯一开销是 Logger 每条消息向环形缓冲的一次复制.
+ */
+class CrashHandler
+{
+public:
+    using Callback = void (*)();
+
+    /// 最近日志的条数与每条的最大字节数.
+    static constexpr Size kLogEntries    = 64;
+    static constexpr Size kLogEntryBytes = 256;
+
+    /// 可登记的回调数.
+    static constexpr Size kMaxCallbacks = 8;
+
+    /**
+     * @brief 安装信号处理并为当前线程准备备用信号栈. 已安装或平台不支持时返回错误.
+     */
+    static Result<void> Install(const CrashHandlerOptions& options = {});
+
+    /**
+     * @brief 恢复安装前的信号处理.
+     */
+    static void Uninstall();
+
+    SLIB_NODISCARD static bool IsInstalled();
+
+    /**
+     * @brief 为当前线程准备备用信号栈，使栈溢出也能被处理. 备用栈是线程私有的，其他线程需各自调用; 重复调用无开销.
+     */
+    static void PrepareThread();
+
+    /**
+     * @brief 登记在转储写出后调用的回调. 回调运行在信号处理中，只应做异步信号安全的操作. 已满时返回 false.
+     */
+    static bool AddCallback(Callback callback);
+
+    /**
+     * @brief 记录一条日志到环形缓冲，超长部分被截断. 由 Logger 调用.
+     */
+    static void RecordLog(StringView line);
+};
+
+} // namespace slib
@@ -6,26 +6,107 @@
  */
 
 #include "Error.hpp"
+
+#include <bit>
+#include <memory_resource>
+#include <mutex>
 #include <stacktrace>
+#include <unordered_map>
 
 using namespace slib;
 
+/**
+ * 抛出点的调用栈. 捕获时只记录帧地址，存放在记录内部的固定缓冲里; 符号化与格式化推迟到第一次 what().
+ */
+struct slib::details::StacktraceRecord
+{
+    static constexpr Size kMaxFrames = 64;
+
+    // 展开过程中容器可能按倍数扩容，预留两倍空间，避免回退到堆上
+    alignas(std::stacktrace_entry) std::byte storage[kMaxFrames * 2 * sizeof(std::stacktrace_entry)];
+    std::pmr::monotonic_buffer_resource resource{storage, sizeof(storage)};
+    std::pmr::stacktrace trace{&resource};
+
+    std::once_flag once;
+    std::string text;
+};
+
+namespace {
+
+/**
+ * 帧地址到符号文本的缓存. 同一抛出点反复失败时只符号化一次; 符号化本身 (DbgHelp 等) 也不保证线程安全.
+ */
+struct SymbolCache
+{
+    std::mutex mutex;
+    std::unordered_map<std::uintptr_t, std::string> entries;
+};
+
+SymbolCache& GetSymbolCache()
+{
+    static auto* cache = new SymbolCache;
+    return *cache;
+}
+
+std::string FormatStacktrace(const std::pmr::stacktrace& trace)
+{
+    auto& cache = GetSymbolCache();
+    std::lock_guard lock(cache.mutex);
+
+    std::string out;
+    for (Size i = 0; i < trace.size(); ++i) {
+        const auto& entry   = trace[i];
+        auto [it, inserted] = cache.entries.try_emplace(std::bit_cast<std::uintptr_t>(entry.native_handle()));
+        if (inserted)
+            it->second = std::to_string(entry);
+        out += std::format("{:>3}# {}\n", i, it->second);
+    }
+    return out;
+}
+
+/**
+ * @brief 记录调用者的调用者以上的帧地址，不做符号化.
+ */
+SLIB_NOINLINE std::shared_ptr<details::StacktraceRecord> CaptureStacktrace()
+{
+    using details::StacktraceRecord;
+
+    auto record   = std::make_shared<StacktraceRecord>();
+    record->trace = std::pmr::stacktrace::current(2, StacktraceRecord::kMaxFrames, &record->resource);
+    return record;
+}
+
+} // namespace
+
+const char* Exception::what() const noexcept
+{
+    if (!_pTrace)
+        return message();
+
+    try {
+        std::call_once(_pTrace->once, [this] { _pTrace->text = std::format("{}\n\nStacktrace:\n{}", message(), FormatStacktrace(_pTrace->trace)); });
+        return _pTrace->text.c_str();
+    } catch (...) {
+        return message();
+    }
+}
+
 void slib::ThrowException(const std::source_location& loc, StringView msg)
 {
-    std::string fullMsg  = std::format("{}\n\n{}:{} ({})", msg.data(), loc.file_name(), loc.line(), loc.function_name());
-    fullMsg             += std::format("\n\nStacktrace:\n{}", std::stacktrace::current(1));
+    StringBuilder fullMsg;
+    fullMsg.format("{}\n\n{}:{} ({})", msg, loc.file_name(), loc.line(), loc.function_name());
 
-    throw slib::RuntimeError(fullMsg);
+    throw slib::RuntimeError(fullMsg.view(), CaptureStacktrace());
 }
 
 void slib::ReportAssertion(const std::source_location& loc, StringView cond, StringView msg)
 {
     // clang-format off
-    std::string fullMsg = std::format("'{}'\n{}\n{}:{} ({})",
-                                      cond, msg,
-                                      loc.file_name(), loc.line(), loc.function_name());
+    StringBuilder fullMsg;
+    fullMsg.format("'{}'\n{}\n{}:{} ({})",
+                   cond, msg,
+                   loc.file_name(), loc.line(), loc.function_name());
     // clang-format on
-    fullMsg += std::format("\n\nStacktrace:\n{}", std::stacktrace::current(1));
 
-    throw slib::AssertionError(fullMsg);
-}
\ No newline at end of file
+    throw slib::AssertionError(fullMsg.view(), CaptureStacktrace());
+}
@@ -8,7 +8,6 @@
 #pragma once
 
 #include <cassert>
-#include <csignal>
 #include <cstdlib>
 #include <exception>
 #include <format>
@@ -16,25 +15,37 @@
 #include <source_location>
 
 #include <SLib/Portable.hpp>
+#include <SLib/CrashHandler.hpp>
 #include <SLib/Memory/Memory.hpp>
-#include <SLib/String/StringType.hpp>
+#include <SLib/String/StringBuilder.hpp>
 
 namespace slib {
 
+namespace details {
+struct StacktraceRecord;
+} // namespace details
+
 // clang-format off
 class Exception : public std::exception
 {
 public:
     Exception() noexcept = default;
-    Exception(const Exception& other) noexcept : exception(other) { _pWhat = other._pWhat; }
+    Exception(const Exception& other) noexcept : exception(other) { _pWhat = other._pWhat; _pTrace = other._pTrace; }
     explicit Exception(StringView what) : _pWhat(std::make_shared<String>(what)) { }
+    Exception(StringView what, std::shared_ptr<details::StacktraceRecord> trace) : _pWhat(std::make_shared<String>(what)), _pTrace(std::move(trace)) { }
     ~Exception() override = default;
 
     Exception& operator=(const Exception&) = delete;
-    SLIB_NODISCARD const char* what() const noexcept override { return _pWhat ? _pWhat->c_str() : ""; }
+
+    /// 消息与抛出点的调用栈. 调用栈在第一次调用时才符号化.
+    SLIB_NODISCARD const char* what() const noexcept override;
+
+    /// 不含调用栈的消息.
+    SLIB_NODISCARD const char* message() const noexcept { return _pWhat ? _pWhat->c_str() : ""; }
 
 protected:
     std::shared_ptr<String> _pWhat;
+    std::shared_ptr<details::StacktraceRecord> _pTrace;
 };
 
 class RuntimeError : public Exception
@@ -43,6 +54,7 @@ public:
     RuntimeError() noexcept = default;
     RuntimeError(const RuntimeError& other) noexcept : Exception(other) { _pWhat = other._pWhat; }
     explicit RuntimeError(StringView what) : Exception(what) { }
+    RuntimeError(StringView what, std::shared_ptr<details::StacktraceRecord> trace) : Exception(what, std::move(trace)) { }
 
     ~RuntimeError() override = default;
 };
@@ -53,6 +65,7 @@ public:
     AssertionError() noexcept = default;
     AssertionError(const AssertionError& other) noexcept : Exception(other) { _pWhat = other._pWhat; }
     explicit AssertionError(StringView what) : Exception(what) { }
+    AssertionError(StringView what, std::shared_ptr<details::StacktraceRecord> trace) : Exception(what, std::move(trace)) { }
 
     ~AssertionError() override = default;
 };
@@ -71,7 +84,9 @@ SLIB_NORETURN inline void ThrowException(const std::source_location& loc, String
 template<typename... Args>
 SLIB_NORETURN inline void ThrowException(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
 {
-    ::slib::ThrowException(loc, std::format(fmt, std::forward<Args>(args)...));
+    StringBuilder msg;
+    msg.format(fmt, std::forward<Args>(args)...);
+    ::slib::ThrowException(loc, msg.view());
 }
 
 SLIB_NORETURN inline void ReportAssertion(const std::source_location& loc, StringView cond)
@@ -87,7 +102,9 @@ SLIB_NORETURN inline void ReportAssertion(const std::source_location& loc, Strin
 template<typename... Args>
 SLIB_NORETURN inline void ReportAssertion(const std::source_location& loc, StringView cond, std::format_string<Args...> fmt, Args&&... args)
 {
-    ::slib::ReportAssertion(loc, cond, std::format(fmt, std::forward<Args>(args)...));
+    StringBuilder msg;
+    msg.format(fmt, std::forward<Args>(args)...);
+    ::slib::ReportAssertion(loc, cond, msg.view());
 }
 } // namespace details
 
@@ -172,14 +189,6 @@ SLIB_NORETURN inline void CustomTerminateHandler()
 
     SLIB_THROW("Exiting without exception.");
 }
-
-SLIB_NORETURN inline void SignalHandler(int signal)
-{
-    if (signal == SIGABRT)
-        SLIB_THROW("'SIGABRT' received!");
-
-    SLIB_THROW("Unexpected signal '{}' received!", signal);
-}
 } // namespace details
 
 // ==================
@@ -192,7 +201,10 @@ inline bool Guardian(F callback, Args&&... args)
 {
     static_assert(std::is_invocable_v<F, Args...>);
     std::set_terminate(details::CustomTerminateHandler);
-    std::signal(SIGABRT, details::SignalHandler);
+    // 信号处理中不能抛出异常，致命信号交由 CrashHandler 写出转储后终止进程
+    if (!CrashHandler::IsInstalled())
+        (void)CrashHandler::Install();
+    CrashHandler::PrepareThread();
 
     bool bResult = false;
     try {
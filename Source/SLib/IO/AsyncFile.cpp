@@ -0,0 +1,654 @@
+﻿/**
+ * @File AsyncFile.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "AsyncFile.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <SLib/Concurrency/ThreadPool.hpp>
+#include <SLib/Math/Common.hpp>
+
+#if defined(SLIB_IN_LINUX) || defined(SLIB_IN_MAC)
+#  define SLIB_ASYNC_FILE_POSIX 1
+#  include <fcntl.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  if defined(SLIB_IN_LINUX) && __has_include(<linux/io_uring.h>)
+#    define SLIB_ASYNC_FILE_IO_URING 1
+#    include <linux/io_uring.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <sys/uio.h>
+#  else
+#    define SLIB_ASYNC_FILE_IO_URING 0
+#  endif
+#else
+#  define SLIB_ASYNC_FILE_POSIX 0
+#  define SLIB_ASYNC_FILE_IO_URING 0
+#endif
+
+using namespace slib;
+using namespace slib::detail;
+
+namespace {
+
+/// 单个请求最多传输的字节数，与 Linux 每次读写的上限相同.
+constexpr Size kMaxTransfer = 0x7FFFF000;
+
+#if SLIB_ASYNC_FILE_IO_URING
+
+/// 关闭时用于唤醒收割线程的 NOP 请求.
+constexpr u64 kWakeTag = ~u64(0);
+
+/**
+ * io_uring 的最小封装，直接使用系统调用与共享内存环，不依赖 liburing. 提交队列由调用方加锁保护，
+ * 完成队列只由收割线程消费.
+ */
+class IoUring
+{
+public:
+    IoUring() = default;
+
+    ~IoUring() { close(); }
+
+    IoUring(const IoUring&)            = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    /**
+     * @brief 创建至少 entries 项的环. 失败时返回错误码 (errno).
+     */
+    int open(u32 entries)
+    {
+        io_uring_params params{};
+        _fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (_fd < 0)
+            return errno;
+        // IORING_OP_READ / WRITE 需要 5.6 及以上的内核，RW_CUR_POS 与它们同时引入
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+            close();
+            return ENOSYS;
+        }
+
+        _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        const bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single)
+            _sqRingSize = _cqRingSize = Max(_sqRingSize, _cqRingSize);
+
+        _sqeMapSize = params.sq_entries * sizeof(io_uring_sqe);
+        _sqRing     = Map(_sqRingSize, IORING_OFF_SQ_RING);
+        _cqRing     = single ? _sqRing : Map(_cqRingSize, IORING_OFF_CQ_RING);
+        _sqes       = static_cast<io_uring_sqe*>(Map(_sqeMapSize, IORING_OFF_SQES));
+        if (!_sqRing || !_cqRing || !_sqes) {
+            const int error = errno;
+            close();
+            return error;
+        }
+
+        auto* sq = static_cast<char*>(_sqRing);
+        auto* cq = static_cast<char*>(_cqRing);
+        _sqTail  = reinterpret_cast<u32*>(sq + params.sq_off.tail);
+        _sqMask  = *reinterpret_cast<u32*>(sq + params.sq_off.ring_mask);
+        _sqArray = reinterpret_cast<u32*>(sq + params.sq_off.array);
+        _cqHead  = reinterpret_cast<u32*>(cq + params.cq_off.head);
+        _cqTail  = reinterpret_cast<u32*>(cq + params.cq_off.tail);
+        _cqMask  = *reinterpret_cast<u32*>(cq + params.cq_off.ring_mask);
+        _cqes    = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return 0;
+    }
+
+    void close()
+    {
+        if (_sqes)
+            ::munmap(_sqes, _sqeMapSize);
+        if (_cqRing && _cqRing != _sqRing)
+            ::munmap(_cqRing, _cqRingSize);
+        if (_sqRing)
+            ::munmap(_sqRing, _sqRingSize);
+        if (_fd >= 0)
+            ::close(_fd);
+        _sqes   = nullptr;
+        _sqRing = _cqRing = nullptr;
+        _fd     = -1;
+    }
+
+    SLIB_NODISCARD int fd() const { return _fd; }
+
+    /**
+     * @brief 取得下一个提交项并清零. 调用方保证在途请求数不超过容量.
+     */
+    io_uring_sqe* next()
+    {
+        const u32 index   = _localTail++ & _sqMask;
+        io_uring_sqe* sqe = &_sqes[index];
+        _sqArray[index]   = index;
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        return sqe;
+    }
+
+    /**
+     * @brief 发布已填写的提交项并交给内核，返回仍未被内核接收的项数.
+     */
+    u32 submit()
+    {
+        std::atomic_ref(*_sqTail).store(_localTail, std::memory_order_release);
+        while (_localTail != _submitted) {
+            const long n = ::syscall(__NR_io_uring_enter, _fd, _localTail - _submitted, 0, 0, nullptr, 0);
+            if (n < 0) {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+            _submitted += static_cast<u32>(n);
+        }
+        return _localTail - _submitted;
+    }
+
+    /**
+     * @brief 阻塞直到至少有一个完成项.
+     */
+    void waitCompletion() const
+    {
+        if (std::atomic_ref(*_cqTail).load(std::memory_order_acquire) != *_cqHead)
+            return;
+        ::syscall(__NR_io_uring_enter, _fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+    }
+
+    /**
+     * @brief 逐个取出完成项，先归还环上的位置再调用 f(userData, res)，f 中可以继续提交.
+     */
+    template<typename F>
+    void reap(F&& f)
+    {
+        u32 head = *_cqHead;
+        while (head != std::atomic_ref(*_cqTail).load(std::memory_order_acquire)) {
+            const io_uring_cqe cqe = _cqes[head & _cqMask];
+            std::atomic_ref(*_cqHead).store(++head, std::memory_order_release);
+            f(cqe.user_data, cqe.res);
+        }
+    }
+
+private:
+    void* Map(Size size, u64 offset) const
+    {
+        void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, static_cast<off_t>(offset));
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    int _fd             = -1;
+    void* _sqRing       = nullptr;
+    void* _cqRing       = nullptr;
+    io_uring_sqe* _sqes = nullptr;
+    Size _sqRingSize    = 0;
+    Size _cqRingSize    = 0;
+    Size _sqeMapSize    = 0;
+
+    u32* _sqTail        = nullptr;
+    u32* _sqArray       = nullptr;
+    u32 _sqMask         = 0;
+    u32 _localTail      = 0; ///< 已填写的提交项
+    u32 _submitted      = 0; ///< 已被内核接收的提交项
+    u32* _cqHead        = nullptr;
+    u32* _cqTail        = nullptr;
+    u32 _cqMask         = 0;
+    io_uring_cqe* _cqes = nullptr;
+};
+
+#endif
+
+struct AsyncRequest
+{
+    AsyncIoOp op = AsyncIoOp::Read;
+    u64 offset   = 0;
+    char* data   = nullptr;
+    Size length  = 0;
+    AsyncIoCallback callback;
+};
+
+} // namespace
+
+struct slib::detail::AsyncFileState
+{
+    int fd                 = -1;
+    AsyncIoBackend backend = AsyncIoBackend::ThreadPool;
+    u32 queueDepth         = 0;
+    ThreadPool* pool       = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable idle;
+    std::deque<AsyncRequest> queued; ///< 尚未交给内核或线程池的请求
+    std::vector<AsyncRequest> slots; ///< 在途请求，下标即请求的标识
+    std::vector<u32> freeSlots;
+    Size pending = 0; ///< 排队、在途或回调尚未返回的请求数
+
+    std::unique_ptr<Opt<TaskHandle>[]> tasks; ///< 线程池后端: 每个槽位一个任务
+
+#if SLIB_ASYNC_FILE_IO_URING
+    IoUring ring;
+    std::thread reaper;
+    std::vector<std::span<char>> buffers; ///< 已注册的固定缓冲区
+#endif
+};
+
+namespace {
+
+#if SLIB_ASYNC_FILE_POSIX
+
+Result<Size> ErrnoResult(int error)
+{
+    return Unexpected(FailureType::IOError, "{}", std::strerror(error));
+}
+
+/**
+ * @brief 请求完成: 归还槽位并补充提交排队的请求，在锁外执行回调.
+ */
+void Complete(AsyncFileState& state, u32 slot, Result<Size> result);
+
+void FlushLocked(AsyncFileState& state);
+
+/**
+ * @brief 线程池后端: 在工作线程上执行阻塞读写. 读写循环到完成、文件末尾或出错为止.
+ */
+void RunBlocking(AsyncFileState& state, u32 slot)
+{
+    const AsyncRequest& request = state.slots[slot];
+    Result<Size> result         = Size(0);
+    Size done                   = 0;
+
+    if (request.op == AsyncIoOp::Read || request.op == AsyncIoOp::Write) {
+        while (done < request.length) {
+            const auto offset = static_cast<off_t>(request.offset + done);
+            const ssize_t n   = request.op == AsyncIoOp::Read ? ::pread(state.fd, request.data + done, request.length - done, offset)
+                                                              : ::pwrite(state.fd, request.data + done, request.length - done, offset);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0) {
+                if (n < 0)
+                    result = ErrnoResult(errno);
+                break;
+            }
+            done += static_cast<Size>(n);
+        }
+        if (result)
+            result = done;
+    }
+    else {
+#  if defined(SLIB_IN_LINUX)
+        const int rc = request.op == AsyncIoOp::Fdatasync ? ::fdatasync(state.fd) : ::fsync(state.fd);
+#  else
+        const int rc = ::fsync(state.fd);
+#  endif
+        if (rc != 0)
+            result = ErrnoResult(errno);
+    }
+    Complete(state, slot, std::move(result));
+}
+
+#  if SLIB_ASYNC_FILE_IO_URING
+
+/**
+ * @brief 完全落在某个注册缓冲区内时返回其下标，否则返回 -1.
+ */
+int FindRegisteredBuffer(const AsyncFileState& state, const char* data, Size length)
+{
+    for (Size i = 0; i < state.buffers.size(); ++i) {
+        const auto& buffer = state.buffers[i];
+        if (data >= buffer.data() && data + length <= buffer.data() + buffer.size())
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void PrepareSqe(AsyncFileState& state, u32 slot)
+{
+    const AsyncRequest& request = state.slots[slot];
+    io_uring_sqe* sqe           = state.ring.next();
+    sqe->fd                     = state.fd;
+    sqe->user_data              = slot;
+
+    if (request.op == AsyncIoOp::Fsync || request.op == AsyncIoOp::Fdatasync) {
+        sqe->opcode      = IORING_OP_FSYNC;
+        sqe->fsync_flags = request.op == AsyncIoOp::Fdatasync ? IORING_FSYNC_DATASYNC : 0;
+        return;
+    }
+
+    const bool read = request.op == AsyncIoOp::Read;
+    sqe->opcode     = read ? IORING_OP_READ : IORING_OP_WRITE;
+    sqe->off        = request.offset;
+    sqe->addr       = reinterpret_cast<u64>(request.data);
+    sqe->len        = static_cast<u32>(request.length);
+    if (const int index = FindRegisteredBuffer(state, request.data, request.length); index >= 0) {
+        sqe->opcode    = read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+        sqe->buf_index = static_cast<u16>(index);
+    }
+}
+
+/**
+ * @brief 收割线程: 等待完成项并分发，收到唤醒标记时退出.
+ */
+void ReaperLoop(AsyncFileState& state)
+{
+    bool stop = false;
+    while (!stop) {
+        state.ring.waitCompletion();
+        state.ring.reap([&](u64 tag, i32 res) {
+            if (tag == kWakeTag)
+                stop = true;
+            else
+                Complete(state, static_cast<u32>(tag), res < 0 ? ErrnoResult(-res) : Result<Size>(static_cast<Size>(res)));
+        });
+    }
+}
+
+#  endif
+
+/**
+ * @brief 把排队的请求移入空闲槽位并一次性交给内核或线程池. 调用方持有 mutex.
+ */
+void FlushLocked(AsyncFileState& state)
+{
+    u32 count = 0;
+    while (!state.queued.empty() && !state.freeSlots.empty()) {
+        const u32 slot = state.freeSlots.back();
+        state.freeSlots.pop_back();
+        state.slots[slot] = std::move(state.queued.front());
+        state.queued.pop_front();
+
+#  if SLIB_ASYNC_FILE_IO_URING
+        if (state.backend == AsyncIoBackend::IoUring) {
+            PrepareSqe(state, slot);
+            ++count;
+            continue;
+        }
+#  endif
+        // 工作线程在执行前取走任务函数，槽位上的句柄可以在下一个请求时重新构造
+        auto& task = state.tasks[slot];
+        task.emplace([&state, slot] { RunBlocking(state, slot); });
+        state.pool->post(*task);
+        ++count;
+    }
+
+#  if SLIB_ASYNC_FILE_IO_URING
+    if (count && state.backend == AsyncIoBackend::IoUring)
+        state.ring.submit();
+#  endif
+}
+
+void Complete(AsyncFileState& state, u32 slot, Result<Size> result)
+{
+    AsyncIoCallback callback;
+    {
+        std::lock_guard lock(state.mutex);
+        callback = std::move(state.slots[slot].callback);
+        state.freeSlots.push_back(slot);
+        FlushLocked(state);
+    }
+
+    if (callback)
+        callback(std::move(result));
+
+    std::lock_guard lock(state.mutex);
+    if (--state.pending == 0)
+        state.idle.notify_all();
+}
+
+#endif
+
+} // namespace
+
+void AsyncIoAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    // 请求可能在返回前就已完成并恢复协程，此后不能再访问 this
+    _file->enqueue(_op, _offset, _data, _length,
+                   [this, handle](Result<Size> result) {
+                       _result = std::move(result);
+                       handle.resume();
+                   },
+                   true);
+}
+
+AsyncFile::AsyncFile() = default;
+
+AsyncFile::~AsyncFile()
+{
+    close();
+}
+
+AsyncFile::AsyncFile(AsyncFile&& other) noexcept : _state(std::move(other._state)) {}
+
+AsyncFile& AsyncFile::operator=(AsyncFile&& other) noexcept
+{
+    if (this != &other) {
+        close();
+        _state = std::move(other._state);
+    }
+    return *this;
+}
+
+Result<AsyncFile> AsyncFile::Open(StringView path, const AsyncFileOptions& options)
+{
+#if SLIB_ASYNC_FILE_POSIX
+    int flags = O_CLOEXEC;
+    if (options.mode == FileMode::Read)
+        flags |= O_RDONLY;
+    else if (options.mode == FileMode::Write)
+        flags |= O_WRONLY | O_CREAT | O_TRUNC;
+    else
+        flags |= O_RDWR | O_CREAT;
+#  if defined(O_DIRECT)
+    if (options.direct)
+        flags |= O_DIRECT;
+#  endif
+
+    const String name(path);
+    const int fd = ::open(name.c_str(), flags, 0644);
+    if (fd < 0) {
+        const int error = errno;
+        return Unexpected(error == ENOENT ? FailureType::NotFound : FailureType::IOError, "Cannot open '{}': {}", name, std::strerror(error));
+    }
+#  if !defined(O_DIRECT) && defined(F_NOCACHE)
+    if (options.direct)
+        ::fcntl(fd, F_NOCACHE, 1);
+#  endif
+
+    auto state        = MakeUnique<AsyncFileState>();
+    state->fd         = fd;
+    state->queueDepth = Max<u32>(options.queueDepth, 1);
+    state->pool       = options.pool ? options.pool : &ThreadPool::Global();
+    state->slots.resize(state->queueDepth);
+    for (u32 i = state->queueDepth; i > 0; --i)
+        state->freeSlots.push_back(i - 1);
+
+#  if SLIB_ASYNC_FILE_IO_URING
+    if (options.backend != AsyncIoBackend::ThreadPool) {
+        if (const int error = state->ring.open(state->queueDepth); error == 0) {
+            state->backend = AsyncIoBackend::IoUring;
+            state->reaper  = std::thread(ReaperLoop, std::ref(*state));
+        }
+        else if (options.backend == AsyncIoBackend::IoUring) {
+            ::close(fd);
+            return Unexpected(FailureType::Unsupported, "io_uring is not available: {}", std::strerror(error));
+        }
+    }
+#  else
+    if (options.backend == AsyncIoBackend::IoUring) {
+        ::close(fd);
+        return Unexpected(FailureType::Unsupported, "io_uring is not available on this platform");
+    }
+#  endif
+    if (state->backend == AsyncIoBackend::ThreadPool)
+        state->tasks = std::make_unique<Opt<TaskHandle>[]>(state->queueDepth);
+
+    AsyncFile file;
+    file._state = std::move(state);
+    return file;
+#else
+    (void)path;
+    (void)options;
+    return Unexpected(FailureType::Unsupported, "AsyncFile is not supported on this platform");
+#endif
+}
+
+AsyncIoBackend AsyncFile::backend() const
+{
+    return _state ? _state->backend : AsyncIoBackend::Auto;
+}
+
+Result<u64> AsyncFile::size() const
+{
+#if SLIB_ASYNC_FILE_POSIX
+    if (!_state)
+        return Unexpected(FailureType::IOError, "File is not open");
+    struct stat info{};
+    if (::fstat(_state->fd, &info) != 0)
+        return Unexpected(FailureType::IOError, "{}", std::strerror(errno));
+    return static_cast<u64>(info.st_size);
+#else
+    return Unexpected(FailureType::Unsupported, "AsyncFile is not supported on this platform");
+#endif
+}
+
+void AsyncFile::read(u64 offset, std::span<char> buffer, AsyncIoCallback callback)
+{
+    enqueue(AsyncIoOp::Read, offset, buffer.data(), buffer.size(), std::move(callback));
+}
+
+void AsyncFile::write(u64 offset, std::span<const char> data, AsyncIoCallback callback)
+{
+    enqueue(AsyncIoOp::Write, offset, const_cast<char*>(data.data()), data.size(), std::move(callback));
+}
+
+void AsyncFile::fsync(AsyncIoCallback callback, bool dataOnly)
+{
+    enqueue(dataOnly ? AsyncIoOp::Fdatasync : AsyncIoOp::Fsync, 0, nullptr, 0, std::move(callback));
+}
+
+void AsyncFile::enqueue(AsyncIoOp op, u64 offset, char* data, Size length, AsyncIoCallback callback, bool submitNow)
+{
+#if SLIB_ASYNC_FILE_POSIX
+    if (_state) {
+        auto& state = *_state;
+        std::lock_guard lock(state.mutex);
+        state.queued.push_back({op, offset, data, Min(length, kMaxTransfer), std::move(callback)});
+        ++state.pending;
+        if (submitNow || state.queued.size() >= state.queueDepth)
+            FlushLocked(state);
+        return;
+    }
+#else
+    (void)op;
+    (void)offset;
+    (void)data;
+    (void)length;
+#endif
+    if (callback)
+        callback(Unexpected(FailureType::IOError, "File is not open"));
+}
+
+u32 AsyncFile::submit()
+{
+#if SLIB_ASYNC_FILE_POSIX
+    if (!_state)
+        return 0;
+    std::lock_guard lock(_state->mutex);
+    const Size queued = _state->queued.size();
+    FlushLocked(*_state);
+    return static_cast<u32>(queued - _state->queued.size());
+#else
+    return 0;
+#endif
+}
+
+void AsyncFile::drain()
+{
+#if SLIB_ASYNC_FILE_POSIX
+    if (!_state)
+        return;
+    submit();
+    std::unique_lock lock(_state->mutex);
+    _state->idle.wait(lock, [&] { return _state->pending == 0; });
+#endif
+}
+
+Size AsyncFile::pending() const
+{
+    if (!_state)
+        return 0;
+    std::lock_guard lock(_state->mutex);
+    return _state->pending;
+}
+
+Result<void> AsyncFile::registerBuffers(std::span<const std::span<char>> buffers)
+{
+    if (!_state)
+        return Unexpected(FailureType::IOError, "File is not open");
+#if SLIB_ASYNC_FILE_IO_URING
+    if (_state->backend != AsyncIoBackend::IoUring)
+        return {};
+
+    unregisterBuffers();
+    std::vector<iovec> iov;
+    iov.reserve(buffers.size());
+    for (const auto& buffer : buffers)
+        iov.push_back({buffer.data(), buffer.size()});
+
+    std::lock_guard lock(_state->mutex);
+    const long rc = ::syscall(__NR_io_uring_register, _state->ring.fd(), IORING_REGISTER_BUFFERS, iov.data(), static_cast<u32>(iov.size()));
+    if (rc < 0) {
+        const int error = errno;
+        return Unexpected(error == ENOMEM ? FailureType::OutOfMemory : FailureType::IOError, "Cannot register buffers: {}", std::strerror(error));
+    }
+    _state->buffers.assign(buffers.begin(), buffers.end());
+#else
+    (void)buffers;
+#endif
+    return {};
+}
+
+void AsyncFile::unregisterBuffers()
+{
+#if SLIB_ASYNC_FILE_IO_URING
+    if (!_state || _state->buffers.empty())
+        return;
+    std::lock_guard lock(_state->mutex);
+    ::syscall(__NR_io_uring_register, _state->ring.fd(), IORING_UNREGISTER_BUFFERS, nullptr, 0);
+    _state->buffers.clear();
+#endif
+}
+
+void AsyncFile::close()
+{
+#if SLIB_ASYNC_FILE_POSIX
+    if (!_state)
+        return;
+    drain();
+
+#  if SLIB_ASYNC_FILE_IO_URING
+    if (_state->backend == AsyncIoBackend::IoUring) {
+        {
+            std::lock_guard lock(_state->mutex);
+            io_uring_sqe* sqe = _state->ring.next();
+            sqe->opcode       = IORING_OP_NOP;
+            sqe->user_data    = kWakeTag;
+            _state->ring.submit();
+        }
+        _state->reaper.join();
+        _state->ring.close();
+    }
+#  endif
+    ::close(_state->fd);
+    _state.reset();
+#endif
+}
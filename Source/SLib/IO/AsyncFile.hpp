@@ -0,0 +1,189 @@
+﻿/**
+ * @File AsyncFile.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <span>
+
+#include <SLib/Memory/Memory.hpp>
+#include <SLib/Utility/InlineFunction.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+class ThreadPool;
+
+enum class AsyncIoBackend : u8
+{
+    Auto,       ///< 内核支持时使用 io_uring，否则回退到线程池
+    IoUring,    ///< 只用 io_uring，不可用时 Open 返回 Unsupported
+    ThreadPool, ///< 在线程池中执行阻塞的 pread / pwrite
+};
+
+enum class FileMode : u8
+{
+    Read,      ///< 只读，文件必须存在
+    Write,     ///< 只写，不存在时创建，已存在时清空
+    ReadWrite, ///< 读写，不存在时创建
+};
+
+struct AsyncFileOptions
+{
+    FileMode mode          = FileMode::Read;
+    AsyncIoBackend backend = AsyncIoBackend::Auto;
+    u32 queueDepth         = 64;      ///< 同时在途的请求数上限，也是 io_uring 提交队列的长度
+    bool direct            = false;   ///< O_DIRECT 绕过页缓存，缓冲区、偏移与长度都必须按扇区对齐
+    ThreadPool* pool       = nullptr; ///< 回退实现所用的线程池，为空时使用 ThreadPool::Global()
+};
+
+/// 完成回调，参数为实际传输的字节数 (读到文件末尾时可能少于请求的长度) 或错误.
+using AsyncIoCallback = InlineFunction<void(Result<Size>), 48>;
+
+class AsyncFile;
+
+namespace detail {
+
+struct AsyncFileState;
+
+enum class AsyncIoOp : u8
+{
+    Read,
+    Write,
+    Fsync,
+    Fdatasync,
+};
+
+} // namespace detail
+
+/**
+ * co_await 一个读写请求，结果为 Result<Size>. 请求在挂起时立即提交，协程在完成线程上恢复.
+ */
+class AsyncIoAwaiter
+{
+public:
+    AsyncIoAwaiter(AsyncFile& file, detail::AsyncIoOp op, u64 offset, char* data, Size length)
+        : _file(&file), _data(data), _length(length), _offset(offset), _op(op)
+    {
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle);
+
+    Result<Size> await_resume() { return std::move(_result); }
+
+private:
+    AsyncFile* _file;
+    char* _data;
+    Size _length;
+    u64 _offset;
+    detail::AsyncIoOp _op;
+    Result<Size> _result;
+};
+
+/**
+ * 异步文件读写. 请求先在用户态排队，submit 时一次性交给内核 (io_uring 后端只需一次 io_uring_enter)，排队的请求达到
+ * queueDepth 时自动提交; 在途请求达到上限后新的请求继续排队，在有请求完成时补充提交，使存储设备的队列保持饱满.
+ *
+ * 完成回调在内部的完成线程上执行 (io_uring 后端为专用的收割线程，线程池后端为工作线程)，回调中可以继续提交请求，
+ * 但不要阻塞或调用 drain. 任意线程都可以提交请求. 同一区间上未完成的读写之间没有顺序保证，需要顺序时等待前一个
+ * 请求完成 (例如 write 之后的 fsync).
+ */
+class AsyncFile
+{
+public:
+    AsyncFile();
+    ~AsyncFile();
+
+    AsyncFile(AsyncFile&& other) noexcept;
+    AsyncFile& operator=(AsyncFile&& other) noexcept;
+
+    AsyncFile(const AsyncFile&)            = delete;
+    AsyncFile& operator=(const AsyncFile&) = delete;
+
+    SLIB_NODISCARD static Result<AsyncFile> Open(StringView path, const AsyncFileOptions& options = {});
+
+    SLIB_NODISCARD bool isOpen() const { return _state != nullptr; }
+
+    /**
+     * @brief 实际使用的后端: IoUring 或 ThreadPool.
+     */
+    SLIB_NODISCARD AsyncIoBackend backend() const;
+
+    SLIB_NODISCARD Result<u64> size() const;
+
+    /**
+     * @brief 排队一个读请求: 从 offset 读至多 buffer.size() 字节. 缓冲区在回调执行前必须保持有效.
+     */
+    void read(u64 offset, std::span<char> buffer, AsyncIoCallback callback);
+
+    /**
+     * @brief 排队一个写请求. 数据在回调执行前必须保持有效.
+     */
+    void write(u64 offset, std::span<const char> data, AsyncIoCallback callback);
+
+    /**
+     * @brief 排队一个 fsync (dataOnly 时为 fdatasync). 只保证在它之前已经完成的写入落盘.
+     */
+    void fsync(AsyncIoCallback callback, bool dataOnly = false);
+
+    /**
+     * @brief 提交所有排队的请求 (受在途上限约束)，返回本次交给内核或线程池的请求数.
+     */
+    u32 submit();
+
+    /**
+     * @brief 提交并等待所有请求完成、回调返回. 不要在完成回调中调用.
+     */
+    void drain();
+
+    /**
+     * @brief 已排队或在途、回调尚未返回的请求数.
+     */
+    SLIB_NODISCARD Size pending() const;
+
+    /**
+     * @brief 注册固定缓冲区 (IORING_REGISTER_BUFFERS)，之后完全落在某个注册缓冲区内的读写使用 READ_FIXED /
+     *        WRITE_FIXED，内核不必为每个请求固定与解除固定页面. 需在没有在途请求时调用; 线程池后端直接返回成功.
+     */
+    Result<void> registerBuffers(std::span<const std::span<char>> buffers);
+
+    void unregisterBuffers();
+
+    SLIB_NODISCARD AsyncIoAwaiter readAsync(u64 offset, std::span<char> buffer)
+    {
+        return {*this, detail::AsyncIoOp::Read, offset, buffer.data(), buffer.size()};
+    }
+
+    SLIB_NODISCARD AsyncIoAwaiter writeAsync(u64 offset, std::span<const char> data)
+    {
+        return {*this, detail::AsyncIoOp::Write, offset, const_cast<char*>(data.data()), data.size()};
+    }
+
+    SLIB_NODISCARD AsyncIoAwaiter fsyncAsync(bool dataOnly = false)
+    {
+        return {*this, dataOnly ? detail::AsyncIoOp::Fdatasync : detail::AsyncIoOp::Fsync, 0, nullptr, 0};
+    }
+
+    /**
+     * @brief 等待所有请求完成后关闭文件.
+     */
+    void close();
+
+private:
+    friend class AsyncIoAwaiter;
+
+    /**
+     * @brief 排队一个请求，submitNow 时在同一临界区内提交，之后不再访问调用方的任何状态.
+     */
+    void enqueue(detail::AsyncIoOp op, u64 offset, char* data, Size length, AsyncIoCallback callback, bool submitNow = false);
+
+    UniquePtr<detail::AsyncFileState> _state;
+};
+
+} // namespace slib
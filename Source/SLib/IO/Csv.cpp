@@ -0,0 +1,199 @@
+﻿/**
+ * @File Csv.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Csv.hpp"
+
+#include <bit>
+#include <cstring>
+
+#include <SLib/Concurrency/ThreadPool.hpp>
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+
+using namespace slib;
+
+namespace {
+
+/// 小于这个长度的段不值得单独解析.
+constexpr Size kMinChunkSize = Size(64) << 10;
+
+/**
+ * @brief 从 pos 开始查找第一个不在引号内的换行，返回其后的偏移; 没有时返回 text.size().
+ */
+Size NextRecord(StringView text, Size pos, bool inQuote, const CsvOptions& options)
+{
+    const char* p = text.data();
+    const Size n  = text.size();
+    if (!options.quotedNewlines) {
+        const void* found = pos < n ? std::memchr(p + pos, '\n', n - pos) : nullptr;
+        return found ? static_cast<Size>(static_cast<const char*>(found) - p) + 1 : n;
+    }
+    for (; pos < n; ++pos) {
+        if (p[pos] == options.quote)
+            inQuote = !inQuote;
+        else if (p[pos] == '\n' && !inQuote)
+            return pos + 1;
+    }
+    return n;
+}
+
+} // namespace
+
+CsvReader::CsvReader(StringView text, const CsvOptions& options) : _text(text), _options(options)
+{
+    _quotes.add(options.quote);
+    _separators.add(options.delimiter).add('\n');
+}
+
+bool CsvReader::loadBlock()
+{
+    if (_next >= _text.size())
+        return false;
+
+    const char* p    = _text.data() + _next;
+    const Size valid = _text.size() - _next;
+    const u64 quotes = detail::ClassifyBlock(p, valid, _quotes);
+    const u64 inside = PrefixXor(quotes) ^ _inQuote;
+    _quoteBase      += static_cast<Size>(Popcount(_quoteMask));
+    _quoteMask       = quotes;
+    _structurals     = detail::ClassifyBlock(p, valid, _separators) & ~inside;
+    _inQuote         = static_cast<u64>(static_cast<i64>(inside) >> 63);
+    _block           = _next;
+    _next           += 64;
+    return true;
+}
+
+Result<void> CsvReader::addField(Size end, Size quotes, bool lastInRecord)
+{
+    const char* p = _text.data();
+    Size begin    = _fieldStart;
+    if (lastInRecord && end > begin && p[end - 1] == '\r')
+        --end;
+
+    if (SLIB_UNLIKELY(quotes != _fieldQuotes)) {
+        // 带引号的字段: 首尾是引号，中间的引号必须成对出现
+        const char quote = _options.quote;
+        if (p[begin] != quote || end - begin < 2 || p[end - 1] != quote)
+            return Unexpected(FailureType::ParseError, "Unexpected quote in CSV field at offset {}", begin);
+        for (Size i = begin + 1; i + 1 < end; ++i) {
+            if (p[i] != quote)
+                continue;
+            if (i + 2 >= end || p[i + 1] != quote)
+                return Unexpected(FailureType::ParseError, "Unescaped quote in CSV field at offset {}", i);
+            ++i;
+        }
+        ++begin;
+        --end;
+    }
+    _fields.emplace_back(p + begin, end - begin);
+    return {};
+}
+
+Result<bool> CsvReader::next()
+{
+    _fields.clear();
+    _recordStart = _fieldStart;
+
+    for (;;) {
+        while (_structurals == 0) {
+            if (loadBlock())
+                continue;
+
+            // 文本结束: 最后一条记录可以没有换行
+            if (SLIB_UNLIKELY(_inQuote))
+                return Unexpected(FailureType::ParseError, "Unterminated quoted CSV field at offset {}", _fieldStart);
+            if (_fields.empty() && _fieldStart >= _text.size())
+                return false;
+
+            const Size quotes = _quoteBase + static_cast<Size>(Popcount(_quoteMask));
+            SLIB_TRY(addField(_text.size(), quotes, true));
+            _fieldStart = _text.size();
+            if (_options.skipEmptyLines && _fields.size() == 1 && _fields[0].empty()) {
+                _fields.clear();
+                return false;
+            }
+            return true;
+        }
+
+        const u64 bit      = _structurals & (~_structurals + 1);
+        const Size end     = _block + static_cast<Size>(std::countr_zero(_structurals));
+        const Size quotes  = _quoteBase + static_cast<Size>(Popcount(_quoteMask & (bit - 1)));
+        const bool newline = _text[end] == '\n';
+        _structurals      &= _structurals - 1;
+
+        SLIB_TRY(addField(end, quotes, newline));
+        _fieldStart  = end + 1;
+        _fieldQuotes = quotes;
+
+        if (!newline)
+            continue;
+        if (_options.skipEmptyLines && _fields.size() == 1 && _fields[0].empty()) {
+            _fields.clear();
+            _recordStart = _fieldStart;
+            continue;
+        }
+        return true;
+    }
+}
+
+StringView slib::CsvUnescape(StringView field, String& buffer, char quote)
+{
+    const void* found = field.empty() ? nullptr : std::memchr(field.data(), quote, field.size());
+    if (!found)
+        return field;
+
+    buffer.clear();
+    const char* p = field.data();
+    const Size n  = field.size();
+    for (Size i = 0; i < n; ++i) {
+        buffer.push_back(p[i]);
+        if (p[i] == quote && i + 1 < n && p[i + 1] == quote)
+            ++i;
+    }
+    return buffer;
+}
+
+std::vector<StringView> slib::SplitCsv(StringView text, Size parts, const CsvOptions& options)
+{
+    const Size size = text.size();
+    parts           = Max<Size>(Min(parts, size / kMinChunkSize), 1);
+
+    std::vector<StringView> chunks;
+    if (parts == 1) {
+        if (size)
+            chunks.push_back(text);
+        return chunks;
+    }
+
+    // 切分点 i * step 是否位于引号内，由之前所有段的引号数的奇偶决定
+    const Size step = (size + parts - 1) / parts;
+    std::vector<u8> inQuote(parts, 0);
+    if (options.quotedNewlines) {
+        std::vector<Size> counts(parts);
+        const CharSet quotes(StringView(&options.quote, 1));
+        ParallelFor(0, parts, [&](Size i) {
+            const Size begin = Min(i * step, size);
+            counts[i]        = CountOf(StringView(text.data() + begin, Min(step, size - begin)), quotes);
+        });
+        for (Size i = 1; i < parts; ++i)
+            inQuote[i] = static_cast<u8>(inQuote[i - 1] ^ (counts[i - 1] & 1));
+    }
+
+    Size begin = 0;
+    for (Size i = 1; i < parts && begin < size; ++i) {
+        // 上一段的最后一条记录跨过了这个切分点
+        const Size cut = i * step;
+        if (cut < begin)
+            continue;
+        const Size split = NextRecord(text, cut, inQuote[i], options);
+        chunks.emplace_back(text.data() + begin, split - begin);
+        begin = split;
+    }
+    if (begin < size)
+        chunks.emplace_back(text.data() + begin, size - begin);
+    return chunks;
+}
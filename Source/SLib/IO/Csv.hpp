@@ -0,0 +1,87 @@
+﻿/**
+ * @File Csv.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <SLib/String/Text.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+struct CsvOptions
+{
+    char delimiter      = ',';
+    char quote          = '"';
+    bool skipEmptyLines = true; ///< 跳过空行 (只有 "\r" 的行也视为空行)
+    bool quotedNewlines = true; ///< 引号内允许换行. 为 false 时 SplitCsv 直接在换行处切分，不需要统计引号
+};
+
+/**
+ * 流式的 CSV (RFC 4180) 读取器. 每次 next 读取一条记录，字段是指向原文的视图，在下一次 next 之前有效.
+ *
+ * 按 64 字节一块扫描: 由引号位掩码的前缀异或得到引号之内的区间，分隔符与换行中不在引号内的即为字段边界，
+ * 之后每个字段只需一次取最低位. 外层引号会被去掉，字段末尾 "\r\n" 中的 "\r" 也会去掉; 含有转义引号 ("") 的字段
+ * 可以用 CsvUnescape 还原. 未闭合的引号、未加引号的字段中出现引号、闭合引号后还有其他字符时返回 ParseError.
+ */
+class CsvReader
+{
+public:
+    explicit CsvReader(StringView text, const CsvOptions& options = {});
+
+    /**
+     * @brief 读取下一条记录，没有更多记录时返回 false.
+     */
+    SLIB_NODISCARD Result<bool> next();
+
+    SLIB_NODISCARD std::span<const StringView> fields() const { return _fields; }
+
+    SLIB_NODISCARD StringView field(Size index) const { return _fields[index]; }
+
+    SLIB_NODISCARD Size fieldCount() const { return _fields.size(); }
+
+    /**
+     * @brief 当前记录在原文中的起始偏移. 之前的内容不会再被访问，流式处理映射文件时可以归还这部分页.
+     */
+    SLIB_NODISCARD Size position() const { return _recordStart; }
+
+private:
+    bool loadBlock();
+
+    Result<void> addField(Size end, Size quotes, bool lastInRecord);
+
+    StringView _text;
+    CharSet _quotes;
+    CharSet _separators;
+    CsvOptions _options;
+    std::vector<StringView> _fields;
+
+    Size _block       = 0; ///< 当前块的起始偏移
+    Size _next        = 0; ///< 下一块的起始偏移
+    u64 _structurals  = 0; ///< 当前块中尚未处理的字段边界
+    u64 _quoteMask    = 0; ///< 当前块中的引号
+    Size _quoteBase   = 0; ///< 当前块之前的引号数
+    u64 _inQuote      = 0; ///< 前一块是否结束在引号内 (全 0 或全 1)
+    Size _fieldStart  = 0;
+    Size _fieldQuotes = 0; ///< 字段起点之前的引号数
+    Size _recordStart = 0;
+};
+
+/**
+ * @brief 还原引号内的转义 ("" -> ")，没有引号时直接返回 field，否则写入 buffer 并返回指向它的视图.
+ */
+SLIB_NODISCARD StringView CsvUnescape(StringView field, String& buffer, char quote = '"');
+
+/**
+ * @brief 在记录边界处把文本切成至多 parts 段，各段可以分别交给 CsvReader 并行解析.
+ *        options.quotedNewlines 为 true 时先 (并行地) 统计每段的引号数，以确定切分点是否位于引号内.
+ */
+SLIB_NODISCARD std::vector<StringView> SplitCsv(StringView text, Size parts, const CsvOptions& options = {});
+
+} // namespace slib
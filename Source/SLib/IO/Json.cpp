@@ -0,0 +1,385 @@
+﻿/**
+ * @File Json.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Json.hpp"
+
+#include <bit>
+#include <cstring>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kMinChunkSize = Size(64) << 10;
+
+constexpr CharSet MakeControlSet()
+{
+    CharSet set;
+    for (int c = 0; c < 0x20; ++c)
+        set.add(static_cast<char>(c));
+    return set;
+}
+
+constexpr CharSet kQuote("\"");
+constexpr CharSet kBackslash("\\");
+constexpr CharSet kOperators("{}[]:,");
+constexpr CharSet kWhitespace(" \t\n\r");
+constexpr CharSet kEscapes("\"\\/bfnrtu");
+constexpr CharSet kControl = MakeControlSet();
+
+SLIB_FORCE_INLINE bool IsJsonSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+std::unexpected<Failure> UnexpectedAt(StringView text, Size position)
+{
+    if (position >= text.size())
+        return Unexpected(FailureType::ParseError, "Unexpected end of JSON at offset {}", position);
+    return Unexpected(FailureType::ParseError, "Unexpected '{}' in JSON at offset {}", StringView(text.data() + position, 1), position);
+}
+
+/**
+ * @brief JSON 数字: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ */
+bool IsJsonNumber(StringView text)
+{
+    const char* p     = text.data();
+    const char* end   = p + text.size();
+    const auto digits = [&] {
+        const char* start = p;
+        while (p < end && IsAsciiDigit(*p))
+            ++p;
+        return p > start;
+    };
+
+    if (p < end && *p == '-')
+        ++p;
+    if (p < end && *p == '0')
+        ++p;
+    else if (!digits())
+        return false;
+    if (p < end && *p == '.') {
+        ++p;
+        if (!digits())
+            return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        if (p < end && (*p == '+' || *p == '-'))
+            ++p;
+        if (!digits())
+            return false;
+    }
+    return p == end;
+}
+
+bool ClassifyScalar(StringView text, JsonTokenType& type)
+{
+    const std::string_view s(text.data(), text.size());
+    if (s == "true")
+        type = JsonTokenType::True;
+    else if (s == "false")
+        type = JsonTokenType::False;
+    else if (s == "null")
+        type = JsonTokenType::Null;
+    else if (IsJsonNumber(text))
+        type = JsonTokenType::Number;
+    else
+        return false;
+    return true;
+}
+
+SLIB_FORCE_INLINE int HexValue(char c)
+{
+    if (IsAsciiDigit(c))
+        return c - '0';
+    c = ToAsciiLower(c);
+    return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+/**
+ * @brief 读取 \\u 之后的 4 位十六进制数，非法时返回 -1.
+ */
+i32 ReadHex4(const char* p)
+{
+    i32 value = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int digit = HexValue(p[i]);
+        if (digit < 0)
+            return -1;
+        value = (value << 4) | digit;
+    }
+    return value;
+}
+
+void AppendUtf8(String& out, u32 code)
+{
+    if (code < 0x80) {
+        out.push_back(static_cast<char>(code));
+    }
+    else if (code < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    else if (code < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    else {
+        out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+/**
+ * @brief 解码 p[i] 开始的 4 位十六进制码点 (即 \u 之后)，高代理之后必须紧跟 \u 低代理. 成功时 i 移到转义之后.
+ */
+bool AppendUnicodeEscape(String& out, const char* p, Size n, Size& i)
+{
+    const i32 high = i + 4 <= n ? ReadHex4(p + i) : -1;
+    if (high < 0 || (high >= 0xDC00 && high < 0xE000))
+        return false;
+
+    u32 code = static_cast<u32>(high);
+    Size end = i + 4;
+    if (code >= 0xD800 && code < 0xDC00) {
+        const i32 low = end + 6 <= n && p[end] == '\\' && p[end + 1] == 'u' ? ReadHex4(p + end + 2) : -1;
+        if (low < 0xDC00 || low >= 0xE000)
+            return false;
+        code = 0x10000 + ((code - 0xD800) << 10) + (static_cast<u32>(low) - 0xDC00);
+        end += 6;
+    }
+    AppendUtf8(out, code);
+    i = end;
+    return true;
+}
+
+} // namespace
+
+JsonReader::JsonReader(StringView text) : _text(text) { }
+
+Result<bool> JsonReader::loadBlock()
+{
+    if (_next >= _text.size())
+        return false;
+
+    const char* p       = _text.data() + _next;
+    const Size valid    = _text.size() - _next;
+    const u64 validMask = valid >= 64 ? ~u64(0) : (u64(1) << valid) - 1;
+
+    // 被转义的字符: 每个未被转义的反斜杠转义其后一个字节，连续的反斜杠两两配对
+    u64 backslash = detail::ClassifyBlock(p, valid, kBackslash);
+    u64 escaped   = _escaped;
+    if (SLIB_UNLIKELY(backslash | escaped)) {
+        backslash &= ~escaped;
+        _escaped   = 0;
+        while (backslash) {
+            const int i = std::countr_zero(backslash);
+            if (i == 63) {
+                _escaped = 1;
+                break;
+            }
+            escaped   |= u64(2) << i;
+            backslash &= ~(u64(3) << i);
+        }
+        escaped &= validMask;
+    }
+
+    // 字符串区间: 开引号与其后的内容为 1，闭引号为 0
+    const u64 quotes   = detail::ClassifyBlock(p, valid, kQuote) & ~escaped;
+    const u64 inString = PrefixXor(quotes) ^ _inString;
+    const u64 content  = inString & ~quotes;
+    _inString          = static_cast<u64>(static_cast<i64>(inString) >> 63);
+
+    if (const u64 control = detail::ClassifyBlock(p, valid, kControl) & content; SLIB_UNLIKELY(control)) {
+        return Unexpected(FailureType::ParseError, "Control character in JSON string at offset {}",
+                          _next + static_cast<Size>(std::countr_zero(control)));
+    }
+    if (const u64 invalid = escaped & content & ~detail::ClassifyBlock(p, valid, kEscapes); SLIB_UNLIKELY(invalid)) {
+        return Unexpected(FailureType::ParseError, "Invalid escape in JSON string at offset {}",
+                          _next + static_cast<Size>(std::countr_zero(invalid)) - 1);
+    }
+
+    // 字符串之外既不是操作符也不是空白的字节属于标量 (字面量或数字)，记录每段标量的起点与其后的第一个字节
+    const u64 operators = detail::ClassifyBlock(p, valid, kOperators) & ~inString;
+    const u64 space     = detail::ClassifyBlock(p, valid, kWhitespace);
+    const u64 scalar    = validMask & ~(inString | quotes | operators | space);
+    const u64 previous  = (scalar << 1) | _scalar;
+    _scalar             = scalar >> 63;
+
+    _structurals  = operators | quotes | (scalar & ~previous) | (~scalar & previous & validMask);
+    _block        = _next;
+    _next        += 64;
+    return true;
+}
+
+Result<Size> JsonReader::peekIndex()
+{
+    while (_structurals == 0) {
+        SLIB_TRY_ASSIGN(const bool loaded, loadBlock());
+        if (!loaded)
+            return _text.size();
+    }
+    return _block + static_cast<Size>(std::countr_zero(_structurals));
+}
+
+void JsonReader::endValue()
+{
+    _state = _containers.empty() ? State::Value : State::CommaOrEnd;
+}
+
+Result<bool> JsonReader::next()
+{
+    const char* p = _text.data();
+    const Size n  = _text.size();
+
+    for (;;) {
+        SLIB_TRY_ASSIGN(const Size pos, peekIndex());
+        if (pos >= n) {
+            if (_state != State::Value || !_containers.empty())
+                return UnexpectedAt(_text, n);
+            return false;
+        }
+        _structurals &= _structurals - 1;
+        _position     = pos;
+
+        const bool expectValue = _state == State::Value || _state == State::ValueOrEnd;
+        const char c           = p[pos];
+        if (c == '{' || c == '[') {
+            if (!expectValue)
+                return UnexpectedAt(_text, pos);
+            const bool object = c == '{';
+            _containers.push_back(object);
+            _state = object ? State::KeyOrEnd : State::ValueOrEnd;
+            _token = {object ? JsonTokenType::BeginObject : JsonTokenType::BeginArray, StringView(p + pos, 1)};
+            return true;
+        }
+        if (c == '}' || c == ']') {
+            const bool object  = c == '}';
+            const bool allowed = _state == State::CommaOrEnd || _state == (object ? State::KeyOrEnd : State::ValueOrEnd);
+            if (!allowed || _containers.empty() || _containers.back() != object)
+                return UnexpectedAt(_text, pos);
+            _containers.pop_back();
+            endValue();
+            _token = {object ? JsonTokenType::EndObject : JsonTokenType::EndArray, StringView(p + pos, 1)};
+            return true;
+        }
+        if (c == ':') {
+            if (_state != State::Colon)
+                return UnexpectedAt(_text, pos);
+            _state = State::Value;
+            continue;
+        }
+        if (c == ',') {
+            if (_state != State::CommaOrEnd)
+                return UnexpectedAt(_text, pos);
+            _state = _containers.back() ? State::Key : State::Value;
+            continue;
+        }
+        if (c == '"') {
+            const bool key = _state == State::Key || _state == State::KeyOrEnd;
+            if (!key && !expectValue)
+                return UnexpectedAt(_text, pos);
+            // 字符串之内没有结构位置，下一个位置就是闭引号
+            SLIB_TRY_ASSIGN(const Size close, peekIndex());
+            if (close >= n)
+                return Unexpected(FailureType::ParseError, "Unterminated JSON string at offset {}", pos);
+            _structurals &= _structurals - 1;
+            _token        = {key ? JsonTokenType::Key : JsonTokenType::String, StringView(p + pos + 1, close - pos - 1)};
+            if (key)
+                _state = State::Colon;
+            else
+                endValue();
+            return true;
+        }
+        if (IsJsonSpace(c))
+            continue;
+        if (!expectValue)
+            return UnexpectedAt(_text, pos);
+
+        // 标量之后的位置若是空白则只是终点标记，一并移除
+        SLIB_TRY_ASSIGN(const Size end, peekIndex());
+        if (end < n && IsJsonSpace(p[end]))
+            _structurals &= _structurals - 1;
+
+        _token.text = StringView(p + pos, end - pos);
+        if (!ClassifyScalar(_token.text, _token.type))
+            return Unexpected(FailureType::ParseError, "Invalid JSON value at offset {}", pos);
+        endValue();
+        return true;
+    }
+}
+
+Result<StringView> slib::JsonUnescape(StringView raw, String& buffer)
+{
+    const char* p     = raw.data();
+    const Size n      = raw.size();
+    const void* found = n ? std::memchr(p, '\\', n) : nullptr;
+    if (!found)
+        return raw;
+
+    buffer.clear();
+    Size i = static_cast<Size>(static_cast<const char*>(found) - p);
+    buffer.append(p, i);
+    while (i < n) {
+        if (p[i] != '\\') {
+            buffer.push_back(p[i++]);
+            continue;
+        }
+        if (i + 1 >= n)
+            return Unexpected(FailureType::ParseError, "Invalid JSON escape at offset {}", i);
+
+        const char c = p[i + 1];
+        i           += 2;
+        switch (c) {
+        case '"'  : buffer.push_back('"'); break;
+        case '\\' : buffer.push_back('\\'); break;
+        case '/'  : buffer.push_back('/'); break;
+        case 'b'  : buffer.push_back('\b'); break;
+        case 'f'  : buffer.push_back('\f'); break;
+        case 'n'  : buffer.push_back('\n'); break;
+        case 'r'  : buffer.push_back('\r'); break;
+        case 't'  : buffer.push_back('\t'); break;
+        case 'u'  :
+            if (!AppendUnicodeEscape(buffer, p, n, i))
+                return Unexpected(FailureType::ParseError, "Invalid JSON unicode escape at offset {}", i - 2);
+            break;
+        default   : return Unexpected(FailureType::ParseError, "Invalid JSON escape at offset {}", i - 2);
+        }
+    }
+    return StringView(buffer);
+}
+
+std::vector<StringView> slib::SplitJsonLines(StringView text, Size parts)
+{
+    const Size size = text.size();
+    parts           = Max<Size>(Min(parts, size / kMinChunkSize), 1);
+
+    std::vector<StringView> chunks;
+    const Size step = (size + parts - 1) / parts;
+    Size begin      = 0;
+    for (Size i = 1; i < parts && begin < size; ++i) {
+        const Size cut = i * step;
+        if (cut < begin || cut >= size)
+            continue;
+        // JSON 字符串中不能出现未转义的换行，换行一定位于两个值之间
+        const void* found = std::memchr(text.data() + cut, '\n', size - cut);
+        const Size split  = found ? static_cast<Size>(static_cast<const char*>(found) - text.data()) + 1 : size;
+        chunks.emplace_back(text.data() + begin, split - begin);
+        begin = split;
+    }
+    if (begin < size)
+        chunks.emplace_back(text.data() + begin, size - begin);
+    return chunks;
+}
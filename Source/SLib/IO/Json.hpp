@@ -0,0 +1,115 @@
+﻿/**
+ * @File Json.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <SLib/String/Text.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+enum class JsonTokenType : u8
+{
+    BeginObject,
+    EndObject,
+    BeginArray,
+    EndArray,
+    Key,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+};
+
+/**
+ * 一个 JSON 记号. Key 与 String 的 text 是引号之间的原文 (转义未还原，见 JsonUnescape)，Number 是数字的原文，
+ * 其余类型的 text 为对应的字符.
+ */
+struct JsonToken
+{
+    JsonTokenType type = JsonTokenType::Null;
+    StringView text;
+};
+
+/**
+ * 流式的 JSON 记号读取器 (SAX 风格)，不建立 DOM 也不复制数据，记号的 text 指向原文.
+ *
+ * 扫描分两步，与 simdjson 相同: 第一步每 64 字节分类一次，由反斜杠求出被转义的字符，由未转义引号的前缀异或得到
+ * 字符串区间，再得到字符串之外的结构字符与标量的起点; 第二步只访问这些位置，用状态机检查语法. 顶层可以有多个值
+ * (例如 JSON Lines)，依次读出. 语法错误、字符串中的控制字符或非法转义、非法的字面量与数字都返回 ParseError.
+ */
+class JsonReader
+{
+public:
+    explicit JsonReader(StringView text);
+
+    /**
+     * @brief 读取下一个记号，文本结束时返回 false.
+     */
+    SLIB_NODISCARD Result<bool> next();
+
+    SLIB_NODISCARD const JsonToken& token() const { return _token; }
+
+    /**
+     * @brief 当前所在的容器层数. BeginObject/BeginArray 之后加一，EndObject/EndArray 之后减一.
+     */
+    SLIB_NODISCARD Size depth() const { return _containers.size(); }
+
+    /**
+     * @brief 当前记号在原文中的起始偏移. 之前的内容不会再被访问.
+     */
+    SLIB_NODISCARD Size position() const { return _position; }
+
+private:
+    enum class State : u8
+    {
+        Value,      ///< 需要一个值
+        ValueOrEnd, ///< '[' 之后
+        Key,        ///< 对象中 ',' 之后
+        KeyOrEnd,   ///< '{' 之后
+        Colon,      ///< 键之后
+        CommaOrEnd, ///< 容器中的值之后
+    };
+
+    Result<bool> loadBlock();
+
+    /**
+     * @brief 下一个结构位置 (不移除)，文本结束时返回 text.size().
+     */
+    Result<Size> peekIndex();
+
+    void endValue();
+
+    StringView _text;
+    JsonToken _token;
+    std::vector<u8> _containers; ///< 每层是否为对象
+    State _state = State::Value;
+
+    Size _block      = 0;
+    Size _next       = 0;
+    Size _position   = 0;
+    u64 _structurals = 0;
+    u64 _inString    = 0; ///< 前一块是否结束在字符串内 (全 0 或全 1)
+    u64 _escaped     = 0; ///< 前一块是否以未配对的反斜杠结束
+    u64 _scalar      = 0; ///< 前一块的最后一个字节是否属于标量
+};
+
+/**
+ * @brief 还原字符串记号中的转义 (包括 \uXXXX 与代理对，以 UTF-8 写出). 没有转义时直接返回 raw，否则写入 buffer
+ *        并返回指向它的视图. 非法的转义返回 ParseError.
+ */
+SLIB_NODISCARD Result<StringView> JsonUnescape(StringView raw, String& buffer);
+
+/**
+ * @brief 在换行处把 JSON Lines 文本切成至多 parts 段，各段可以分别交给 JsonReader 并行解析.
+ */
+SLIB_NODISCARD std::vector<StringView> SplitJsonLines(StringView text, Size parts);
+
+} // namespace slib
@@ -0,0 +1,222 @@
+﻿/**
+ * @File MappedFile.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "MappedFile.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+
+#if defined(SLIB_IN_LINUX) || defined(SLIB_IN_MAC)
+#  define SLIB_MAPPED_FILE_POSIX 1
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#else
+#  define SLIB_MAPPED_FILE_POSIX 0
+#endif
+
+using namespace slib;
+
+namespace {
+
+#if SLIB_MAPPED_FILE_POSIX
+
+constexpr Size kHugePageSize = Size(2) << 20;
+
+SLIB_FORCE_INLINE Size PageSize()
+{
+    static const Size sPageSize = static_cast<Size>(::sysconf(_SC_PAGESIZE));
+    return sPageSize;
+}
+
+SLIB_FORCE_INLINE int ToAdvice(MapAccess access)
+{
+    switch (access) {
+    case MapAccess::Sequential : return MADV_SEQUENTIAL;
+    case MapAccess::Random     : return MADV_RANDOM;
+    default                    : return MADV_NORMAL;
+    }
+}
+
+/**
+ * @brief 把 [offset, offset + length) 与映射求交后向内 (inner) 或向外对齐到页边界，结果为空时返回 false.
+ */
+bool PageRange(const char* data, Size size, Size offset, Size length, bool inner, char*& begin, Size& bytes)
+{
+    if (offset >= size)
+        return false;
+    length               = Min(length, size - offset);
+    const Size page      = PageSize();
+    const auto base      = reinterpret_cast<uintptr_t>(data);
+    const uintptr_t from = inner ? AlignUp<uintptr_t>(base + offset, page) : (base + offset) & ~(page - 1);
+    // 映射末尾的不完整页属于映射本身，向内对齐时也可以整体归还
+    const uintptr_t last = offset + length == size ? AlignUp<uintptr_t>(base + size, page) : base + offset + length;
+    const uintptr_t to   = inner ? last & ~(page - 1) : AlignUp<uintptr_t>(last, page);
+    if (from >= to)
+        return false;
+    begin = reinterpret_cast<char*>(from);
+    bytes = to - from;
+    return true;
+}
+
+/**
+ * @brief 在 2MiB 对齐的地址上映射文件，使内核可以用大页映射文件页. 预留失败时退回普通映射.
+ */
+void* MapAligned(int fd, Size size, int flags)
+{
+    const Size reserved = size + kHugePageSize;
+    void* region        = ::mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED)
+        return ::mmap(nullptr, size, PROT_READ, flags, fd, 0);
+
+    const auto base    = reinterpret_cast<uintptr_t>(region);
+    const auto aligned = AlignUp<uintptr_t>(base, kHugePageSize);
+    void* mapped       = ::mmap(reinterpret_cast<void*>(aligned), size, PROT_READ, flags | MAP_FIXED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        ::munmap(region, reserved);
+        return MAP_FAILED;
+    }
+
+    // 归还预留区域中映射之外的部分
+    const uintptr_t end = AlignUp<uintptr_t>(aligned + size, PageSize());
+    if (aligned > base)
+        ::munmap(region, aligned - base);
+    if (base + reserved > end)
+        ::munmap(reinterpret_cast<void*>(end), base + reserved - end);
+    return mapped;
+}
+
+#endif
+
+} // namespace
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        close();
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
+
+void MappedFile::close()
+{
+#if SLIB_MAPPED_FILE_POSIX
+    if (_data)
+        ::munmap(_data, _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+}
+
+Result<MappedFile> MappedFile::Open(StringView path, const MappedFileOptions& options)
+{
+#if SLIB_MAPPED_FILE_POSIX
+    const String name(path);
+    const int fd = ::open(name.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        const int error = errno;
+        return Unexpected(error == ENOENT ? FailureType::NotFound : FailureType::IOError, "Cannot open '{}': {}", path,
+                          std::strerror(error));
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        return Unexpected(FailureType::IOError, "'{}' is not a regular file", path);
+    }
+
+    const auto size = static_cast<Size>(info.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return MappedFile{};
+    }
+
+    int flags = MAP_PRIVATE;
+#  if defined(MAP_POPULATE)
+    if (options.populate)
+        flags |= MAP_POPULATE;
+#  endif
+
+    void* mapped = options.hugePages ? MapAligned(fd, size, flags) : ::mmap(nullptr, size, PROT_READ, flags, fd, 0);
+    const int error = errno;
+    // 映射建立后不再需要文件描述符
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+        return Unexpected(FailureType::IOError, "Cannot map '{}': {}", path, std::strerror(error));
+
+    MappedFile file(static_cast<char*>(mapped), size);
+#  if defined(MADV_HUGEPAGE)
+    if (options.hugePages)
+        ::madvise(mapped, size, MADV_HUGEPAGE);
+#  endif
+    if (options.access != MapAccess::Normal)
+        file.advise(options.access);
+    return file;
+#else
+    (void)path;
+    (void)options;
+    return Unexpected(FailureType::Unsupported, "MappedFile is not supported on this platform");
+#endif
+}
+
+void MappedFile::advise(MapAccess access, Size offset, Size length) const
+{
+#if SLIB_MAPPED_FILE_POSIX
+    char* begin = nullptr;
+    Size bytes  = 0;
+    if (PageRange(_data, _size, offset, length, false, begin, bytes))
+        ::madvise(begin, bytes, ToAdvice(access));
+#else
+    (void)access;
+    (void)offset;
+    (void)length;
+#endif
+}
+
+void MappedFile::prefetch(Size offset, Size length) const
+{
+#if SLIB_MAPPED_FILE_POSIX
+    char* begin = nullptr;
+    Size bytes  = 0;
+    if (PageRange(_data, _size, offset, length, false, begin, bytes))
+        ::madvise(begin, bytes, MADV_WILLNEED);
+#else
+    (void)offset;
+    (void)length;
+#endif
+}
+
+void MappedFile::evict(Size offset, Size length) const
+{
+#if SLIB_MAPPED_FILE_POSIX
+    char* begin = nullptr;
+    Size bytes  = 0;
+    // 只读的私有映射没有脏页，DONTNEED 只是丢弃页表项，之后的访问重新从页缓存或文件读入
+    if (PageRange(_data, _size, offset, length, true, begin, bytes))
+        ::madvise(begin, bytes, MADV_DONTNEED);
+#else
+    (void)offset;
+    (void)length;
+#endif
+}
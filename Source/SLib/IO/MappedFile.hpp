@@ -0,0 +1,89 @@
+﻿/**
+ * @File MappedFile.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <SLib/String/StringType.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * 访问模式提示，决定内核的预读策略.
+ */
+enum class MapAccess : u8
+{
+    Normal,     ///< 默认预读
+    Sequential, ///< 顺序扫描: 积极预读，读过的页可以尽早回收
+    Random,     ///< 随机访问: 关闭预读
+};
+
+struct MappedFileOptions
+{
+    MapAccess access = MapAccess::Sequential;
+    bool hugePages   = false; ///< 按 2MiB 对齐映射并请求透明大页，减少大文件扫描时的 TLB 缺失; 内核不支持时忽略
+    bool populate    = false; ///< 映射时即读入全部页 (MAP_POPULATE)，只适合能放入内存的文件
+};
+
+/**
+ * 只读的内存映射文件. 内容以 StringView 形式直接交给解析器，不经过任何复制; 页面在首次访问时才由内核读入，
+ * 因此可以顺序处理大于内存的文件: 处理过的区间用 evict 归还，驻留内存只与窗口大小有关.
+ *
+ * 目前只支持 POSIX 平台，其他平台上 Open 返回 Unsupported.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief 映射整个文件. 文件不存在时返回 NotFound，其他失败返回 IOError. 空文件得到空的映射.
+     */
+    SLIB_NODISCARD static Result<MappedFile> Open(StringView path, const MappedFileOptions& options = {});
+
+    SLIB_NODISCARD const char* data() const { return _data; }
+
+    SLIB_NODISCARD Size size() const { return _size; }
+
+    SLIB_NODISCARD bool empty() const { return _size == 0; }
+
+    SLIB_NODISCARD StringView view() const { return {_data, _size}; }
+
+    /**
+     * @brief 修改 [offset, offset + length) 的访问模式提示.
+     */
+    void advise(MapAccess access, Size offset = 0, Size length = ~Size(0)) const;
+
+    /**
+     * @brief 提示内核异步读入 [offset, offset + length)，用于在处理当前窗口时预取下一个窗口.
+     */
+    void prefetch(Size offset, Size length) const;
+
+    /**
+     * @brief 归还完全位于 [offset, offset + length) 内的页. 之后再访问这些页会重新从文件读入，内容不变.
+     */
+    void evict(Size offset, Size length) const;
+
+    void close();
+
+private:
+    MappedFile(char* data, Size size) : _data(data), _size(size) { }
+
+    char* _data = nullptr;
+    Size _size  = 0;
+};
+
+} // namespace slib
@@ -0,0 +1,64 @@
+﻿/**
+ * @File ISingleton.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "ISingleton.hpp"
+
+#include <cstdlib>
+
+using namespace slib;
+
+namespace {
+
+/**
+ * 锁与链表头均不析构，退出阶段 (包括其他静态对象的析构中) 仍可使用.
+ */
+std::recursive_mutex& Mutex()
+{
+    static auto* mutex = new std::recursive_mutex;
+    return *mutex;
+}
+
+detail::SingletonEntry* sHead = nullptr;
+bool sExitRegistered          = false;
+
+} // namespace
+
+std::unique_lock<std::recursive_mutex> slib::detail::LockSingletons()
+{
+    return std::unique_lock(Mutex());
+}
+
+void slib::detail::RegisterSingleton(SingletonEntry* entry)
+{
+    auto lock = LockSingletons();
+    if (!sExitRegistered) {
+        sExitRegistered = true;
+        std::atexit(&ShutdownSingletons);
+    }
+    entry->next = sHead;
+    sHead       = entry;
+}
+
+void slib::detail::UnregisterSingleton(SingletonEntry* entry)
+{
+    auto lock = LockSingletons();
+    for (SingletonEntry** p = &sHead; *p; p = &(*p)->next) {
+        if (*p == entry) {
+            *p          = entry->next;
+            entry->next = nullptr;
+            return;
+        }
+    }
+}
+
+void slib::ShutdownSingletons()
+{
+    auto lock = detail::LockSingletons();
+    // 析构中可能重新创建其他单例 (登记到头部)，因此每次都从头部取
+    while (sHead)
+        sHead->shutdown();
+}
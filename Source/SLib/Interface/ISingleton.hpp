@@ -6,3 +6,146 @@
  */
  
 #pragma once
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#include <SLib/Error.hpp>
+
+namespace slib {
+
+namespace detail {
+
+/**
+ * 已初始化单例的登记项，随 Singleton<T> 静态存储，登记时不分配内存.
+ */
+struct SingletonEntry
+{
+    void (*shutdown)();
+    SingletonEntry* next;
+};
+
+/**
+ * @brief 所有单例共用的递归锁: 单例构造时可以访问其他单例.
+ */
+std::unique_lock<std::recursive_mutex> LockSingletons();
+
+/**
+ * @brief 登记到链表头部. 首次登记时注册 atexit(ShutdownSingletons).
+ */
+void RegisterSingleton(SingletonEntry* entry);
+void UnregisterSingleton(SingletonEntry* entry);
+
+} // namespace detail
+
+/**
+ * @brief 按初始化的逆序销毁所有单例. 进程退出时自动调用，也可以提前显式调用; 调用时不应有其他线程正在使用单例.
+ */
+void ShutdownSingletons();
+
+/**
+ * 线程安全的惰性单例.
+ *
+ * 初始化后 Get 只是一次指针加载 (x86 上 acquire 加载即普通 mov)，不像函数内 static 那样每次检查守卫变量.
+ * 可以用 Init 显式传参初始化，否则首次 Get 时默认构造 (不可默认构造的类型此时抛出异常). 单例在构造完成后登记，按初始化的逆序销毁:
+ * 构造中访问了其他单例时，被依赖的单例先完成登记，因此后销毁. 关闭后再次 Get 会重新创建.
+ */
+template<typename T>
+class Singleton
+{
+public:
+    Singleton() = delete;
+
+    SLIB_FORCE_INLINE static T& Get()
+    {
+        if (T* p = sInstance.load(std::memory_order_acquire); SLIB_LIKELY(p != nullptr))
+            return *p;
+        return create();
+    }
+
+    /**
+     * @brief 未初始化时返回 nullptr，不会触发创建.
+     */
+    SLIB_FORCE_INLINE static T* TryGet() { return sInstance.load(std::memory_order_acquire); }
+
+    SLIB_NODISCARD static bool IsInitialized() { return TryGet() != nullptr; }
+
+    /**
+     * @brief 以给定参数创建实例. 已经初始化时抛出异常.
+     */
+    template<typename... Args>
+    static T& Init(Args&&... args)
+    {
+        auto lock = detail::LockSingletons();
+        SLIB_CHECK(sInstance.load(std::memory_order_relaxed) == nullptr, "Singleton is already initialized");
+        return publish(new T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief 销毁实例. 调用时不应有其他线程正在使用它.
+     */
+    static void Shutdown()
+    {
+        auto lock = detail::LockSingletons();
+        T* p      = sInstance.exchange(nullptr, std::memory_order_acq_rel);
+        if (!p)
+            return;
+        detail::UnregisterSingleton(&sEntry);
+        delete p;
+    }
+
+private:
+    SLIB_NOINLINE static T& create()
+    {
+        auto lock = detail::LockSingletons();
+        if (T* p = sInstance.load(std::memory_order_relaxed))
+            return *p;
+        if constexpr (requires { new T(); })
+            return publish(new T());
+        else
+            SLIB_THROW("Singleton must be initialized with Init before use");
+    }
+
+    static T& publish(T* p)
+    {
+        detail::RegisterSingleton(&sEntry);
+        sInstance.store(p, std::memory_order_release);
+        return *p;
+    }
+
+    static inline std::atomic<T*> sInstance{nullptr};
+    static inline detail::SingletonEntry sEntry{&Shutdown, nullptr};
+};
+
+/**
+ * 单例类的 CRTP 基类: `class Foo : public ISingleton<Foo>` 后即可使用 Foo::Get().
+ * 构造函数为私有时，需要声明 `friend class Singleton<Foo>;`.
+ */
+template<typename T>
+class ISingleton
+{
+public:
+    SLIB_FORCE_INLINE static T& Get() { return Singleton<T>::Get(); }
+
+    SLIB_FORCE_INLINE static T* TryGet() { return Singleton<T>::TryGet(); }
+
+    SLIB_NODISCARD static bool IsInitialized() { return Singleton<T>::IsInitialized(); }
+
+    template<typename... Args>
+    static T& Init(Args&&... args)
+    {
+        return Singleton<T>::Init(std::forward<Args>(args)...);
+    }
+
+    static void Shutdown() { Singleton<T>::Shutdown(); }
+
+    ISingleton(const ISingleton&)            = delete;
+    ISingleton& operator=(const ISingleton&) = delete;
+
+protected:
+    ISingleton()  = default;
+    ~ISingleton() = default;
+};
+
+} // namespace slib
@@ -7,7 +7,9 @@
 
 #include "Logger.hpp"
 #include "Error.hpp"
+#include "CrashHandler.hpp"
 
+#include <atomic>
 #include <mutex>
 
 using namespace slib;
@@ -26,7 +28,7 @@ constexpr inline const char* logLevelString(Logger::Level level)
 }
 
 std::mutex sMutex = {};
-Logger::Level sCurrentLevel =
+std::atomic<Logger::Level> sCurrentLevel =
 #ifdef SLIB_ENABLE_DEBUG
     Logger::Level::Trace;
 #else
@@ -40,11 +42,12 @@ Logger::~Logger() { }
 
 void Logger::log(Level level, std::string_view msg, u32 indent)
 {
-    auto lock = std::lock_guard(sMutex);
-
-    if (level > sCurrentLevel)
+    // 被过滤的消息不必等待输出锁
+    if (level > sCurrentLevel.load(std::memory_order_relaxed))
         return;
 
+    _messageCounts[static_cast<Size>(level)].increment();
+
     // TODO: Terminal colors
     // fmt::color color = fmt::color::white;
     // switch (level) {
@@ -57,19 +60,26 @@ void Logger::log(Level level, std::string_view msg, u32 indent)
 
     // TODO: [%(time)][%(thread_id)][%(short_source_location)][%(log_level)]%(tags): %(message)
     // std::print?
-    const auto s = std::format("[{}]: {}{}", logLevelString(level), std::string(indent * 2, ' '), msg);
-    auto& os     = std::cout;
-    os << s << '\n';
+    StringBuilder line;
+    line.format("[{}]: ", logLevelString(level));
+    line.append(indent * 2, ' ').append(msg.data(), msg.size()).append('\n');
+    _bytesWritten.add(static_cast<i64>(line.size()));
+    CrashHandler::RecordLog(StringView(line.data(), line.size() - 1));
+
+    auto lock = std::lock_guard(sMutex);
+    auto& os  = std::cout;
+    os.write(line.data(), static_cast<std::streamsize>(line.size()));
     std::flush(os);
 }
 
 void Logger::setLevel(Level level)
 {
-    auto lock     = std::lock_guard(sMutex);
-    sCurrentLevel = level;
+    sCurrentLevel.store(level, std::memory_order_relaxed);
 }
 
 void detail::LogWithSourceLocation(Logger::Level level, std::source_location sl, std::string_view msg)
 {
-    Logger::Get().log(level, std::format("{}: '{}' {}({}:{})", msg, sl.function_name(), sl.file_name(), sl.line(), sl.column()));
+    StringBuilder line;
+    line.format("{}: '{}' {}({}:{})", msg, sl.function_name(), sl.file_name(), sl.line(), sl.column());
+    Logger::Get().log(level, std::string_view(line.data(), line.size()));
 }
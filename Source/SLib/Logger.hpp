@@ -9,14 +9,16 @@
 
 #include <source_location>
 
-#include <SLib/String/StringType.hpp>
+#include <SLib/String/StringBuilder.hpp>
 #include <SLib/Math/Numeric.hpp>
+#include <SLib/Interface/ISingleton.hpp>
+#include <SLib/Concurrency/ShardedCounter.hpp>
 
 #include <format>
 
 namespace slib {
 
-class Logger
+class Logger : public ISingleton<Logger>
 {
 public:
     enum class Level
@@ -29,18 +31,29 @@ public:
     };
     using enum Level;
 
-    static Logger& Get()
-    {
-        static Logger logger;
-        return logger;
-    }
+    static constexpr Size kLevelCount = static_cast<Size>(Level::Trace) + 1;
 
     void log(Level level, std::string_view msg, u32 indent = 0);
     void setLevel(Level level);
 
+    /**
+     * @brief 通过级别过滤、实际输出的消息数.
+     */
+    SLIB_NODISCARD i64 messageCount(Level level) const { return _messageCounts[static_cast<Size>(level)].value(); }
+
+    /**
+     * @brief 实际输出的字节数 (含换行).
+     */
+    SLIB_NODISCARD i64 bytesWritten() const { return _bytesWritten.value(); }
+
 private:
+    friend class Singleton<Logger>;
+
     Logger();
     ~Logger();
+
+    std::array<ShardedCounter, kLevelCount> _messageCounts;
+    ShardedCounter _bytesWritten;
 };
 
 // @formatter:off
@@ -53,7 +66,9 @@ inline void LogTrace(std::string_view msg)
 template<typename... Args>
 inline void LogTrace(std::format_string<Args...> format, Args&&... args)
 {
-    Logger::Get().log(Logger::Level::Trace, std::format(format, std::forward<Args>(args)...));
+    StringBuilder msg;
+    msg.format(format, std::forward<Args>(args)...);
+    Logger::Get().log(Logger::Level::Trace, std::string_view(msg.data(), msg.size()));
 }
 
 inline void LogTrace(u32 indent, std::string_view msg)
@@ -64,7 +79,9 @@ inline void LogTrace(u32 indent, std::string_view msg)
 template<typename... Args>
 inline void LogTrace(u32 indent, std::format_string<Args...> format, Args&&... args)
 {
-    Logger::Get().log(Logger::Level::Trace, std::format(format, std::forward<Args>(args)...), indent);
+    StringBuilder msg;
+    msg.format(format, std::forward<Args>(args)...);
+    Logger::Get().log(Logger::Level::Trace, std::string_view(msg.data(), msg.size()), indent);
 }
 
 inline void LogInfo(std::string_view msg)
@@ -75,7 +92,9 @@ inline void LogInfo(std::string_view msg)
 template<typename... Args>
 inline void LogInfo(std::format_string<Args...> format, Args&&... args)
 {
-    Logger::Get().log(Logger::Level::Info, std::format(format, std::forward<Args>(args)...));
+    StringBuilder msg;
+    msg.format(format, std::forward<Args>(args)...);
+    Logger::Get().log(Logger::Level::Info, std::string_view(msg.data(), msg.size()));
 }
 
 inline void LogInfo(u32 indent, std::string_view msg)
@@ -86,7 +105,9 @@ inline void LogInfo(u32 indent, std::string_view msg)
 template<typename... Args>
 inline void LogInfo(u32 indent, std::format_string<Args...> format, Args&&... args)
 {
-    Logger::Get().log(Logger::Level::Info, std::format(format, std::forward<Args>(args)...), indent);
+    StringBuilder msg;
+    msg.format(format, std::forward<Args>(args)...);
+    Logger::Get().log(Logger::Level::Info, std::string_view(msg.data(), msg.size()), indent);
 }
 
 inline void LogWarn(std::string_view msg)
@@ -97,7 +118,9 @@ inline void LogWarn(std::string_view msg)
 template<typename... Args>
 inline void LogWarn(std::format_string<Args...> format, Args&&... args)
 {
-    Logger::Get().log(Logger::Level::Warning, std::format(format, std::forward<Args>(args)...));
+    StringBuilder msg;
+    msg.format(format, std::forward<Args>(args)...);
+    Logger::Get().log(Logger::Level::Warning, std::string_view(msg.data(), msg.size()));
 }
 
 inline void LogWarn(u32 indent, std::string_view msg)
@@ -108,7 +131,9 @@ inline void LogWarn(u32 indent, std::string_view msg)
 template<typename... Args>
 inline void LogWarn(u32 indent, std::format_string<Args...> format, Args&&... args)
 {
-    Logger::Get().log(Logger::Level::Warning, std::format(format, std::forward<Args>(args)...), indent);
+    StringBuilder msg;
+    msg.format(format, std::forward<Args>(args)...);
+    Logger::Get().log(Logger::Level::Warning, std::string_view(msg.data(), msg.size()), indent);
 }
 
 namespace detail {
@@ -118,7 +143,9 @@ void LogWithSourceLocation(Logger::Level level, std::source_location sl, std::st
 template<typename... Args>
 inline void LogWithSourceLocation(Logger::Level level, std::source_location sl, std::format_string<Args...> std, Args&&... args)
 {
-    LogWithSourceLocation(level, sl, std::format(std, std::forward<Args>(args)...));
+    StringBuilder msg;
+    msg.format(std, std::forward<Args>(args)...);
+    LogWithSourceLocation(level, sl, std::string_view(msg.data(), msg.size()));
 }
 
 } // namespace detail
@@ -313,7 +313,7 @@ SLIB_FUNC SLIB_CONSTEXPR T BitSwap(T value)
 template<cUnsignedType T>
 SLIB_FUNC SLIB_CONSTEXPR T RotateLeft(T value, int count)
 {
-    constexpr int bits = detail::BitSize<T>();
+    constexpr int bits = std::numeric_limits<T>::digits;
     if (bits == 0)
         return value;  // Should not happen for standard unsigned types
 
@@ -335,7 +335,7 @@ SLIB_FUNC SLIB_CONSTEXPR T RotateLeft(T value, int count)
 template<cUnsignedType T>
 SLIB_FUNC SLIB_CONSTEXPR T RotateRight(T value, int count)
 {
-    constexpr int bits = detail::BitSize<T>();
+    constexpr int bits = std::numeric_limits<T>::digits;
     if (bits == 0)
         return value;
 
@@ -399,4 +399,32 @@ SLIB_FUNC SLIB_CONSTEXPR T AlignUp(T value, T alignment)
 {
     return (value + alignment - 1) & ~(alignment - 1);
 }
+
+/**
+ * @brief 前缀异或: 结果的第 i 位为 value 第 0 ~ i 位的异或. 对引号位掩码求前缀异或即得到位于引号之内的区间.
+ */
+template<cUnsignedType T>
+SLIB_FUNC SLIB_CONSTEXPR T PrefixXor(T value)
+{
+    for (int shift = 1; shift < detail::BitSize<T>(); shift <<= 1)
+        value ^= static_cast<T>(value << shift);
+    return value;
+}
+
+/**
+ * @brief 返回 64 位乘法 a * b 的高 64 位.
+ */
+SLIB_FUNC inline u64 MulHi64(u64 a, u64 b)
+{
+#if SLIB_HAS_GCC_CLANG_INTRINSICS
+    return static_cast<u64>((static_cast<unsigned __int128>(a) * b) >> 64);
+#elif SLIB_HAS_MSVC_INTRINSICS && defined(_M_X64)
+    return __umulh(a, b);
+#else
+    const u64 aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+    const u64 bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+    const u64 mid = (aLo * bLo >> 32) + (aHi * bLo & 0xFFFFFFFF) + aLo * bHi;
+    return aHi * bHi + (aHi * bLo >> 32) + (mid >> 32);
+#endif
+}
 } // namespace slib
\ No newline at end of file
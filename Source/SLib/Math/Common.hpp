@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cmath>
+
 #include <SLib/Math/Math.hpp>
 #include <SLib/Math/Constant.hpp>
 #include <SLib/Error.hpp>
@@ -150,7 +152,7 @@ SLIB_FUNC SLIB_CONSTEXPR T FMA(T a, T b, T c)
     return std::fma(a, b, c);
 }
 
-SLIB_FUNC SLIB_CONSTEXPR f32 ApproxSqrt(f32 x0)
+SLIB_FUNC inline f32 ApproxSqrt(f32 x0)
 {
     SLIB_DEBUG_ASSERT(x0 >= 0);
 
@@ -167,7 +169,7 @@ SLIB_FUNC SLIB_CONSTEXPR f32 ApproxSqrt(f32 x0)
     return u.x;
 }
 
-SLIB_FUNC SLIB_CONSTEXPR f32 ApproxCbrt(f32 x0)
+SLIB_FUNC inline f32 ApproxCbrt(f32 x0)
 {
     SLIB_DEBUG_ASSERT(x0 >= 0);
 
@@ -219,14 +221,14 @@ SLIB_FUNC SLIB_CONSTEXPR T RecipSqrtFast(T x0)
     }
 }
 
-SLIB_FUNC SLIB_CONSTEXPR u32 RoundUp(u32 x, u32 y)
+SLIB_FUNC inline u32 RoundUp(u32 x, u32 y)
 {
     if (x == 0)
         return y;
     return ((x + y - 1) / y) * y;
 }
 
-SLIB_FUNC SLIB_CONSTEXPR Size AlignUp(Size value, Size alignment)
+SLIB_FUNC inline Size AlignUp(Size value, Size alignment)
 {
     // Assumes alignment is a power of two
     return (value + alignment - 1) & ~(alignment - 1);
@@ -48,6 +48,9 @@ constexpr f32 kEpsilonF  = 1e-6f;
 constexpr f64 kEpsilonD  = 1e-12;
 constexpr Float kEpsilon = std::is_same_v<Float, f32> ? CastTo<Float>(kEpsilonF) : CastTo<Float>(kEpsilonD);
 
+constexpr f32 kOneMinusEpsilonF = 0x1.fffffep-1f;       ///< 小于 1 的最大 f32
+constexpr f64 kOneMinusEpsilonD = 0x1.fffffffffffffp-1; ///< 小于 1 的最大 f64
+
 #define DEFINE_CONSTANT_FUNC(name)        \
     template<cFloatType F = f32>          \
     SLIB_FUNC constexpr F name() noexcept \
@@ -142,11 +145,11 @@ template<cArithmeticType T, i32 N>
 SLIB_FUNC constexpr T Pow(T v) noexcept
 {
     if constexpr (N == 0)
-        return 1;
+        return T(1);
     else if constexpr (N == 1)
         return v;
     else if constexpr (N < 0)
-        return 1 / Pow<T, -N>(v);
+        return T(1) / Pow<T, -N>(v);
     else {
         auto v_2 = Pow<T, N / 2>(v);
         return v_2 * v_2 * Pow < T, N & 1 > (v);
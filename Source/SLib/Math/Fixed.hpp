@@ -0,0 +1,190 @@
+﻿/**
+ * @File Fixed.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <compare>
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/Error.hpp>
+
+namespace slib {
+
+namespace detail {
+
+template<int Bits>
+using FixedStorage = std::conditional_t<
+    Bits <= 8, i8, std::conditional_t<Bits <= 16, i16, std::conditional_t<Bits <= 32, i32, i64>>>;
+
+#if defined(__SIZEOF_INT128__)
+#  define SLIB_HAS_INT128 1
+__extension__ typedef __int128 i128;
+#else
+#  define SLIB_HAS_INT128 0
+#endif
+
+} // namespace detail
+
+/**
+ * 有符号定点数 Q(IntBits).(FracBits)，IntBits 包含符号位，存储为能容纳 IntBits + FracBits 位的最小有符号整数.
+ *
+ * - 加减与整数相同，溢出时按 2 的补码回绕.
+ * - 乘法使用两倍宽度的中间结果并舍入到最近值; 除法向零截断.
+ * - 总位数超过 32 时乘除需要 128 位整数 (GCC / Clang).
+ */
+template<int IntBits, int FracBits>
+class Fixed
+{
+    static_assert(IntBits >= 1 && FracBits >= 0 && IntBits + FracBits <= 64, "Fixed supports at most 64 bits.");
+
+public:
+    static constexpr int kIntBits  = IntBits;
+    static constexpr int kFracBits = FracBits;
+
+    using Storage = detail::FixedStorage<IntBits + FracBits>;
+
+    /// 1.0 对应的原始值; IntBits 为 1 时 1.0 本身不可表示，因此用 u64 保存.
+    static constexpr u64 kScale = u64(1) << FracBits;
+
+    constexpr Fixed() = default;
+
+    template<cIntegralType T>
+    explicit constexpr Fixed(T value) : _raw(static_cast<Storage>(static_cast<Wide>(value) << FracBits))
+    {
+    }
+
+    /// 舍入到最近值，中点远离零.
+    template<cFloatType T>
+    explicit constexpr Fixed(T value) : _raw(static_cast<Storage>(value * static_cast<T>(kScale) + (value < 0 ? T(-0.5) : T(0.5))))
+    {
+    }
+
+    SLIB_NODISCARD static constexpr Fixed FromRaw(Storage raw)
+    {
+        Fixed f;
+        f._raw = raw;
+        return f;
+    }
+
+    SLIB_NODISCARD constexpr Storage raw() const { return _raw; }
+
+    template<cFloatType T>
+    explicit constexpr operator T() const noexcept
+    {
+        return static_cast<T>(_raw) / static_cast<T>(kScale);
+    }
+
+    /// 向负无穷取整.
+    template<cIntegralType T>
+    explicit constexpr operator T() const noexcept
+    {
+        return static_cast<T>(_raw >> FracBits);
+    }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) { return FromRaw(Wrap(UStorage(a._raw) + UStorage(b._raw))); }
+
+    friend constexpr Fixed operator-(Fixed a, Fixed b) { return FromRaw(Wrap(UStorage(a._raw) - UStorage(b._raw))); }
+
+    friend constexpr Fixed operator-(Fixed a) { return FromRaw(Wrap(UStorage(0) - UStorage(a._raw))); }
+
+    friend constexpr Fixed operator*(Fixed a, Fixed b)
+    {
+        Wide p = static_cast<Wide>(a._raw) * b._raw;
+        if constexpr (FracBits > 0)
+            p += Wide(1) << (FracBits - 1);
+        return FromRaw(static_cast<Storage>(p >> FracBits));
+    }
+
+    friend constexpr Fixed operator/(Fixed a, Fixed b)
+    {
+        SLIB_DEBUG_ASSERT(b._raw != 0);
+        return FromRaw(static_cast<Storage>((static_cast<Wide>(a._raw) << FracBits) / b._raw));
+    }
+
+    // clang-format off
+    constexpr Fixed& operator+=(Fixed o) { return *this = *this + o; }
+    constexpr Fixed& operator-=(Fixed o) { return *this = *this - o; }
+    constexpr Fixed& operator*=(Fixed o) { return *this = *this * o; }
+    constexpr Fixed& operator/=(Fixed o) { return *this = *this / o; }
+    // clang-format on
+
+    friend constexpr bool operator==(Fixed, Fixed)                  = default;
+    friend constexpr std::strong_ordering operator<=>(Fixed, Fixed) = default;
+
+private:
+    using UStorage = std::make_unsigned_t<Storage>;
+#if SLIB_HAS_INT128
+    using Wide = std::conditional_t<(IntBits + FracBits <= 32), i64, detail::i128>;
+#else
+    static_assert(IntBits + FracBits <= 32, "Fixed wider than 32 bits requires 128-bit integer support.");
+    using Wide = i64;
+#endif
+
+    static constexpr Storage Wrap(UStorage v) { return static_cast<Storage>(v); }
+
+    Storage _raw = 0;
+};
+
+template<int IntBits, int FracBits>
+inline constexpr bool kIsExtendedArithmetic<Fixed<IntBits, FracBits>> = true;
+
+template<int IntBits, int FracBits>
+SLIB_FUNC constexpr Fixed<IntBits, FracBits> Abs(Fixed<IntBits, FracBits> x) noexcept
+{
+    return x.raw() < 0 ? -x : x;
+}
+
+using Q15    = Fixed<1, 15>;
+using Q16_16 = Fixed<16, 16>;
+using Q32_32 = Fixed<32, 32>;
+
+} // namespace slib
+
+template<int IntBits, int FracBits>
+class std::numeric_limits<slib::Fixed<IntBits, FracBits>>
+{
+    using T       = slib::Fixed<IntBits, FracBits>;
+    using Storage = typename T::Storage;
+
+public:
+    static constexpr bool is_specialized    = true;
+    static constexpr bool is_signed         = true;
+    static constexpr bool is_integer        = false;
+    static constexpr bool is_exact          = true;
+    static constexpr bool has_infinity      = false;
+    static constexpr bool has_quiet_NaN     = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr bool is_iec559         = false;
+    static constexpr bool is_bounded        = true;
+    static constexpr bool is_modulo         = true;
+    static constexpr bool traps             = false;
+    static constexpr bool tinyness_before   = false;
+
+    static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+    static constexpr int digits       = IntBits + FracBits - 1;
+    static constexpr int digits10     = digits * 3 / 10;
+    static constexpr int max_digits10 = 0;
+    static constexpr int radix        = 2;
+
+    static constexpr int min_exponent   = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent   = 0;
+    static constexpr int max_exponent10 = 0;
+
+    // clang-format off
+    static constexpr T min() noexcept           { return T::FromRaw(std::numeric_limits<Storage>::min()); }
+    static constexpr T max() noexcept           { return T::FromRaw(std::numeric_limits<Storage>::max()); }
+    static constexpr T lowest() noexcept        { return min(); }
+    static constexpr T epsilon() noexcept       { return T::FromRaw(1); }
+    static constexpr T round_error() noexcept   { return T::FromRaw(FracBits > 0 ? Storage(Storage(1) << (FracBits - 1)) : 0); }
+    static constexpr T infinity() noexcept      { return T(); }
+    static constexpr T quiet_NaN() noexcept     { return T(); }
+    static constexpr T signaling_NaN() noexcept { return T(); }
+    static constexpr T denorm_min() noexcept    { return T(); }
+    // clang-format on
+};
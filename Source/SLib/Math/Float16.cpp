@@ -0,0 +1,123 @@
+﻿/**
+ * @File Float16.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Float16.hpp"
+
+#include <SLib/Error.hpp>
+
+using namespace slib;
+
+namespace {
+
+template<typename Codec>
+void EncodeScalar(const f32* in, BasicHalf<Codec>* out, Size begin, Size end)
+{
+    for (Size i = begin; i < end; ++i)
+        out[i] = BasicHalf<Codec>(in[i]);
+}
+
+template<typename Codec>
+void DecodeScalar(const BasicHalf<Codec>* in, f32* out, Size begin, Size end)
+{
+    for (Size i = begin; i < end; ++i)
+        out[i] = static_cast<f32>(in[i]);
+}
+
+} // namespace
+
+void slib::ConvertF32ToF16(std::span<const f32> in, std::span<f16> out)
+{
+    SLIB_DEBUG_ASSERT(out.size() >= in.size());
+
+    const Size n = in.size();
+    Size i       = 0;
+#if SLIB_HAS_F16C
+    for (; i + 8 <= n; i += 8) {
+        const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in.data() + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), h);
+    }
+#elif SLIB_HAS_NEON
+    for (; i + 4 <= n; i += 4) {
+        const float16x4_t h = vcvt_f16_f32(vld1q_f32(in.data() + i));
+        vst1_u16(reinterpret_cast<u16*>(out.data() + i), vreinterpret_u16_f16(h));
+    }
+#endif
+    EncodeScalar(in.data(), out.data(), i, n);
+}
+
+void slib::ConvertF16ToF32(std::span<const f16> in, std::span<f32> out)
+{
+    SLIB_DEBUG_ASSERT(out.size() >= in.size());
+
+    const Size n = in.size();
+    Size i       = 0;
+#if SLIB_HAS_F16C
+    for (; i + 8 <= n; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.data() + i));
+        _mm256_storeu_ps(out.data() + i, _mm256_cvtph_ps(h));
+    }
+#elif SLIB_HAS_NEON
+    for (; i + 4 <= n; i += 4) {
+        const uint16x4_t h = vld1_u16(reinterpret_cast<const u16*>(in.data() + i));
+        vst1q_f32(out.data() + i, vcvt_f32_f16(vreinterpret_f16_u16(h)));
+    }
+#endif
+    DecodeScalar(in.data(), out.data(), i, n);
+}
+
+void slib::ConvertF32ToBF16(std::span<const f32> in, std::span<bf16> out)
+{
+    SLIB_DEBUG_ASSERT(out.size() >= in.size());
+
+    const Size n = in.size();
+    Size i       = 0;
+#if SLIB_HAS_AVX512BF16
+    for (; i + 16 <= n; i += 16) {
+        const __m256bh h = _mm512_cvtneps_pbh(_mm512_loadu_ps(in.data() + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i), std::bit_cast<__m256i>(h));
+    }
+#elif SLIB_HAS_AVX2
+    // 与 detail::BF16Codec::Encode 相同的整数舍入，NaN 单独置为静默 NaN
+    const __m256i one  = _mm256_set1_epi32(1);
+    const __m256i bias = _mm256_set1_epi32(0x7FFF);
+    const __m256i qnan = _mm256_set1_epi32(0x0040);
+    for (; i + 8 <= n; i += 8) {
+        const __m256 v        = _mm256_loadu_ps(in.data() + i);
+        const __m256i x       = _mm256_castps_si256(v);
+        const __m256i lsb     = _mm256_and_si256(_mm256_srli_epi32(x, 16), one);
+        const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(x, _mm256_add_epi32(bias, lsb)), 16);
+        const __m256i quieted = _mm256_or_si256(_mm256_srli_epi32(x, 16), qnan);
+        const __m256i isNaN   = _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+        const __m256i bits    = _mm256_blendv_epi8(rounded, quieted, isNaN);
+
+        // packus 在每个 128 位通道内交错两个输入，再用 permute 恢复顺序
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(bits, bits), 0b1000);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm256_castsi256_si128(packed));
+    }
+#endif
+    EncodeScalar(in.data(), out.data(), i, n);
+}
+
+void slib::ConvertBF16ToF32(std::span<const bf16> in, std::span<f32> out)
+{
+    SLIB_DEBUG_ASSERT(out.size() >= in.size());
+
+    const Size n = in.size();
+    Size i       = 0;
+#if SLIB_HAS_AVX2
+    for (; i + 8 <= n; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.data() + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i), _mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+    }
+#elif SLIB_HAS_NEON
+    for (; i + 4 <= n; i += 4) {
+        const uint16x4_t h = vld1_u16(reinterpret_cast<const u16*>(in.data() + i));
+        vst1q_f32(out.data() + i, vreinterpretq_f32_u32(vshll_n_u16(h, 16)));
+    }
+#endif
+    DecodeScalar(in.data(), out.data(), i, n);
+}
@@ -0,0 +1,268 @@
+﻿/**
+ * @File Float16.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <bit>
+#include <compare>
+#include <span>
+
+#include <SLib/Math/Math.hpp>
+
+namespace slib {
+
+namespace detail {
+
+/**
+ * @brief 将 f64 舍入到 f32，舍入方向为 "向奇数舍入". 再经一次最近偶数舍入到更窄的格式时不会出现二次舍入误差.
+ */
+SLIB_FUNC constexpr f32 RoundToOddF32(f64 v)
+{
+    const f32 r = static_cast<f32>(v);
+    if (static_cast<f64>(r) == v || r - r != 0) // 精确或非有限值
+        return r;
+
+    u32 bits = std::bit_cast<u32>(r);
+    if ((static_cast<f64>(r) > v) == (v > 0)) // 向远离零的方向舍入了，退回一个 ulp
+        --bits;
+    return std::bit_cast<f32>(bits | 1u);
+}
+
+/**
+ * IEEE 754 binary16: 1 位符号，5 位指数，10 位尾数.
+ */
+struct F16Codec
+{
+    /// 最近偶数舍入，溢出得到 inf，NaN 保持为静默 NaN.
+    static constexpr u16 Encode(f32 value)
+    {
+        u32 x          = std::bit_cast<u32>(value);
+        const u32 sign = (x >> 16) & 0x8000u;
+        x             &= 0x7FFF'FFFFu;
+
+        if (x >= 0x7F80'0000u) // inf / NaN
+            return static_cast<u16>(sign | 0x7C00u | (x > 0x7F80'0000u ? 0x0200u | ((x >> 13) & 0x3FFu) : 0u));
+        if (x >= 0x477F'F000u) // ≥ 65520 时舍入为 inf
+            return static_cast<u16>(sign | 0x7C00u);
+        if (x < 0x3880'0000u) { // < 2^-14，结果为非规格化数或 0
+            // 加上 0.5 后 f32 的尾数单位恰为 2^-24，由硬件完成最近偶数舍入
+            const f32 shifted = std::bit_cast<f32>(x) + 0.5f;
+            return static_cast<u16>(sign | (std::bit_cast<u32>(shifted) - 0x3F00'0000u));
+        }
+
+        const u32 odd  = (x >> 13) & 1u;
+        x             += 0xC800'0FFFu + odd; // 指数重偏置 (15 - 127) 并加上舍入偏移
+        return static_cast<u16>(sign | (x >> 13));
+    }
+
+    static constexpr f32 Decode(u16 bits)
+    {
+        const u32 sign = static_cast<u32>(bits & 0x8000u) << 16;
+        const u32 em   = bits & 0x7FFFu;
+
+        if (em >= 0x7C00u)
+            return std::bit_cast<f32>(sign | 0x7F80'0000u | ((em & 0x3FFu) << 13));
+        if (em >= 0x0400u)
+            return std::bit_cast<f32>(sign | ((em << 13) + (112u << 23)));
+
+        const f32 subnormal = static_cast<f32>(em) * 0x1.0p-24f;
+        return std::bit_cast<f32>(sign | std::bit_cast<u32>(subnormal));
+    }
+};
+
+/**
+ * bfloat16: f32 的高 16 位，1 位符号，8 位指数，7 位尾数.
+ */
+struct BF16Codec
+{
+    /// 最近偶数舍入，NaN 保持为静默 NaN.
+    static constexpr u16 Encode(f32 value)
+    {
+        const u32 x = std::bit_cast<u32>(value);
+        if ((x & 0x7FFF'FFFFu) > 0x7F80'0000u)
+            return static_cast<u16>((x >> 16) | 0x0040u);
+        return static_cast<u16>((x + 0x7FFFu + ((x >> 16) & 1u)) >> 16);
+    }
+
+    static constexpr f32 Decode(u16 bits) { return std::bit_cast<f32>(static_cast<u32>(bits) << 16); }
+};
+
+} // namespace detail
+
+/**
+ * 16 位浮点存储类型. 只用于存储与传输: 运算时先无损提升为 f32，计算结果再以最近偶数舍入写回，
+ * 由于 f32 的精度不少于 2p + 2 位，+ - * / 的结果与直接以 16 位精度计算一致.
+ */
+template<typename Codec>
+class BasicHalf
+{
+public:
+    constexpr BasicHalf() = default;
+
+    explicit constexpr BasicHalf(f32 value) : _bits(Codec::Encode(value)) { }
+
+    explicit constexpr BasicHalf(f64 value) : _bits(Codec::Encode(detail::RoundToOddF32(value))) { }
+
+    template<cIntegralType T>
+    explicit constexpr BasicHalf(T value) : BasicHalf(static_cast<f64>(value))
+    {
+    }
+
+    SLIB_NODISCARD static constexpr BasicHalf FromBits(u16 bits)
+    {
+        BasicHalf h;
+        h._bits = bits;
+        return h;
+    }
+
+    SLIB_NODISCARD constexpr u16 bits() const { return _bits; }
+
+    /// 到 f32 的转换是精确的，因此允许隐式转换.
+    constexpr operator f32() const noexcept { return Codec::Decode(_bits); }
+
+    // clang-format off
+    friend constexpr BasicHalf operator+(BasicHalf a, BasicHalf b) { return BasicHalf(f32(a) + f32(b)); }
+    friend constexpr BasicHalf operator-(BasicHalf a, BasicHalf b) { return BasicHalf(f32(a) - f32(b)); }
+    friend constexpr BasicHalf operator*(BasicHalf a, BasicHalf b) { return BasicHalf(f32(a) * f32(b)); }
+    friend constexpr BasicHalf operator/(BasicHalf a, BasicHalf b) { return BasicHalf(f32(a) / f32(b)); }
+    friend constexpr BasicHalf operator-(BasicHalf a) { return FromBits(a._bits ^ 0x8000u); }
+
+    constexpr BasicHalf& operator+=(BasicHalf o) { return *this = *this + o; }
+    constexpr BasicHalf& operator-=(BasicHalf o) { return *this = *this - o; }
+    constexpr BasicHalf& operator*=(BasicHalf o) { return *this = *this * o; }
+    constexpr BasicHalf& operator/=(BasicHalf o) { return *this = *this / o; }
+
+    friend constexpr bool operator==(BasicHalf a, BasicHalf b) { return f32(a) == f32(b); }
+    friend constexpr std::partial_ordering operator<=>(BasicHalf a, BasicHalf b) { return f32(a) <=> f32(b); }
+    // clang-format on
+
+private:
+    u16 _bits = 0;
+};
+
+using f16  = BasicHalf<detail::F16Codec>;
+using bf16 = BasicHalf<detail::BF16Codec>;
+
+static_assert(sizeof(f16) == 2 && sizeof(bf16) == 2);
+
+template<>
+inline constexpr bool kIsExtendedArithmetic<f16> = true;
+
+template<>
+inline constexpr bool kIsExtendedArithmetic<bf16> = true;
+
+template<typename Codec>
+SLIB_FUNC constexpr BasicHalf<Codec> Abs(BasicHalf<Codec> x) noexcept
+{
+    return BasicHalf<Codec>::FromBits(x.bits() & 0x7FFFu);
+}
+
+// ==================
+// Bulk conversion
+// ==================
+
+/**
+ * 批量转换. out 的长度不得小于 in; 有 F16C / AVX2 / AVX-512 BF16 / NEON 时使用向量指令，结果与逐元素转换一致.
+ * 例外: AVX-512 BF16 的 vcvtneps2bf16 总是将非规格化的输入冲刷为 0.
+ */
+
+void ConvertF32ToF16(std::span<const f32> in, std::span<f16> out);
+void ConvertF16ToF32(std::span<const f16> in, std::span<f32> out);
+void ConvertF32ToBF16(std::span<const f32> in, std::span<bf16> out);
+void ConvertBF16ToF32(std::span<const bf16> in, std::span<f32> out);
+
+} // namespace slib
+
+// ==================
+// numeric_limits
+// ==================
+
+template<>
+class std::numeric_limits<slib::f16>
+{
+    using T = slib::f16;
+
+public:
+    static constexpr bool is_specialized    = true;
+    static constexpr bool is_signed         = true;
+    static constexpr bool is_integer        = false;
+    static constexpr bool is_exact          = false;
+    static constexpr bool has_infinity      = true;
+    static constexpr bool has_quiet_NaN     = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr bool is_iec559         = true;
+    static constexpr bool is_bounded        = true;
+    static constexpr bool is_modulo         = false;
+    static constexpr bool traps             = false;
+    static constexpr bool tinyness_before   = false;
+
+    static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+    static constexpr int digits         = 11;
+    static constexpr int digits10       = 3;
+    static constexpr int max_digits10   = 5;
+    static constexpr int radix          = 2;
+    static constexpr int min_exponent   = -13;
+    static constexpr int min_exponent10 = -4;
+    static constexpr int max_exponent   = 16;
+    static constexpr int max_exponent10 = 4;
+
+    // clang-format off
+    static constexpr T min() noexcept           { return T::FromBits(0x0400); }
+    static constexpr T max() noexcept           { return T::FromBits(0x7BFF); }
+    static constexpr T lowest() noexcept        { return T::FromBits(0xFBFF); }
+    static constexpr T epsilon() noexcept       { return T::FromBits(0x1400); }
+    static constexpr T round_error() noexcept   { return T::FromBits(0x3800); }
+    static constexpr T infinity() noexcept      { return T::FromBits(0x7C00); }
+    static constexpr T quiet_NaN() noexcept     { return T::FromBits(0x7E00); }
+    static constexpr T signaling_NaN() noexcept { return T::FromBits(0x7D00); }
+    static constexpr T denorm_min() noexcept    { return T::FromBits(0x0001); }
+    // clang-format on
+};
+
+template<>
+class std::numeric_limits<slib::bf16>
+{
+    using T = slib::bf16;
+
+public:
+    static constexpr bool is_specialized    = true;
+    static constexpr bool is_signed         = true;
+    static constexpr bool is_integer        = false;
+    static constexpr bool is_exact          = false;
+    static constexpr bool has_infinity      = true;
+    static constexpr bool has_quiet_NaN     = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr bool is_iec559         = false;
+    static constexpr bool is_bounded        = true;
+    static constexpr bool is_modulo         = false;
+    static constexpr bool traps             = false;
+    static constexpr bool tinyness_before   = false;
+
+    static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+    static constexpr int digits         = 8;
+    static constexpr int digits10       = 2;
+    static constexpr int max_digits10   = 4;
+    static constexpr int radix          = 2;
+    static constexpr int min_exponent   = -125;
+    static constexpr int min_exponent10 = -37;
+    static constexpr int max_exponent   = 128;
+    static constexpr int max_exponent10 = 38;
+
+    // clang-format off
+    static constexpr T min() noexcept           { return T::FromBits(0x0080); }
+    static constexpr T max() noexcept           { return T::FromBits(0x7F7F); }
+    static constexpr T lowest() noexcept        { return T::FromBits(0xFF7F); }
+    static constexpr T epsilon() noexcept       { return T::FromBits(0x3C00); }
+    static constexpr T round_error() noexcept   { return T::FromBits(0x3F00); }
+    static constexpr T infinity() noexcept      { return T::FromBits(0x7F80); }
+    static constexpr T quiet_NaN() noexcept     { return T::FromBits(0x7FC0); }
+    static constexpr T signaling_NaN() noexcept { return T::FromBits(0x7FA0); }
+    static constexpr T denorm_min() noexcept    { return T::FromBits(0x0001); }
+    // clang-format on
+};
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <cstring>
+#include <functional>
+
 #include <SLib/Math/Math.hpp>
 
 namespace slib {
@@ -18,4 +21,107 @@ SLIB_CONSTEXPR void HashCombine(size_t& seed, const T& val)
     seed ^= hash<T>()(val) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
 
+/**
+ * @brief 64 位整数的雪崩混合，输入的每一位都会影响输出的所有位.
+ */
+SLIB_FUNC constexpr u64 MixBits(u64 v)
+{
+    v ^= (v >> 31);
+    v *= 0x7fb5d329728ea185;
+    v ^= (v >> 27);
+    v *= 0x81dadef4bc2dd44d;
+    v ^= (v >> 33);
+    return v;
+}
+
+namespace detail {
+
+SLIB_FORCE_INLINE u64 HashRead64(const u8* p)
+{
+    u64 v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+SLIB_FORCE_INLINE u64 HashRead32(const u8* p)
+{
+    u32 v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/**
+ * @brief 64x64 -> 128 位乘法，分别返回高低两半.
+ */
+SLIB_FORCE_INLINE void Multiply128(u64& a, u64& b)
+{
+#if SLIB_COMPILER_MSVC
+    a = _umul128(a, b, &b);
+#else
+    const auto r = static_cast<unsigned __int128>(a) * b;
+    a            = static_cast<u64>(r);
+    b            = static_cast<u64>(r >> 64);
+#endif
+}
+
+SLIB_FORCE_INLINE u64 MultiplyMix(u64 a, u64 b)
+{
+    Multiply128(a, b);
+    return a ^ b;
+}
+
+} // namespace detail
+
+/**
+ * @brief 字节串的 64 位哈希 (wyhash 的结构): 每次处理 48 字节的三路 128 位乘法混合，短输入只读取首尾，
+ *        没有逐字节循环. 不用于密码学场景.
+ */
+SLIB_FORCE_INLINE u64 HashBytes(const void* data, Size size, u64 seed = 0)
+{
+    constexpr u64 kSecret[4] = {0x2d358dccaa6c78a5, 0x8bb84b93962eacc9, 0x4b33a62ed433d4a3, 0x4d5a2da51de1aa47};
+
+    const auto* p = static_cast<const u8*>(data);
+    seed         ^= detail::MultiplyMix(seed ^ kSecret[0], kSecret[1]);
+
+    u64 a = 0;
+    u64 b = 0;
+    if (SLIB_LIKELY(size <= 16)) {
+        if (size >= 4) {
+            const Size quarter = (size >> 3) << 2;
+            a                  = (detail::HashRead32(p) << 32) | detail::HashRead32(p + quarter);
+            b                  = (detail::HashRead32(p + size - 4) << 32) | detail::HashRead32(p + size - 4 - quarter);
+        }
+        else if (size > 0) {
+            a = (u64(p[0]) << 56) | (u64(p[size >> 1]) << 32) | p[size - 1];
+        }
+    }
+    else {
+        Size i = size;
+        if (i > 48) {
+            u64 see1 = seed;
+            u64 see2 = seed;
+            do {
+                seed  = detail::MultiplyMix(detail::HashRead64(p) ^ kSecret[1], detail::HashRead64(p + 8) ^ seed);
+                see1  = detail::MultiplyMix(detail::HashRead64(p + 16) ^ kSecret[2], detail::HashRead64(p + 24) ^ see1);
+                see2  = detail::MultiplyMix(detail::HashRead64(p + 32) ^ kSecret[3], detail::HashRead64(p + 40) ^ see2);
+                p    += 48;
+                i    -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed  = detail::MultiplyMix(detail::HashRead64(p) ^ kSecret[1], detail::HashRead64(p + 8) ^ seed);
+            p    += 16;
+            i    -= 16;
+        }
+        a = detail::HashRead64(p + i - 16);
+        b = detail::HashRead64(p + i - 8);
+    }
+
+    a ^= kSecret[1];
+    b ^= seed;
+    detail::Multiply128(a, b);
+    return detail::MultiplyMix(a ^ kSecret[0] ^ size, b ^ kSecret[1]);
+}
+
 } // namespace slib
\ No newline at end of file
@@ -0,0 +1,282 @@
+﻿/**
+ * @File Matrix.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <array>
+
+#include <SLib/Math/Vector.hpp>
+#include <SLib/Math/Polynomial.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * 3x3 矩阵，列主序存储: m[c] 为第 c 列，m[c][r] 为第 r 行第 c 列的元素.
+ */
+template<cFloatType T>
+struct Matrix3
+{
+    using ValueType = T;
+    using Column    = Vector3<T>;
+
+    std::array<Column, 3> m{};
+
+    constexpr Matrix3() = default;
+
+    constexpr explicit Matrix3(T diagonal) : m{Column(diagonal, 0, 0), Column(0, diagonal, 0), Column(0, 0, diagonal)} { }
+
+    constexpr Matrix3(const Column& c0, const Column& c1, const Column& c2) : m{c0, c1, c2} { }
+
+    SLIB_NODISCARD static constexpr Matrix3 Identity() { return Matrix3(T(1)); }
+
+    constexpr Column& operator[](Size c) { return m[c]; }
+
+    constexpr const Column& operator[](Size c) const { return m[c]; }
+
+    friend constexpr bool operator==(const Matrix3&, const Matrix3&) = default;
+};
+
+/**
+ * 4x4 矩阵，列主序存储，约定与 Matrix3 相同. 作用于列向量: p' = M * p.
+ */
+template<cFloatType T>
+struct Matrix4
+{
+    using ValueType = T;
+    using Column    = Vector4<T>;
+
+    std::array<Column, 4> m{};
+
+    constexpr Matrix4() = default;
+
+    constexpr explicit Matrix4(T diagonal)
+        : m{Column(diagonal, 0, 0, 0), Column(0, diagonal, 0, 0), Column(0, 0, diagonal, 0), Column(0, 0, 0, diagonal)}
+    {
+    }
+
+    constexpr Matrix4(const Column& c0, const Column& c1, const Column& c2, const Column& c3) : m{c0, c1, c2, c3} { }
+
+    constexpr explicit Matrix4(const Matrix3<T>& r, const Vector3<T>& t = {})
+        : m{Column(r[0], 0), Column(r[1], 0), Column(r[2], 0), Column(t, 1)}
+    {
+    }
+
+    SLIB_NODISCARD static constexpr Matrix4 Identity() { return Matrix4(T(1)); }
+
+    constexpr Column& operator[](Size c) { return m[c]; }
+
+    constexpr const Column& operator[](Size c) const { return m[c]; }
+
+    friend constexpr bool operator==(const Matrix4&, const Matrix4&) = default;
+};
+
+using Mat3 = Matrix3<Float>;
+using Mat4 = Matrix4<Float>;
+
+using Mat3f = Matrix3<f32>;
+using Mat4f = Matrix4<f32>;
+
+using Mat3d = Matrix3<f64>;
+using Mat4d = Matrix4<f64>;
+
+// ==================
+// Products
+// ==================
+
+template<cFloatType T>
+SLIB_FUNC constexpr Vector3<T> operator*(const Matrix3<T>& a, const Vector3<T>& v)
+{
+    return a[0] * v.x + a[1] * v.y + a[2] * v.z;
+}
+
+template<cFloatType T>
+SLIB_FUNC constexpr Vector4<T> operator*(const Matrix4<T>& a, const Vector4<T>& v)
+{
+    return a[0] * v.x + a[1] * v.y + a[2] * v.z + a[3] * v.w;
+}
+
+template<cFloatType T>
+SLIB_FUNC constexpr Matrix3<T> operator*(const Matrix3<T>& a, const Matrix3<T>& b)
+{
+    return {a * b[0], a * b[1], a * b[2]};
+}
+
+template<cFloatType T>
+SLIB_FUNC constexpr Matrix4<T> operator*(const Matrix4<T>& a, const Matrix4<T>& b)
+{
+    return {a * b[0], a * b[1], a * b[2], a * b[3]};
+}
+
+/**
+ * @brief 变换点 (w = 1)，仿射矩阵下不做透视除法.
+ */
+template<cFloatType T>
+SLIB_FUNC constexpr Vector3<T> TransformPoint(const Matrix4<T>& a, const Vector3<T>& p)
+{
+    return (a[0] * p.x + a[1] * p.y + a[2] * p.z + a[3]).xyz();
+}
+
+/**
+ * @brief 变换方向 (w = 0)，不受平移影响.
+ */
+template<cFloatType T>
+SLIB_FUNC constexpr Vector3<T> TransformVector(const Matrix4<T>& a, const Vector3<T>& v)
+{
+    return (a[0] * v.x + a[1] * v.y + a[2] * v.z).xyz();
+}
+
+// ==================
+// Transpose / Determinant / Inverse
+// ==================
+
+template<cFloatType T>
+SLIB_FUNC constexpr Matrix3<T> Transpose(const Matrix3<T>& a)
+{
+    return {{a[0].x, a[1].x, a[2].x}, {a[0].y, a[1].y, a[2].y}, {a[0].z, a[1].z, a[2].z}};
+}
+
+template<cFloatType T>
+SLIB_FUNC constexpr Matrix4<T> Transpose(const Matrix4<T>& a)
+{
+    return {{a[0].x, a[1].x, a[2].x, a[3].x},
+            {a[0].y, a[1].y, a[2].y, a[3].y},
+            {a[0].z, a[1].z, a[2].z, a[3].z},
+            {a[0].w, a[1].w, a[2].w, a[3].w}};
+}
+
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR T Determinant(const Matrix3<T>& a)
+{
+    return Dot(a[0], Cross(a[1], a[2]));
+}
+
+/**
+ * @brief 3x3 逆矩阵 (伴随矩阵法)，奇异时返回 std::nullopt.
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Opt<Matrix3<T>> Inverse(const Matrix3<T>& a)
+{
+    const Vector3<T> r0 = Cross(a[1], a[2]);
+    const Vector3<T> r1 = Cross(a[2], a[0]);
+    const Vector3<T> r2 = Cross(a[0], a[1]);
+
+    const T det = Dot(a[0], r0);
+    if (det == 0)
+        return std::nullopt;
+
+    const T invDet = T(1) / det;
+    return Transpose(Matrix3<T>(r0 * invDet, r1 * invDet, r2 * invDet));
+}
+
+namespace detail {
+
+/**
+ * 4x4 矩阵按上两行与下两行的 2x2 子式做 Laplace 展开，子式均用 DifferenceOfProducts 计算.
+ */
+template<cFloatType T>
+struct Matrix4Minors
+{
+    std::array<T, 6> s; ///< 第 0、1 行的子式
+    std::array<T, 6> c; ///< 第 2、3 行的子式
+    T det;
+
+    explicit Matrix4Minors(const Matrix4<T>& a)
+    {
+        // e(r, c) 为第 r 行第 c 列的元素
+        auto e = [&a](Size r, Size col) { return a[col][r]; };
+
+        s = {DifferenceOfProducts(e(0, 0), e(1, 1), e(1, 0), e(0, 1)), DifferenceOfProducts(e(0, 0), e(1, 2), e(1, 0), e(0, 2)),
+             DifferenceOfProducts(e(0, 0), e(1, 3), e(1, 0), e(0, 3)), DifferenceOfProducts(e(0, 1), e(1, 2), e(1, 1), e(0, 2)),
+             DifferenceOfProducts(e(0, 1), e(1, 3), e(1, 1), e(0, 3)), DifferenceOfProducts(e(0, 2), e(1, 3), e(1, 2), e(0, 3))};
+        c = {DifferenceOfProducts(e(2, 0), e(3, 1), e(3, 0), e(2, 1)), DifferenceOfProducts(e(2, 0), e(3, 2), e(3, 0), e(2, 2)),
+             DifferenceOfProducts(e(2, 0), e(3, 3), e(3, 0), e(2, 3)), DifferenceOfProducts(e(2, 1), e(3, 2), e(3, 1), e(2, 2)),
+             DifferenceOfProducts(e(2, 1), e(3, 3), e(3, 1), e(2, 3)), DifferenceOfProducts(e(2, 2), e(3, 3), e(3, 2), e(2, 3))};
+        det = DifferenceOfProducts(s[0], c[5], s[1], c[4]) + DifferenceOfProducts(s[2], c[3], -s[3], c[2]) +
+              DifferenceOfProducts(s[5], c[0], s[4], c[1]);
+    }
+};
+
+} // namespace detail
+
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR T Determinant(const Matrix4<T>& a)
+{
+    return detail::Matrix4Minors<T>(a).det;
+}
+
+/**
+ * @brief 4x4 逆矩阵 (伴随矩阵法)，奇异时返回 std::nullopt.
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Opt<Matrix4<T>> Inverse(const Matrix4<T>& a)
+{
+    const detail::Matrix4Minors<T> minors(a);
+    if (minors.det == 0)
+        return std::nullopt;
+
+    const auto& [s0, s1, s2, s3, s4, s5] = minors.s;
+    const auto& [c0, c1, c2, c3, c4, c5] = minors.c;
+
+    const T s = T(1) / minors.det;
+    auto e    = [&a](Size r, Size col) { return a[col][r]; };
+
+    Matrix4<T> inv;
+    auto set = [&inv, s](Size r, Size col, T v) { inv[col][r] = s * v; };
+
+    set(0, 0, e(1, 1) * c5 + e(1, 3) * c3 - e(1, 2) * c4);
+    set(0, 1, -e(0, 1) * c5 + e(0, 2) * c4 - e(0, 3) * c3);
+    set(0, 2, e(3, 1) * s5 + e(3, 3) * s3 - e(3, 2) * s4);
+    set(0, 3, -e(2, 1) * s5 + e(2, 2) * s4 - e(2, 3) * s3);
+    set(1, 0, -e(1, 0) * c5 + e(1, 2) * c2 - e(1, 3) * c1);
+    set(1, 1, e(0, 0) * c5 + e(0, 3) * c1 - e(0, 2) * c2);
+    set(1, 2, -e(3, 0) * s5 + e(3, 2) * s2 - e(3, 3) * s1);
+    set(1, 3, e(2, 0) * s5 + e(2, 3) * s1 - e(2, 2) * s2);
+    set(2, 0, e(1, 0) * c4 + e(1, 3) * c0 - e(1, 1) * c2);
+    set(2, 1, -e(0, 0) * c4 + e(0, 1) * c2 - e(0, 3) * c0);
+    set(2, 2, e(3, 0) * s4 + e(3, 3) * s0 - e(3, 1) * s2);
+    set(2, 3, -e(2, 0) * s4 + e(2, 1) * s2 - e(2, 3) * s0);
+    set(3, 0, -e(1, 0) * c3 + e(1, 1) * c1 - e(1, 2) * c0);
+    set(3, 1, e(0, 0) * c3 + e(0, 2) * c0 - e(0, 1) * c1);
+    set(3, 2, -e(3, 0) * s3 + e(3, 1) * s1 - e(3, 2) * s0);
+    set(3, 3, e(2, 0) * s3 + e(2, 2) * s0 - e(2, 1) * s1);
+    return inv;
+}
+
+// ==================
+// Affine transforms
+// ==================
+
+template<cFloatType T>
+SLIB_FUNC constexpr Matrix4<T> Translate(const Vector3<T>& t)
+{
+    return Matrix4<T>(Matrix3<T>::Identity(), t);
+}
+
+template<cFloatType T>
+SLIB_FUNC constexpr Matrix4<T> Scale(const Vector3<T>& s)
+{
+    return Matrix4<T>(Matrix3<T>({s.x, 0, 0}, {0, s.y, 0}, {0, 0, s.z}));
+}
+
+/**
+ * @brief 绕单位轴 axis 旋转 theta 弧度 (右手定则).
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Matrix3<T> Rotate(T theta, const Vector3<T>& axis)
+{
+    const T s = Sin(theta);
+    const T c = Cos(theta);
+    const T t = 1 - c;
+
+    const Vector3<T>& a = axis;
+    return {{t * a.x * a.x + c, t * a.x * a.y + s * a.z, t * a.x * a.z - s * a.y},
+            {t * a.x * a.y - s * a.z, t * a.y * a.y + c, t * a.y * a.z + s * a.x},
+            {t * a.x * a.z + s * a.y, t * a.y * a.z - s * a.x, t * a.z * a.z + c}};
+}
+
+} // namespace slib
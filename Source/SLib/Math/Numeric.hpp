@@ -90,6 +90,12 @@ using Float     = f32;
 using FloatBits = u32;
 #endif // SLIB_DOUBLE_PRECISION
 
+/**
+ * @brief 扩展算术类型 (如 f16、Fixed) 通过特化此变量并特化 numeric_limits 加入下列算术概念.
+ */
+template<typename T>
+inline constexpr bool kIsExtendedArithmetic = false;
+
 // clang-format off
 template<typename T> concept cBoolType = std::is_same_v<bool, T>;
 template<typename T> concept cU32Type  = std::is_same_v<u32, T>;
@@ -97,11 +103,11 @@ template<typename T> concept cU64Type  = std::is_same_v<u64, T>;
 template<typename T> concept cF32Type  = std::is_same_v<f32, T>;
 template<typename T> concept cF64Type  = std::is_same_v<f64, T>;
 
-template<typename T> concept cSignedType     = std::is_signed_v<T>;
-template<typename T> concept cUnsignedType   = std::is_unsigned_v<T>;
+template<typename T> concept cSignedType     = std::is_signed_v<T> or (kIsExtendedArithmetic<T> and numeric_limits<T>::is_signed);
+template<typename T> concept cUnsignedType   = std::is_unsigned_v<T> or (kIsExtendedArithmetic<T> and not numeric_limits<T>::is_signed);
 template<typename T> concept cIntegralType   = std::is_integral_v<T>;
 template<typename T> concept cFloatType      = std::is_floating_point_v<T>;
-template<typename T> concept cArithmeticType = std::is_arithmetic_v<T>;
+template<typename T> concept cArithmeticType = std::is_arithmetic_v<T> or kIsExtendedArithmetic<T>;
 // clang-format on
 
 template<typename T, typename U>
@@ -11,6 +11,7 @@
 
 #include <SLib/Math/Math.hpp>
 #include <SLib/Math/Constant.hpp>
+#include <SLib/Math/Common.hpp>
 
 namespace slib {
 
@@ -79,6 +80,44 @@ SLIB_FUNC SLIB_CONSTEXPR auto SumOfProducts(Ta a, Tb b, Tc c, Td d)
     return sop + error;
 }
 
+/**
+ * @brief 无误差变换: a + b = sum + err，sum 为舍入后的和 (Knuth TwoSum，无分支).
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR T TwoSum(T a, T b, T& err)
+{
+    const T sum = a + b;
+    const T z   = sum - a;
+    err         = (a - (sum - z)) + (b - z);
+    return sum;
+}
+
+/**
+ * @brief 无误差变换: a * b = prod + err. 有硬件 FMA 时只需一条 FMA，否则使用 Dekker 拆分.
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR T TwoProd(T a, T b, T& err)
+{
+    const T prod = a * b;
+#if SLIB_HAS_FMA
+    err = FMA(a, b, -prod);
+#else
+    constexpr T kSplitter = sizeof(T) == 4 ? T(4097) : T(134217729); // 2^12 + 1, 2^27 + 1
+
+    auto split = [](T x, T& hi, T& lo) {
+        const T c = kSplitter * x;
+        hi        = c - (c - x);
+        lo        = x - hi;
+    };
+
+    T aHi, aLo, bHi, bLo;
+    split(a, aHi, aLo);
+    split(b, bHi, bLo);
+    err = ((aHi * bHi - prod) + aHi * bLo + aLo * bHi) + aLo * bLo;
+#endif
+    return prod;
+}
+
 template<cFloatType T>
 SLIB_FUNC bool Quadratic(T a, T b, T c, T* t0, T* t1)
 {
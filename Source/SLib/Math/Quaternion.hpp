@@ -0,0 +1,161 @@
+﻿/**
+ * @File Quaternion.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <SLib/Math/Matrix.hpp>
+
+namespace slib {
+
+/**
+ * 四元数 q = w + (x, y, z)，单位四元数表示旋转.
+ */
+template<cFloatType T>
+struct Quaternion
+{
+    using ValueType = T;
+
+    Vector3<T> v{};
+    T w = 1;
+
+    constexpr Quaternion() = default;
+
+    constexpr Quaternion(const Vector3<T>& v_, T w_) : v(v_), w(w_) { }
+
+    SLIB_NODISCARD static constexpr Quaternion Identity() { return {}; }
+
+    /**
+     * @brief 绕单位轴 axis 旋转 theta 弧度.
+     */
+    SLIB_NODISCARD static SLIB_CONSTEXPR Quaternion FromAxisAngle(const Vector3<T>& axis, T theta)
+    {
+        const T half = theta * T(0.5);
+        return {axis * Sin(half), Cos(half)};
+    }
+
+    friend constexpr bool operator==(const Quaternion&, const Quaternion&) = default;
+};
+
+using Quat  = Quaternion<Float>;
+using Quatf = Quaternion<f32>;
+using Quatd = Quaternion<f64>;
+
+// clang-format off
+template<cFloatType T> constexpr Quaternion<T> operator+(const Quaternion<T>& a, const Quaternion<T>& b) { return {a.v + b.v, a.w + b.w}; }
+template<cFloatType T> constexpr Quaternion<T> operator-(const Quaternion<T>& a, const Quaternion<T>& b) { return {a.v - b.v, a.w - b.w}; }
+template<cFloatType T> constexpr Quaternion<T> operator-(const Quaternion<T>& a)                         { return {-a.v, -a.w}; }
+template<cFloatType T> constexpr Quaternion<T> operator*(const Quaternion<T>& a, T s)                    { return {a.v * s, a.w * s}; }
+template<cFloatType T> constexpr Quaternion<T> operator*(T s, const Quaternion<T>& a)                    { return a * s; }
+template<cFloatType T> constexpr Quaternion<T> operator/(const Quaternion<T>& a, T s)                    { return {a.v / s, a.w / s}; }
+// clang-format on
+
+/**
+ * @brief Hamilton 积，a * b 表示先应用 b 再应用 a.
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Quaternion<T> operator*(const Quaternion<T>& a, const Quaternion<T>& b)
+{
+    return {Cross(a.v, b.v) + a.v * b.w + b.v * a.w, a.w * b.w - Dot(a.v, b.v)};
+}
+
+template<cFloatType T>
+SLIB_FUNC constexpr T Dot(const Quaternion<T>& a, const Quaternion<T>& b)
+{
+    return Dot(a.v, b.v) + a.w * b.w;
+}
+
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR T Length(const Quaternion<T>& q)
+{
+    return Sqrt(Dot(q, q));
+}
+
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Quaternion<T> Normalize(const Quaternion<T>& q)
+{
+    return q / Length(q);
+}
+
+template<cFloatType T>
+SLIB_FUNC constexpr Quaternion<T> Conjugate(const Quaternion<T>& q)
+{
+    return {-q.v, q.w};
+}
+
+/**
+ * @brief 用单位四元数旋转向量: v' = v + 2w(u × v) + 2u × (u × v)，比 q v q* 少约一半乘法.
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Vector3<T> Rotate(const Quaternion<T>& q, const Vector3<T>& p)
+{
+    const Vector3<T> t = Cross(q.v, p) * T(2);
+    return p + t * q.w + Cross(q.v, t);
+}
+
+/**
+ * @brief 球面线性插值，总是沿较短的弧插值; 两者接近时退化为归一化线性插值以避免除以 sin(θ) ≈ 0.
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Quaternion<T> Slerp(const Quaternion<T>& a, Quaternion<T> b, T t)
+{
+    T cosTheta = Dot(a, b);
+    if (cosTheta < 0) {
+        b        = -b;
+        cosTheta = -cosTheta;
+    }
+
+    if (cosTheta > T(0.9995))
+        return Normalize(a * (1 - t) + b * t);
+
+    const T theta    = ACos(cosTheta);
+    const T sinTheta = Sin(theta);
+    return (a * Sin((1 - t) * theta) + b * Sin(t * theta)) / sinTheta;
+}
+
+/**
+ * @brief 单位四元数对应的旋转矩阵.
+ */
+template<cFloatType T>
+SLIB_FUNC constexpr Matrix3<T> ToMatrix(const Quaternion<T>& q)
+{
+    const T x = q.v.x, y = q.v.y, z = q.v.z, w = q.w;
+    const T xx = x * x, yy = y * y, zz = z * z;
+    const T xy = x * y, xz = x * z, yz = y * z;
+    const T wx = w * x, wy = w * y, wz = w * z;
+
+    return {{1 - 2 * (yy + zz), 2 * (xy + wz), 2 * (xz - wy)},
+            {2 * (xy - wz), 1 - 2 * (xx + zz), 2 * (yz + wx)},
+            {2 * (xz + wy), 2 * (yz - wx), 1 - 2 * (xx + yy)}};
+}
+
+/**
+ * @brief 由旋转矩阵构造单位四元数 (Shepperd 方法，按最大对角分量选择分支以保证数值稳定).
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Quaternion<T> FromMatrix(const Matrix3<T>& m)
+{
+    // e(r, c) 为第 r 行第 c 列的元素
+    auto e = [&m](Size r, Size c) { return m[c][r]; };
+
+    const T trace = e(0, 0) + e(1, 1) + e(2, 2);
+    if (trace > 0) {
+        const T s = Sqrt(trace + 1) * 2;
+        return {{(e(2, 1) - e(1, 2)) / s, (e(0, 2) - e(2, 0)) / s, (e(1, 0) - e(0, 1)) / s}, s / 4};
+    }
+    if (e(0, 0) > e(1, 1) && e(0, 0) > e(2, 2)) {
+        const T s = Sqrt(1 + e(0, 0) - e(1, 1) - e(2, 2)) * 2;
+        return {{s / 4, (e(0, 1) + e(1, 0)) / s, (e(0, 2) + e(2, 0)) / s}, (e(2, 1) - e(1, 2)) / s};
+    }
+    if (e(1, 1) > e(2, 2)) {
+        const T s = Sqrt(1 + e(1, 1) - e(0, 0) - e(2, 2)) * 2;
+        return {{(e(0, 1) + e(1, 0)) / s, s / 4, (e(1, 2) + e(2, 1)) / s}, (e(0, 2) - e(2, 0)) / s};
+    }
+    const T s = Sqrt(1 + e(2, 2) - e(0, 0) - e(1, 1)) * 2;
+    return {{(e(0, 2) + e(2, 0)) / s, (e(1, 2) + e(2, 1)) / s, s / 4}, (e(1, 0) - e(0, 1)) / s};
+}
+
+} // namespace slib
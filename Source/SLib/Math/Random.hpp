@@ -0,0 +1,524 @@
+﻿/**
+ * @File Random.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <array>
+#include <random>
+#include <span>
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/Math/Bits.hpp>
+
+namespace slib {
+
+template<typename G>
+concept cRandomGenerator = std::uniform_random_bit_generator<G> and (std::is_same_v<typename G::result_type, u32> or
+                                                                     std::is_same_v<typename G::result_type, u64>);
+
+// ==================
+// Generators
+// ==================
+
+/**
+ * @brief SplitMix64, 主要用于把一个 64 位种子扩展成其他生成器的状态.
+ */
+class SplitMix64
+{
+public:
+    using result_type = u64;
+
+    constexpr explicit SplitMix64(u64 seed = 0) noexcept : _state(seed) { }
+
+    static constexpr result_type min() noexcept { return 0; }
+
+    static constexpr result_type max() noexcept { return numeric_limits<u64>::max(); }
+
+    constexpr result_type operator()() noexcept
+    {
+        u64 z = (_state += 0x9E37'79B9'7F4A'7C15ull);
+        z     = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9ull;
+        z     = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EBull;
+        return z ^ (z >> 31);
+    }
+
+private:
+    u64 _state;
+};
+
+/**
+ * @brief PCG32 (XSH-RR 64/32), 16 字节状态，不同 stream 之间的序列互不相关.
+ */
+class PCG32
+{
+public:
+    using result_type = u32;
+
+    static constexpr u64 kDefaultState  = 0x853C'49E6'748F'EA9Bull;
+    static constexpr u64 kDefaultStream = 0xDA3E'39CB'94B9'5BDBull;
+    static constexpr u64 kMultiplier    = 0x5851'F42D'4C95'7F2Dull;
+
+    constexpr PCG32() noexcept = default;
+
+    constexpr explicit PCG32(u64 seed, u64 stream = 1) noexcept { this->seed(seed, stream); }
+
+    constexpr void seed(u64 seed, u64 stream = 1) noexcept
+    {
+        _state = 0;
+        _inc   = (stream << 1) | 1;
+        (*this)();
+        _state += seed;
+        (*this)();
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+
+    static constexpr result_type max() noexcept { return numeric_limits<u32>::max(); }
+
+    constexpr result_type operator()() noexcept
+    {
+        const u64 old = _state;
+        _state        = old * kMultiplier + _inc;
+        const u32 xorShifted = static_cast<u32>(((old >> 18) ^ old) >> 27);
+        const u32 rot        = static_cast<u32>(old >> 59);
+        return (xorShifted >> rot) | (xorShifted << ((~rot + 1) & 31));
+    }
+
+    /**
+     * @brief 以 O(log n) 的代价前进（或后退）delta 步.
+     */
+    constexpr void advance(i64 delta) noexcept
+    {
+        u64 curMult = kMultiplier, curPlus = _inc;
+        u64 accMult = 1, accPlus = 0;
+        for (u64 d = static_cast<u64>(delta); d > 0; d >>= 1) {
+            if (d & 1) {
+                accMult *= curMult;
+                accPlus  = accPlus * curMult + curPlus;
+            }
+            curPlus = (curMult + 1) * curPlus;
+            curMult *= curMult;
+        }
+        _state = accMult * _state + accPlus;
+    }
+
+    constexpr void discard(u64 n) noexcept { advance(static_cast<i64>(n)); }
+
+private:
+    u64 _state = kDefaultState;
+    u64 _inc   = kDefaultStream;
+};
+
+/**
+ * @brief xoshiro256**, 32 字节状态的通用 64 位生成器.
+ */
+class Xoshiro256SS
+{
+public:
+    using result_type = u64;
+
+    constexpr explicit Xoshiro256SS(u64 seed = 0) noexcept { this->seed(seed); }
+
+    constexpr void seed(u64 seed) noexcept
+    {
+        SplitMix64 sm(seed);
+        for (auto& s : _s)
+            s = sm();
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+
+    static constexpr result_type max() noexcept { return numeric_limits<u64>::max(); }
+
+    constexpr result_type operator()() noexcept
+    {
+        const u64 result = std::rotl(_s[1] * 5, 7) * 9;
+        const u64 t      = _s[1] << 17;
+
+        _s[2] ^= _s[0];
+        _s[3] ^= _s[1];
+        _s[1] ^= _s[2];
+        _s[0] ^= _s[3];
+        _s[2] ^= t;
+        _s[3]  = std::rotl(_s[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief 前进 2^128 步，用于切分出互不重叠的并行序列.
+     */
+    constexpr void jump() noexcept
+    {
+        constexpr u64 kJump[] = {0x180E'C6D3'3CFD'0ABAull, 0xD5A6'1266'F0C9'392Cull, 0xA958'2618'E03F'C9AAull, 0x39AB'DC45'29B1'661Cull};
+
+        std::array<u64, 4> s{};
+        for (const u64 j : kJump) {
+            for (int b = 0; b < 64; ++b) {
+                if (j & (1ull << b)) {
+                    for (int k = 0; k < 4; ++k)
+                        s[k] ^= _s[k];
+                }
+                (*this)();
+            }
+        }
+        _s = s;
+    }
+
+    constexpr const std::array<u64, 4>& state() const noexcept { return _s; }
+
+private:
+    std::array<u64, 4> _s{};
+};
+
+/**
+ * @brief Philox4x32-10 计数器生成器: 输出只由 (key, counter) 决定.
+ *
+ * 不同线程使用不同的 key 或不相交的 counter 区间即可得到可复现的并行随机流，
+ * 也可以直接用 block() 对任意位置随机访问.
+ */
+class Philox4x32
+{
+public:
+    using result_type = u32;
+    using Block       = std::array<u32, 4>;
+
+    constexpr explicit Philox4x32(u64 key = 0, u64 counter = 0) noexcept
+    : _key{static_cast<u32>(key), static_cast<u32>(key >> 32)}, _counter(counter) { }
+
+    static constexpr result_type min() noexcept { return 0; }
+
+    static constexpr result_type max() noexcept { return numeric_limits<u32>::max(); }
+
+    constexpr result_type operator()() noexcept
+    {
+        if (_index == 4) {
+            _buffer = block(_counter++);
+            _index  = 0;
+        }
+        return _buffer[_index++];
+    }
+
+    /**
+     * @brief 计算第 counter 个 128 位输出块.
+     */
+    constexpr Block block(u64 counter) const noexcept
+    {
+        constexpr u32 kM0 = 0xD251'1F53, kM1 = 0xCD9E'8D57;
+        constexpr u32 kW0 = 0x9E37'79B9, kW1 = 0xBB67'AE85;
+
+        Block c = {static_cast<u32>(counter), static_cast<u32>(counter >> 32), 0, 0};
+        u32 k0 = _key[0], k1 = _key[1];
+        for (int round = 0; round < 10; ++round) {
+            const u64 p0 = static_cast<u64>(kM0) * c[0];
+            const u64 p1 = static_cast<u64>(kM1) * c[2];
+            c            = {static_cast<u32>(p1 >> 32) ^ c[1] ^ k0, static_cast<u32>(p1), static_cast<u32>(p0 >> 32) ^ c[3] ^ k1,
+                            static_cast<u32>(p0)};
+            k0          += kW0;
+            k1          += kW1;
+        }
+        return c;
+    }
+
+    constexpr void setCounter(u64 counter) noexcept
+    {
+        _counter = counter;
+        _index   = 4;
+    }
+
+    constexpr u64 counter() const noexcept { return _counter; }
+
+    constexpr void discard(u64 n) noexcept
+    {
+        const u64 pending = 4 - _index;
+        if (n < pending) {
+            _index += static_cast<u32>(n);
+            return;
+        }
+        n        -= pending;
+        _counter += n / 4;
+        _index    = 4;
+        if (n % 4) {
+            (*this)();
+            _index = static_cast<u32>(n % 4);
+        }
+    }
+
+    /**
+     * @brief 按块直接写出，不经过内部缓冲区.
+     */
+    constexpr void fill(std::span<u32> out) noexcept
+    {
+        Size i = 0;
+        while (i < out.size() && _index < 4)
+            out[i++] = _buffer[_index++];
+
+        for (; i + 4 <= out.size(); i += 4) {
+            const Block b = block(_counter++);
+            for (int k = 0; k < 4; ++k)
+                out[i + k] = b[k];
+        }
+
+        while (i < out.size())
+            out[i++] = (*this)();
+    }
+
+private:
+    std::array<u32, 2> _key;
+    u64 _counter;
+    Block _buffer{};
+    u32 _index = 4;
+};
+
+static_assert(std::uniform_random_bit_generator<SplitMix64>);
+static_assert(std::uniform_random_bit_generator<PCG32>);
+static_assert(std::uniform_random_bit_generator<Xoshiro256SS>);
+static_assert(std::uniform_random_bit_generator<Philox4x32>);
+
+// ==================
+// Distributions
+// ==================
+
+template<cRandomGenerator G>
+SLIB_FORCE_INLINE u32 Next32(G& g)
+{
+    if constexpr (sizeof(typename G::result_type) == 4)
+        return g();
+    else
+        return static_cast<u32>(g() >> 32);
+}
+
+template<cRandomGenerator G>
+SLIB_FORCE_INLINE u64 Next64(G& g)
+{
+    if constexpr (sizeof(typename G::result_type) == 8) {
+        return g();
+    }
+    else {
+        const u64 hi = g();
+        return (hi << 32) | g();
+    }
+}
+
+/**
+ * @brief [0, bound) 内的无偏整数 (Lemire 乘法取高位法)，绝大多数情况下不需要除法.
+ */
+template<cRandomGenerator G>
+SLIB_FUNC u32 UniformBounded(G& g, u32 bound)
+{
+    u64 m = static_cast<u64>(Next32(g)) * bound;
+    if (static_cast<u32>(m) < bound) {
+        const u32 threshold = (0u - bound) % bound;
+        while (static_cast<u32>(m) < threshold)
+            m = static_cast<u64>(Next32(g)) * bound;
+    }
+    return static_cast<u32>(m >> 32);
+}
+
+template<cRandomGenerator G>
+SLIB_FUNC u64 UniformBounded(G& g, u64 bound)
+{
+    u64 x  = Next64(g);
+    u64 lo = x * bound;
+    if (lo < bound) {
+        const u64 threshold = (0ull - bound) % bound;
+        while (lo < threshold) {
+            x  = Next64(g);
+            lo = x * bound;
+        }
+    }
+    return MulHi64(x, bound);
+}
+
+/**
+ * @brief 闭区间 [lo, hi] 内的无偏整数.
+ */
+template<cIntegralType T, cRandomGenerator G>
+SLIB_FUNC T UniformInt(G& g, T lo, T hi)
+{
+    using U = std::make_unsigned_t<T>;
+    using W = std::conditional_t<(sizeof(T) > 4), u64, u32>;
+
+    // count 为 0 表示覆盖了 W 的全部取值
+    const W count  = static_cast<W>(static_cast<U>(static_cast<U>(hi) - static_cast<U>(lo))) + 1;
+    const W offset = count != 0 ? UniformBounded(g, count) : sizeof(W) == 8 ? static_cast<W>(Next64(g)) : static_cast<W>(Next32(g));
+    return static_cast<T>(static_cast<U>(lo) + static_cast<U>(offset));
+}
+
+/**
+ * @brief [0, 1) 内的浮点数，取最高的尾数位数个随机位.
+ */
+template<cFloatType T, cRandomGenerator G>
+SLIB_FUNC T UniformFloat(G& g)
+{
+    if constexpr (sizeof(T) == 4)
+        return static_cast<f32>(Next32(g) >> 8) * 0x1.0p-24f;
+    else
+        return static_cast<f64>(Next64(g) >> 11) * 0x1.0p-53;
+}
+
+template<cFloatType T, cRandomGenerator G>
+SLIB_FUNC T UniformFloat(G& g, T lo, T hi)
+{
+    return lo + (hi - lo) * UniformFloat<T>(g);
+}
+
+// ==================
+// Batch
+// ==================
+
+template<cRandomGenerator G>
+void Fill(G& g, std::span<typename G::result_type> out)
+{
+    if constexpr (requires { g.fill(out); }) {
+        g.fill(out);
+    }
+    else {
+        for (auto& v : out)
+            v = g();
+    }
+}
+
+template<cFloatType T, cRandomGenerator G>
+void FillUniform(G& g, std::span<T> out)
+{
+    if constexpr (requires { g.fillUniform(out); }) {
+        g.fillUniform(out);
+    }
+    else {
+        for (auto& v : out)
+            v = UniformFloat<T>(g);
+    }
+}
+
+/**
+ * @brief 4 条交错的 xoshiro256** 序列，状态按 SoA 排列.
+ *
+ * 第 i 条序列是第 0 条序列 jump() i 次后的结果，4 条序列在一次 AVX2 迭代中同时推进;
+ * xoshiro256** 的 *5 与 *9 可以写成移位加法，因此不需要 64 位向量乘法.
+ * 输出顺序固定为 lane 0..3 轮流，与是否启用 SIMD 无关.
+ */
+class Xoshiro256SSx4
+{
+public:
+    using result_type = u64;
+
+    static constexpr Size kLanes = 4;
+
+    explicit Xoshiro256SSx4(u64 seed = 0) noexcept
+    {
+        Xoshiro256SS g(seed);
+        for (Size lane = 0; lane < kLanes; ++lane) {
+            for (Size k = 0; k < 4; ++k)
+                _s[k][lane] = g.state()[k];
+            g.jump();
+        }
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+
+    static constexpr result_type max() noexcept { return numeric_limits<u64>::max(); }
+
+    result_type operator()() noexcept
+    {
+        if (_index == kLanes) {
+            next(_buffer.data());
+            _index = 0;
+        }
+        return _buffer[_index++];
+    }
+
+    void fill(std::span<u64> out) noexcept
+    {
+        Size i = 0;
+        while (i < out.size() && _index < kLanes)
+            out[i++] = _buffer[_index++];
+
+        for (; i + kLanes <= out.size(); i += kLanes)
+            next(out.data() + i);
+
+        while (i < out.size())
+            out[i++] = (*this)();
+    }
+
+    void fillUniform(std::span<f32> out) noexcept
+    {
+        // 每个 64 位输出拆成两个 24 位尾数
+        alignas(32) std::array<u64, kLanes> block;
+        Size i = 0;
+        for (; i + 2 * kLanes <= out.size(); i += 2 * kLanes) {
+            next(block.data());
+            for (Size k = 0; k < kLanes; ++k) {
+                out[i + 2 * k]     = static_cast<f32>(block[k] >> 40) * 0x1.0p-24f;
+                out[i + 2 * k + 1] = static_cast<f32>((block[k] >> 8) & 0xFF'FFFF) * 0x1.0p-24f;
+            }
+        }
+        for (; i < out.size(); ++i)
+            out[i] = UniformFloat<f32>(*this);
+    }
+
+    void fillUniform(std::span<f64> out) noexcept
+    {
+        alignas(32) std::array<u64, kLanes> block;
+        Size i = 0;
+        for (; i + kLanes <= out.size(); i += kLanes) {
+            next(block.data());
+            for (Size k = 0; k < kLanes; ++k)
+                out[i + k] = static_cast<f64>(block[k] >> 11) * 0x1.0p-53;
+        }
+        for (; i < out.size(); ++i)
+            out[i] = UniformFloat<f64>(*this);
+    }
+
+private:
+    void next(u64* out) noexcept
+    {
+#if SLIB_HAS_AVX2
+        auto load  = [this](Size k) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(_s[k].data())); };
+        auto rotl  = [](__m256i x, int k) { return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k)); };
+        __m256i s0 = load(0), s1 = load(1), s2 = load(2), s3 = load(3);
+
+        const __m256i x5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+        const __m256i r  = rotl(x5, 7);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_add_epi64(_mm256_slli_epi64(r, 3), r));
+
+        const __m256i t = _mm256_slli_epi64(s1, 17);
+        s2              = _mm256_xor_si256(s2, s0);
+        s3              = _mm256_xor_si256(s3, s1);
+        s1              = _mm256_xor_si256(s1, s2);
+        s0              = _mm256_xor_si256(s0, s3);
+        s2              = _mm256_xor_si256(s2, t);
+        s3              = rotl(s3, 45);
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(_s[0].data()), s0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(_s[1].data()), s1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(_s[2].data()), s2);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(_s[3].data()), s3);
+#else
+        for (Size lane = 0; lane < kLanes; ++lane) {
+            const u64 s1 = _s[1][lane];
+            out[lane]    = std::rotl(s1 * 5, 7) * 9;
+
+            const u64 t  = s1 << 17;
+            _s[2][lane] ^= _s[0][lane];
+            _s[3][lane] ^= _s[1][lane];
+            _s[1][lane] ^= _s[2][lane];
+            _s[0][lane] ^= _s[3][lane];
+            _s[2][lane] ^= t;
+            _s[3][lane]  = std::rotl(_s[3][lane], 45);
+        }
+#endif
+    }
+
+    alignas(32) std::array<std::array<u64, kLanes>, 4> _s{};
+    std::array<u64, kLanes> _buffer{};
+    Size _index = kLanes;
+};
+
+static_assert(std::uniform_random_bit_generator<Xoshiro256SSx4>);
+
+} // namespace slib
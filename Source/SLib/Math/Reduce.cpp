@@ -0,0 +1,31 @@
+﻿/**
+ * @File Reduce.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Reduce.hpp"
+
+#include <thread>
+
+#include <SLib/Concurrency/ThreadPool.hpp>
+
+using namespace slib;
+
+Size slib::detail::ParallelReduceChunkCount(Size n, Size threads)
+{
+    if (threads == 0)
+        threads = Max<Size>(std::thread::hardware_concurrency(), 1);
+    return Max<Size>(Min(threads, n / kParallelReduceMinChunk), 1);
+}
+
+void slib::detail::ParallelReduceChunks(Size n, Size chunks, const std::function<void(Size, Size, Size)>& body)
+{
+    SLIB_DEBUG_ASSERT(chunks > 0);
+
+    auto bounds = [n, chunks](Size chunk) { return n / chunks * chunk + Min(chunk, n % chunks); };
+
+    // 粒度为 1 块: 切分方式只取决于 n 与 chunks，结果与调度顺序无关
+    ParallelFor(ThreadPool::Global(), 0, chunks, [&](Size c) { body(c, bounds(c), bounds(c + 1)); }, 1);
+}
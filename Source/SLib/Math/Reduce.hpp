@@ -0,0 +1,317 @@
+﻿/**
+ * @File Reduce.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/Math/Common.hpp>
+#include <SLib/Math/Polynomial.hpp>
+
+namespace slib {
+
+/**
+ * 归约模式. 以下 u 为单位舍入 (f32 为 2^-24，f64 为 2^-53)，S = Σx_i，A = Σ|x_i|.
+ *
+ * - Fast:        K 路独立累加器 (可被编译器向量化)，|err| ≤ (n/K + log2 K) · u · A.
+ * - Pairwise:    以 kPairwiseBlock 为叶块的二分归约，|err| ≤ (B/K + log2 K + ⌈log2(n/B)⌉) · u · A.
+ * - Compensated: 逐元素 TwoSum / TwoProd 无误差变换 (Neumaier / Ogita-Rump-Oishi Sum2 / Dot2)，
+ *                |err| ≤ u · |S| + γ(n)² · A，即结果如同以两倍精度计算后再舍入.
+ *
+ * 补偿模式依赖严格的 IEEE 语义，不能在 -ffast-math / /fp:fast 下使用.
+ */
+enum class ReduceMode
+{
+    Fast,
+    Pairwise,
+    Compensated,
+};
+
+/// 两两归约的叶块大小.
+constexpr Size kPairwiseBlock = 128;
+
+/// 并行归约中每个线程的最小元素数，低于此值时直接串行计算.
+constexpr Size kParallelReduceMinChunk = Size(1) << 16;
+
+/**
+ * 均值与 (总体) 方差.
+ */
+template<cFloatType T>
+struct Moments
+{
+    T mean     = 0;
+    T variance = 0;
+};
+
+namespace detail {
+
+/// Fast 模式的累加器个数: 约为 4 个 256 位寄存器，足以隐藏加法延迟.
+template<cFloatType T>
+constexpr Size kReduceLanes = 128 / sizeof(T);
+
+/**
+ * @brief 未舍入的补偿和，真实值为 hi + lo.
+ */
+template<cFloatType T>
+struct CompensatedSum
+{
+    T hi = 0;
+    T lo = 0;
+
+    SLIB_FUNC SLIB_CONSTEXPR void add(T value, T error)
+    {
+        T e;
+        hi  = TwoSum(hi, value, e);
+        lo += e + error;
+    }
+
+    SLIB_FUNC SLIB_CONSTEXPR void merge(const CompensatedSum& other)
+    {
+        add(other.hi, other.lo);
+    }
+
+    SLIB_NODISCARD SLIB_FUNC SLIB_CONSTEXPR T result() const { return hi + lo; }
+};
+
+/**
+ * 以下内核均对 [begin, end) 上的 f(i, err) 求和. f 返回第 i 项的值，并在 err 中给出该项自身的舍入误差
+ * (例如 TwoProd 的低位部分); 非补偿模式会忽略 err，相应的计算会被编译器消除.
+ */
+
+template<cFloatType T, typename F>
+SLIB_FORCE_INLINE T ReduceFast(Size begin, Size end, F&& f)
+{
+    constexpr Size K = kReduceLanes<T>;
+
+    std::array<T, K> acc{};
+    Size i = begin;
+    for (; i + K <= end; i += K) {
+        for (Size k = 0; k < K; ++k) {
+            T e;
+            acc[k] += f(i + k, e);
+        }
+    }
+    for (Size k = 0; i < end; ++i, ++k) {
+        T e;
+        acc[k] += f(i, e);
+    }
+
+    for (Size width = K / 2; width > 0; width /= 2)
+        for (Size k = 0; k < width; ++k)
+            acc[k] += acc[k + width];
+    return acc[0];
+}
+
+template<cFloatType T, typename F>
+T ReducePairwise(Size begin, Size end, F&& f)
+{
+    const Size n = end - begin;
+    if (n <= kPairwiseBlock)
+        return ReduceFast<T>(begin, end, f);
+
+    // 分界点对齐到叶块，使叶块内的向量化循环没有尾部
+    const Size half = (n / kPairwiseBlock + 1) / 2 * kPairwiseBlock;
+    return ReducePairwise<T>(begin, begin + half, f) + ReducePairwise<T>(begin + half, end, f);
+}
+
+template<cFloatType T, typename F>
+SLIB_FORCE_INLINE CompensatedSum<T> ReduceCompensated(Size begin, Size end, F&& f)
+{
+    constexpr Size K = kReduceLanes<T> / 2;
+
+    std::array<T, K> hi{}, lo{};
+    Size i = begin;
+    for (; i + K <= end; i += K) {
+        for (Size k = 0; k < K; ++k) {
+            T ev, es;
+            const T v = f(i + k, ev);
+            hi[k]     = TwoSum(hi[k], v, es);
+            lo[k]    += es + ev;
+        }
+    }
+    for (Size k = 0; i < end; ++i, ++k) {
+        T ev, es;
+        const T v = f(i, ev);
+        hi[k]     = TwoSum(hi[k], v, es);
+        lo[k]    += es + ev;
+    }
+
+    CompensatedSum<T> sum;
+    for (Size k = 0; k < K; ++k)
+        sum.add(hi[k], lo[k]);
+    return sum;
+}
+
+template<cFloatType T, typename F>
+CompensatedSum<T> ReduceRange(Size begin, Size end, ReduceMode mode, F&& f)
+{
+    switch (mode) {
+        case ReduceMode::Fast    : return {ReduceFast<T>(begin, end, f), 0};
+        case ReduceMode::Pairwise: return {ReducePairwise<T>(begin, end, f), 0};
+        default                  : return ReduceCompensated<T>(begin, end, f);
+    }
+}
+
+/**
+ * @brief 计算 n 个元素在给定线程数 (0 表示硬件并发数) 下应切分的块数，返回 1 表示应串行执行.
+ */
+Size ParallelReduceChunkCount(Size n, Size threads);
+
+/**
+ * @brief 将 [0, n) 均分为 chunks 块，在全局线程池 (ThreadPool::Global) 上并发执行 body(chunk, begin, end).
+ */
+void ParallelReduceChunks(Size n, Size chunks, const std::function<void(Size, Size, Size)>& body);
+
+template<cFloatType T, typename F>
+CompensatedSum<T> ParallelReduceRange(Size n, ReduceMode mode, Size threads, F&& f)
+{
+    const Size chunks = ParallelReduceChunkCount(n, threads);
+    if (chunks <= 1)
+        return ReduceRange<T>(0, n, mode, f);
+
+    // 每块的部分和各占一条缓存行，避免伪共享
+    struct alignas(SLIB_CACHE_LINE_SIZE) Partial
+    {
+        CompensatedSum<T> sum;
+    };
+
+    std::vector<Partial> partials(chunks);
+    ParallelReduceChunks(n, chunks,
+                         [&](Size chunk, Size begin, Size end) { partials[chunk].sum = ReduceRange<T>(begin, end, mode, f); });
+
+    // 部分和之间总是以补偿方式合并，其误差不超过所选模式自身的界
+    CompensatedSum<T> total;
+    for (const Partial& p : partials)
+        total.merge(p.sum);
+    return total;
+}
+
+template<cFloatType T>
+SLIB_FORCE_INLINE T DotTerm(const T* a, const T* b, Size i, T& err)
+{
+    return TwoProd(a[i], b[i], err);
+}
+
+template<cFloatType T>
+Moments<T> MeanVarianceImpl(std::span<const T> x, ReduceMode mode, Size threads)
+{
+    const Size n = x.size();
+    if (n == 0)
+        return {};
+
+    const T* data = x.data();
+    auto reduce   = [&](auto&& f) { return ParallelReduceRange<T>(n, mode, threads, f).result(); };
+
+    const T invN = T(1) / static_cast<T>(n);
+    const T mean = reduce([data](Size i, T& err) { return err = 0, data[i]; }) * invN;
+
+    // 修正的两遍算法 (Chan, Golub, LeVeque): Var = (Σd² - (Σd)² / n) / n，d = x - mean
+    const T sumSq = reduce([data, mean](Size i, T& err) {
+        const T d = data[i] - mean;
+        return TwoProd(d, d, err);
+    });
+    const T sumD  = reduce([data, mean](Size i, T& err) { return err = 0, data[i] - mean; });
+
+    return {mean + sumD * invN, Max(T(0), (sumSq - sumD * sumD * invN) * invN)};
+}
+
+} // namespace detail
+
+// ==================
+// Serial reductions
+// ==================
+
+/**
+ * @brief Σx_i.
+ */
+template<cFloatType T>
+SLIB_NODISCARD T Sum(std::span<const T> x, ReduceMode mode = ReduceMode::Pairwise)
+{
+    const T* data = x.data();
+    return detail::ReduceRange<T>(0, x.size(), mode, [data](Size i, T& err) { return err = 0, data[i]; }).result();
+}
+
+/**
+ * @brief Σa_i·b_i. 补偿模式下乘积的舍入误差也被计入 (Dot2)，误差界中的 A 为 Σ|a_i·b_i|.
+ */
+template<cFloatType T>
+SLIB_NODISCARD T Dot(std::span<const T> a, std::span<const T> b, ReduceMode mode = ReduceMode::Pairwise)
+{
+    SLIB_DEBUG_ASSERT(a.size() == b.size());
+
+    const T* pa = a.data();
+    const T* pb = b.data();
+    return detail::ReduceRange<T>(0, a.size(), mode, [pa, pb](Size i, T& err) { return detail::DotTerm(pa, pb, i, err); })
+        .result();
+}
+
+/**
+ * @brief 欧几里得范数 sqrt(Σx_i²). 不做缩放，平方和上溢/下溢时结果为 inf/0.
+ */
+template<cFloatType T>
+SLIB_NODISCARD T Norm(std::span<const T> x, ReduceMode mode = ReduceMode::Pairwise)
+{
+    return Sqrt(Dot(x, x, mode));
+}
+
+/**
+ * @brief 均值与总体方差 (除以 n)，使用修正的两遍算法，不存在 E[x²] - E[x]² 式的灾难性抵消.
+ */
+template<cFloatType T>
+SLIB_NODISCARD Moments<T> MeanVariance(std::span<const T> x, ReduceMode mode = ReduceMode::Pairwise)
+{
+    return detail::MeanVarianceImpl(x, mode, 1);
+}
+
+// ==================
+// Parallel reductions
+// ==================
+
+/**
+ * 以下函数在元素数不少于 2 · kParallelReduceMinChunk 时将数组切分到多个线程 (threads 为 0 时使用硬件并发数)，
+ * 各块按所选模式归约后以补偿方式合并，误差界与串行版本相同. 结果只取决于切分方式，对相同的 n 和 threads 可复现.
+ */
+
+template<cFloatType T>
+SLIB_NODISCARD T ParallelSum(std::span<const T> x, ReduceMode mode = ReduceMode::Pairwise, Size threads = 0)
+{
+    const T* data = x.data();
+    return detail::ParallelReduceRange<T>(x.size(), mode, threads, [data](Size i, T& err) { return err = 0, data[i]; })
+        .result();
+}
+
+template<cFloatType T>
+SLIB_NODISCARD T ParallelDot(std::span<const T> a, std::span<const T> b, ReduceMode mode = ReduceMode::Pairwise,
+                             Size threads = 0)
+{
+    SLIB_DEBUG_ASSERT(a.size() == b.size());
+
+    const T* pa = a.data();
+    const T* pb = b.data();
+    return detail::ParallelReduceRange<T>(a.size(), mode, threads,
+                                          [pa, pb](Size i, T& err) { return detail::DotTerm(pa, pb, i, err); })
+        .result();
+}
+
+template<cFloatType T>
+SLIB_NODISCARD T ParallelNorm(std::span<const T> x, ReduceMode mode = ReduceMode::Pairwise, Size threads = 0)
+{
+    return Sqrt(ParallelDot(x, x, mode, threads));
+}
+
+template<cFloatType T>
+SLIB_NODISCARD Moments<T> ParallelMeanVariance(std::span<const T> x, ReduceMode mode = ReduceMode::Pairwise,
+                                               Size threads = 0)
+{
+    return detail::MeanVarianceImpl(x, mode, threads);
+}
+
+} // namespace slib
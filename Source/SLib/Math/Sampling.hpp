@@ -0,0 +1,450 @@
+﻿/**
+ * @File Sampling.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <array>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/Math/Constant.hpp>
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Hash.hpp>
+#include <SLib/Math/Common.hpp>
+#include <SLib/Math/Polynomial.hpp>
+
+namespace slib {
+
+// ==================
+// Radical inverse / Halton
+// ==================
+
+constexpr std::array<u32, 32> kPrimes = {2,  3,  5,  7,  11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+                                         59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131};
+
+constexpr u32 kHaltonMaxDimensions = static_cast<u32>(kPrimes.size());
+
+/**
+ * @brief 以 2 为底的根式逆 (van der Corput 序列)，即把 a 的比特位逆序后映射到 [0, 1).
+ */
+SLIB_FUNC inline f32 RadicalInverse2(u32 a)
+{
+    return Min(static_cast<f32>(ReverseBits(a)) * 0x1.0p-32f, kOneMinusEpsilonF);
+}
+
+/**
+ * @brief 以第 baseIndex 个素数为底的根式逆.
+ */
+SLIB_FUNC inline f32 RadicalInverse(u32 baseIndex, u64 a)
+{
+    SLIB_DEBUG_ASSERT_LT(baseIndex, kHaltonMaxDimensions);
+    if (baseIndex == 0)
+        return RadicalInverse2(static_cast<u32>(a));
+
+    const u64 base    = kPrimes[baseIndex];
+    const f64 invBase = 1.0 / static_cast<f64>(base);
+
+    u64 reversed = 0;
+    f64 invBaseM = 1;
+    while (a) {
+        const u64 next  = a / base;
+        const u64 digit = a - next * base;
+        reversed        = reversed * base + digit;
+        invBaseM       *= invBase;
+        a               = next;
+    }
+    return Min(static_cast<f32>(static_cast<f64>(reversed) * invBaseM), kOneMinusEpsilonF);
+}
+
+SLIB_FUNC inline f32 Halton(u32 dim, u64 index)
+{
+    return RadicalInverse(dim, index);
+}
+
+/**
+ * @brief 第 dim 维上从 startIndex 开始的连续 Halton 样本.
+ */
+inline void Halton(u32 dim, u64 startIndex, std::span<f32> out)
+{
+    if (dim == 0) {
+        for (Size i = 0; i < out.size(); ++i)
+            out[i] = RadicalInverse2(static_cast<u32>(startIndex + i));
+        return;
+    }
+
+    for (Size i = 0; i < out.size(); ++i)
+        out[i] = RadicalInverse(dim, startIndex + i);
+}
+
+// ==================
+// Sobol
+// ==================
+
+namespace detail {
+
+struct SobolPolynomial
+{
+    u32 degree;
+    u32 coefficients;
+    std::array<u32, 6> m;
+};
+
+// Joe & Kuo (new-joe-kuo-6.21201) 的前 15 个本原多项式与初始方向数
+constexpr std::array<SobolPolynomial, 15> kSobolPolynomials = {
+  SobolPolynomial{1,  0,  {1}},
+  SobolPolynomial{2,  1,  {1, 3}},
+  SobolPolynomial{3,  1,  {1, 3, 1}},
+  SobolPolynomial{3,  2,  {1, 1, 1}},
+  SobolPolynomial{4,  1,  {1, 1, 3, 3}},
+  SobolPolynomial{4,  4,  {1, 3, 5, 13}},
+  SobolPolynomial{5,  2,  {1, 1, 5, 5, 17}},
+  SobolPolynomial{5,  4,  {1, 1, 5, 5, 5}},
+  SobolPolynomial{5,  7,  {1, 1, 7, 11, 19}},
+  SobolPolynomial{5, 11,  {1, 1, 5, 1, 1}},
+  SobolPolynomial{5, 13,  {1, 1, 1, 3, 11}},
+  SobolPolynomial{5, 14,  {1, 3, 5, 5, 31}},
+  SobolPolynomial{6,  1,  {1, 3, 3, 9, 7, 49}},
+  SobolPolynomial{6, 13,  {1, 1, 1, 15, 21, 21}},
+  SobolPolynomial{6, 16,  {1, 3, 1, 13, 27, 49}},
+};
+
+using SobolMatrices = std::array<std::array<u32, 32>, kSobolPolynomials.size() + 1>;
+
+consteval SobolMatrices MakeSobolMatrices()
+{
+    SobolMatrices matrices{};
+    for (u32 i = 0; i < 32; ++i)
+        matrices[0][i] = 1u << (31 - i);
+
+    for (Size d = 1; d < matrices.size(); ++d) {
+        const auto& p = kSobolPolynomials[d - 1];
+        auto& v       = matrices[d];
+        const u32 s   = p.degree;
+        for (u32 i = 0; i < s; ++i)
+            v[i] = p.m[i] << (31 - i);
+        for (u32 i = s; i < 32; ++i) {
+            v[i] = v[i - s] ^ (v[i - s] >> s);
+            for (u32 k = 1; k < s; ++k) {
+                if ((p.coefficients >> (s - 1 - k)) & 1)
+                    v[i] ^= v[i - k];
+            }
+        }
+    }
+    return matrices;
+}
+
+constexpr SobolMatrices kSobolMatrices = MakeSobolMatrices();
+
+} // namespace detail
+
+constexpr u32 kSobolMaxDimensions = static_cast<u32>(detail::kSobolMatrices.size());
+
+/**
+ * @brief 近似的 Owen 嵌套均匀置乱 (Laine-Karras 哈希)，保持 Sobol 序列的分层性质.
+ */
+SLIB_FUNC inline u32 FastOwenScramble(u32 v, u32 seed)
+{
+    v  = ReverseBits(v);
+    v ^= v * 0x3d20adea;
+    v += seed;
+    v *= (seed >> 16) | 1;
+    v ^= v * 0x05526c56;
+    v ^= v * 0x53a22864;
+    return ReverseBits(v);
+}
+
+/**
+ * @brief Sobol 样本的 32 位定点表示，循环不含分支，可以被向量化.
+ */
+SLIB_FUNC inline u32 SobolSampleBits(u32 dim, u32 index)
+{
+    SLIB_DEBUG_ASSERT_LT(dim, kSobolMaxDimensions);
+    const auto& m = detail::kSobolMatrices[dim];
+
+    u32 v = 0;
+    for (u32 i = 0; i < 32; ++i)
+        v ^= m[i] & (0u - ((index >> i) & 1));
+    return v;
+}
+
+SLIB_FUNC inline f32 SobolSample(u32 dim, u32 index)
+{
+    return Min(static_cast<f32>(SobolSampleBits(dim, index)) * 0x1.0p-32f, kOneMinusEpsilonF);
+}
+
+/**
+ * @brief Owen 置乱后的 Sobol 样本，每个维度使用由 seed 派生的独立置乱.
+ */
+SLIB_FUNC inline f32 SobolSample(u32 dim, u32 index, u32 seed)
+{
+    const u32 dimSeed = static_cast<u32>(MixBits((static_cast<u64>(seed) << 32) | dim));
+    return Min(static_cast<f32>(FastOwenScramble(SobolSampleBits(dim, index), dimSeed)) * 0x1.0p-32f, kOneMinusEpsilonF);
+}
+
+inline void SobolSamples(u32 dim, u32 startIndex, std::span<f32> out)
+{
+    for (Size i = 0; i < out.size(); ++i)
+        out[i] = SobolSample(dim, startIndex + static_cast<u32>(i));
+}
+
+inline void SobolSamples(u32 dim, u32 startIndex, u32 seed, std::span<f32> out)
+{
+    for (Size i = 0; i < out.size(); ++i)
+        out[i] = SobolSample(dim, startIndex + static_cast<u32>(i), seed);
+}
+
+// ==================
+// Warping
+// ==================
+
+namespace detail {
+
+/**
+ * @brief 同时计算 sin(2πt) 与 cos(2πt)，全程无分支，供批量采样函数向量化使用.
+ *
+ * 要求 t >= -1/4. 先把 t 折叠到 [-1/4, 1/4] 圈，再用 11 阶奇多项式近似，绝对误差约 2e-7.
+ */
+SLIB_FUNC inline void SinCos2Pi(f32 t, f32& s, f32& c)
+{
+    SLIB_DEBUG_ASSERT(t >= -0.25f);
+    auto sin2Pi = [](f32 x) {
+        // x >= -1/2 时截断等价于 Floor, 而 Floor 在默认浮点选项下无法向量化
+        x            = x - static_cast<f32>(static_cast<i32>(x + 0.5f)); // [-1/2, 1/2]
+        x            = Max(Min(x, 0.5f - x), -0.5f - x);                  // [-1/4, 1/4]
+        const f32 y  = x * static_cast<f32>(kTwoPi);                      // [-π/2, π/2]
+        const f32 y2 = y * y;
+        return y * EvaluatePolynomial(y2, 1.0f, -1.0f / 6, 1.0f / 120, -1.0f / 5040, 1.0f / 362880, -1.0f / 39916800);
+    };
+    s = sin2Pi(t);
+    c = sin2Pi(t + 0.25f);
+}
+
+} // namespace detail
+
+/**
+ * @brief 极坐标映射到单位圆盘，面积均匀但会扭曲分层.
+ */
+SLIB_FUNC inline std::array<f32, 2> SampleUniformDiskPolar(f32 u0, f32 u1)
+{
+    const f32 r     = Sqrt(u0);
+    const f32 theta = static_cast<f32>(kTwoPi) * u1;
+    return {r * Cos(theta), r * Sin(theta)};
+}
+
+/**
+ * @brief Shirley-Chiu 同心映射到单位圆盘，保持样本的分层结构.
+ */
+SLIB_FUNC inline std::array<f32, 2> SampleUniformDiskConcentric(f32 u0, f32 u1)
+{
+    const f32 x = 2 * u0 - 1;
+    const f32 y = 2 * u1 - 1;
+    if (x == 0 && y == 0)
+        return {0, 0};
+
+    f32 r, theta;
+    if (Abs(x) > Abs(y)) {
+        r     = x;
+        theta = static_cast<f32>(kPiOver4) * (y / x);
+    }
+    else {
+        r     = y;
+        theta = static_cast<f32>(kPiOver2) - static_cast<f32>(kPiOver4) * (x / y);
+    }
+    return {r * Cos(theta), r * Sin(theta)};
+}
+
+SLIB_FUNC inline std::array<f32, 3> SampleUniformSphere(f32 u0, f32 u1)
+{
+    const f32 z   = 1 - 2 * u0;
+    const f32 r   = Sqrt(Max(0.0f, 1 - z * z));
+    const f32 phi = static_cast<f32>(kTwoPi) * u1;
+    return {r * Cos(phi), r * Sin(phi), z};
+}
+
+SLIB_FUNC inline std::array<f32, 3> SampleUniformHemisphere(f32 u0, f32 u1)
+{
+    const f32 z   = u0;
+    const f32 r   = Sqrt(Max(0.0f, 1 - z * z));
+    const f32 phi = static_cast<f32>(kTwoPi) * u1;
+    return {r * Cos(phi), r * Sin(phi), z};
+}
+
+/**
+ * @brief Malley 方法: 圆盘上的均匀样本投影到半球即为余弦加权分布.
+ */
+SLIB_FUNC inline std::array<f32, 3> SampleCosineHemisphere(f32 u0, f32 u1)
+{
+    const auto d = SampleUniformDiskConcentric(u0, u1);
+    const f32 z  = Sqrt(Max(0.0f, 1 - d[0] * d[0] - d[1] * d[1]));
+    return {d[0], d[1], z};
+}
+
+// clang-format off
+SLIB_FUNC constexpr f32 UniformSpherePdf() { return static_cast<f32>(kInv4Pi); }
+SLIB_FUNC constexpr f32 UniformHemispherePdf() { return static_cast<f32>(kInv2Pi); }
+SLIB_FUNC constexpr f32 CosineHemispherePdf(f32 cosTheta) { return cosTheta * static_cast<f32>(kInvPi); }
+// clang-format on
+
+/**
+ * 批量版本: 输入输出均为 SoA 排列，循环体无分支且不调用 sin/cos，可以被编译器向量化.
+ * 带 Sqrt 的函数在 GCC/Clang 下还需要 -fno-math-errno.
+ */
+inline void SampleUniformDiskConcentric(std::span<const f32> u0, std::span<const f32> u1, std::span<f32> outX, std::span<f32> outY)
+{
+    SLIB_DEBUG_ASSERT(u1.size() >= u0.size() && outX.size() >= u0.size() && outY.size() >= u0.size());
+    for (Size i = 0; i < u0.size(); ++i) {
+        const f32 x     = 2 * u0[i] - 1;
+        const f32 y     = 2 * u1[i] - 1;
+        const bool useX = Abs(x) > Abs(y);
+        const f32 r     = useX ? x : y;
+        const f32 num   = useX ? y : x;
+        // r 为 0 时 num 也为 0, 钳制分母只为避免产生 NaN
+        const f32 ratio = num / Max(Abs(r), numeric_limits<f32>::min()) * std::copysign(1.0f, r);
+        // 以“圈”为单位的角度 θ/(2π): useX ? ratio/8 : 1/4 - ratio/8, 只对常量做选择以免引入分支
+        const f32 turns = FMA(useX ? 0.125f : -0.125f, ratio, useX ? 0.0f : 0.25f);
+
+        f32 s, c;
+        detail::SinCos2Pi(turns, s, c);
+        outX[i] = r * c;
+        outY[i] = r * s;
+    }
+}
+
+inline void SampleUniformSphere(std::span<const f32> u0, std::span<const f32> u1, std::span<f32> outX, std::span<f32> outY, std::span<f32> outZ)
+{
+    SLIB_DEBUG_ASSERT(u1.size() >= u0.size() && outX.size() >= u0.size() && outY.size() >= u0.size() && outZ.size() >= u0.size());
+    for (Size i = 0; i < u0.size(); ++i) {
+        const f32 z = 1 - 2 * u0[i];
+        const f32 r = Sqrt(Max(0.0f, 1 - z * z));
+
+        f32 s, c;
+        detail::SinCos2Pi(u1[i], s, c);
+        outX[i] = r * c;
+        outY[i] = r * s;
+        outZ[i] = z;
+    }
+}
+
+inline void SampleUniformHemisphere(std::span<const f32> u0, std::span<const f32> u1, std::span<f32> outX, std::span<f32> outY,
+                                    std::span<f32> outZ)
+{
+    SLIB_DEBUG_ASSERT(u1.size() >= u0.size() && outX.size() >= u0.size() && outY.size() >= u0.size() && outZ.size() >= u0.size());
+    for (Size i = 0; i < u0.size(); ++i) {
+        const f32 z = u0[i];
+        const f32 r = Sqrt(Max(0.0f, 1 - z * z));
+
+        f32 s, c;
+        detail::SinCos2Pi(u1[i], s, c);
+        outX[i] = r * c;
+        outY[i] = r * s;
+        outZ[i] = z;
+    }
+}
+
+inline void SampleCosineHemisphere(std::span<const f32> u0, std::span<const f32> u1, std::span<f32> outX, std::span<f32> outY,
+                                   std::span<f32> outZ)
+{
+    SampleUniformDiskConcentric(u0, u1, outX, outY);
+    for (Size i = 0; i < u0.size(); ++i)
+        outZ[i] = Sqrt(Max(0.0f, 1 - outX[i] * outX[i] - outY[i] * outY[i]));
+}
+
+// ==================
+// Alias table
+// ==================
+
+/**
+ * @brief Walker/Vose 别名表: O(n) 构建，每次采样 O(1)，不需要二分查找.
+ */
+class AliasTable
+{
+public:
+    AliasTable() = default;
+
+    explicit AliasTable(std::span<const f32> weights) { build(weights); }
+
+    void build(std::span<const f32> weights)
+    {
+        const Size n = weights.size();
+        _bins.assign(n, Bin{});
+        if (n == 0)
+            return;
+
+        const f64 sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+        SLIB_CHECK(sum > 0, "AliasTable requires a positive total weight.");
+
+        std::vector<u32> small, large;
+        std::vector<f64> scaled(n);
+        for (Size i = 0; i < n; ++i) {
+            SLIB_CHECK(weights[i] >= 0, "AliasTable weights must be non-negative.");
+            _bins[i].pmf = static_cast<f32>(weights[i] / sum);
+            scaled[i]    = weights[i] / sum * static_cast<f64>(n);
+            (scaled[i] < 1.0 ? small : large).push_back(static_cast<u32>(i));
+        }
+
+        while (!small.empty() && !large.empty()) {
+            const u32 s = small.back();
+            const u32 l = large.back();
+            small.pop_back();
+
+            _bins[s].q      = static_cast<f32>(scaled[s]);
+            _bins[s].alias  = l;
+            scaled[l]      += scaled[s] - 1.0;
+            if (scaled[l] < 1.0) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+
+        // 浮点误差留下的条目概率都视为 1
+        for (const u32 i : small)
+            _bins[i].q = 1;
+        for (const u32 i : large)
+            _bins[i].q = 1;
+    }
+
+    /**
+     * @brief 用一个 [0, 1) 均匀数采样，同时可选地返回样本的概率.
+     */
+    SLIB_NODISCARD u32 sample(f32 u, f32* pmf = nullptr) const
+    {
+        SLIB_DEBUG_ASSERT(!_bins.empty());
+        const f32 scaled = u * static_cast<f32>(_bins.size());
+        const u32 offset = Min(static_cast<u32>(scaled), static_cast<u32>(_bins.size() - 1));
+        const f32 up     = Min(scaled - static_cast<f32>(offset), kOneMinusEpsilonF);
+        const Bin& bin   = _bins[offset];
+        const u32 index  = up < bin.q ? offset : bin.alias;
+        if (pmf)
+            *pmf = _bins[index].pmf;
+        return index;
+    }
+
+    void sample(std::span<const f32> u, std::span<u32> out) const
+    {
+        SLIB_DEBUG_ASSERT(out.size() >= u.size());
+        for (Size i = 0; i < u.size(); ++i)
+            out[i] = sample(u[i]);
+    }
+
+    SLIB_NODISCARD f32 pmf(u32 index) const { return _bins[index].pmf; }
+
+    SLIB_NODISCARD Size size() const { return _bins.size(); }
+
+private:
+    struct Bin
+    {
+        f32 q     = 0;
+        f32 pmf   = 0;
+        u32 alias = 0;
+    };
+
+    std::vector<Bin> _bins;
+};
+
+} // namespace slib
@@ -0,0 +1,273 @@
+﻿/**
+ * @File Vector.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/Math/Common.hpp>
+
+namespace slib {
+
+// ==================
+// Vector types
+// ==================
+
+template<cArithmeticType T>
+struct Vector2
+{
+    using ValueType             = T;
+    static constexpr Size kSize = 2;
+
+    T x = 0, y = 0;
+
+    constexpr Vector2() = default;
+
+    constexpr explicit Vector2(T s) : x(s), y(s) { }
+
+    constexpr Vector2(T x_, T y_) : x(x_), y(y_) { }
+
+    template<cArithmeticType U>
+    constexpr explicit Vector2(const Vector2<U>& v) : x(static_cast<T>(v.x)), y(static_cast<T>(v.y))
+    {
+    }
+
+    constexpr T& operator[](Size i) { return i == 0 ? x : y; }
+
+    constexpr const T& operator[](Size i) const { return i == 0 ? x : y; }
+
+    friend constexpr bool operator==(const Vector2&, const Vector2&) = default;
+};
+
+template<cArithmeticType T>
+struct Vector3
+{
+    using ValueType             = T;
+    static constexpr Size kSize = 3;
+
+    T x = 0, y = 0, z = 0;
+
+    constexpr Vector3() = default;
+
+    constexpr explicit Vector3(T s) : x(s), y(s), z(s) { }
+
+    constexpr Vector3(T x_, T y_, T z_) : x(x_), y(y_), z(z_) { }
+
+    constexpr Vector3(const Vector2<T>& xy, T z_) : x(xy.x), y(xy.y), z(z_) { }
+
+    template<cArithmeticType U>
+    constexpr explicit Vector3(const Vector3<U>& v) : x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z))
+    {
+    }
+
+    constexpr T& operator[](Size i) { return i == 0 ? x : i == 1 ? y : z; }
+
+    constexpr const T& operator[](Size i) const { return i == 0 ? x : i == 1 ? y : z; }
+
+    SLIB_NODISCARD constexpr Vector2<T> xy() const { return {x, y}; }
+
+    friend constexpr bool operator==(const Vector3&, const Vector3&) = default;
+};
+
+template<cArithmeticType T>
+struct Vector4
+{
+    using ValueType             = T;
+    static constexpr Size kSize = 4;
+
+    T x = 0, y = 0, z = 0, w = 0;
+
+    constexpr Vector4() = default;
+
+    constexpr explicit Vector4(T s) : x(s), y(s), z(s), w(s) { }
+
+    constexpr Vector4(T x_, T y_, T z_, T w_) : x(x_), y(y_), z(z_), w(w_) { }
+
+    constexpr Vector4(const Vector3<T>& xyz, T w_) : x(xyz.x), y(xyz.y), z(xyz.z), w(w_) { }
+
+    template<cArithmeticType U>
+    constexpr explicit Vector4(const Vector4<U>& v)
+        : x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z)), w(static_cast<T>(v.w))
+    {
+    }
+
+    constexpr T& operator[](Size i) { return i == 0 ? x : i == 1 ? y : i == 2 ? z : w; }
+
+    constexpr const T& operator[](Size i) const { return i == 0 ? x : i == 1 ? y : i == 2 ? z : w; }
+
+    SLIB_NODISCARD constexpr Vector3<T> xyz() const { return {x, y, z}; }
+
+    friend constexpr bool operator==(const Vector4&, const Vector4&) = default;
+};
+
+// clang-format off
+template<typename V> concept cVectorType = requires { typename V::ValueType; V::kSize; } and
+                                           (std::is_same_v<V, Vector2<typename V::ValueType>> or
+                                            std::is_same_v<V, Vector3<typename V::ValueType>> or
+                                            std::is_same_v<V, Vector4<typename V::ValueType>>);
+// clang-format on
+
+using Vec2 = Vector2<Float>;
+using Vec3 = Vector3<Float>;
+using Vec4 = Vector4<Float>;
+
+using Vec2f = Vector2<f32>;
+using Vec3f = Vector3<f32>;
+using Vec4f = Vector4<f32>;
+
+using Vec2d = Vector2<f64>;
+using Vec3d = Vector3<f64>;
+using Vec4d = Vector4<f64>;
+
+using Vec2i = Vector2<i32>;
+using Vec3i = Vector3<i32>;
+using Vec4i = Vector4<i32>;
+
+static_assert(sizeof(Vec3f) == 3 * sizeof(f32), "Vector3 must be tightly packed for AoS <-> SoA transposition.");
+
+namespace detail {
+
+/**
+ * @brief 逐分量构造向量，循环在编译期展开为对各成员的直接访问.
+ */
+template<cVectorType V, typename F>
+SLIB_FORCE_INLINE constexpr V MapVector(F&& f)
+{
+    V r;
+    for (Size i = 0; i < V::kSize; ++i)
+        r[i] = f(i);
+    return r;
+}
+
+} // namespace detail
+
+// ==================
+// Component-wise operators
+// ==================
+
+// clang-format off
+template<cVectorType V> constexpr V operator+(const V& a, const V& b) { return detail::MapVector<V>([&](Size i) { return a[i] + b[i]; }); }
+template<cVectorType V> constexpr V operator-(const V& a, const V& b) { return detail::MapVector<V>([&](Size i) { return a[i] - b[i]; }); }
+template<cVectorType V> constexpr V operator*(const V& a, const V& b) { return detail::MapVector<V>([&](Size i) { return a[i] * b[i]; }); }
+template<cVectorType V> constexpr V operator/(const V& a, const V& b) { return detail::MapVector<V>([&](Size i) { return a[i] / b[i]; }); }
+template<cVectorType V> constexpr V operator-(const V& a)             { return detail::MapVector<V>([&](Size i) { return -a[i]; }); }
+
+template<cVectorType V> constexpr V operator*(const V& a, typename V::ValueType s) { return detail::MapVector<V>([&](Size i) { return a[i] * s; }); }
+template<cVectorType V> constexpr V operator*(typename V::ValueType s, const V& a) { return a * s; }
+template<cVectorType V> constexpr V operator/(const V& a, typename V::ValueType s) { return detail::MapVector<V>([&](Size i) { return a[i] / s; }); }
+
+template<cVectorType V> constexpr V& operator+=(V& a, const V& b) { return a = a + b; }
+template<cVectorType V> constexpr V& operator-=(V& a, const V& b) { return a = a - b; }
+template<cVectorType V> constexpr V& operator*=(V& a, const V& b) { return a = a * b; }
+template<cVectorType V> constexpr V& operator/=(V& a, const V& b) { return a = a / b; }
+template<cVectorType V> constexpr V& operator*=(V& a, typename V::ValueType s) { return a = a * s; }
+template<cVectorType V> constexpr V& operator/=(V& a, typename V::ValueType s) { return a = a / s; }
+// clang-format on
+
+// ==================
+// Geometric functions
+// ==================
+
+template<cVectorType V>
+SLIB_FUNC constexpr typename V::ValueType Dot(const V& a, const V& b)
+{
+    typename V::ValueType r = a[0] * b[0];
+    for (Size i = 1; i < V::kSize; ++i)
+        r += a[i] * b[i];
+    return r;
+}
+
+/**
+ * @brief 叉积，使用 DifferenceOfProducts 的 FMA 技巧使每个分量的误差不超过 1.5 ulp.
+ */
+template<cFloatType T>
+SLIB_FUNC SLIB_CONSTEXPR Vector3<T> Cross(const Vector3<T>& a, const Vector3<T>& b)
+{
+    auto dop = [](T p, T q, T r, T s) {
+        const T rs = r * s;
+        return FMA(p, q, -rs) + FMA(-r, s, rs);
+    };
+    return {dop(a.y, b.z, a.z, b.y), dop(a.z, b.x, a.x, b.z), dop(a.x, b.y, a.y, b.x)};
+}
+
+template<cVectorType V>
+SLIB_FUNC constexpr typename V::ValueType LengthSquared(const V& v)
+{
+    return Dot(v, v);
+}
+
+template<cVectorType V>
+    requires cFloatType<typename V::ValueType>
+SLIB_FUNC SLIB_CONSTEXPR typename V::ValueType Length(const V& v)
+{
+    return Sqrt(Dot(v, v));
+}
+
+template<cVectorType V>
+    requires cFloatType<typename V::ValueType>
+SLIB_FUNC SLIB_CONSTEXPR typename V::ValueType Distance(const V& a, const V& b)
+{
+    return Length(a - b);
+}
+
+template<cVectorType V>
+    requires cFloatType<typename V::ValueType>
+SLIB_FUNC SLIB_CONSTEXPR V Normalize(const V& v)
+{
+    return v / Length(v);
+}
+
+template<cVectorType V>
+SLIB_FUNC constexpr V Min(const V& a, const V& b)
+{
+    return detail::MapVector<V>([&](Size i) { return Min(a[i], b[i]); });
+}
+
+template<cVectorType V>
+SLIB_FUNC constexpr V Max(const V& a, const V& b)
+{
+    return detail::MapVector<V>([&](Size i) { return Max(a[i], b[i]); });
+}
+
+template<cVectorType V>
+SLIB_FUNC constexpr V Abs(const V& v)
+{
+    return detail::MapVector<V>([&](Size i) { return v[i] < 0 ? -v[i] : v[i]; });
+}
+
+template<cVectorType V>
+    requires cFloatType<typename V::ValueType>
+SLIB_FUNC SLIB_CONSTEXPR V FMA(const V& a, const V& b, const V& c)
+{
+    return detail::MapVector<V>([&](Size i) { return FMA(a[i], b[i], c[i]); });
+}
+
+template<cVectorType V>
+    requires cFloatType<typename V::ValueType>
+SLIB_FUNC constexpr V Lerp(const V& a, const V& b, typename V::ValueType t)
+{
+    return a * (1 - t) + b * t;
+}
+
+template<cVectorType V>
+SLIB_FUNC constexpr typename V::ValueType MinComponent(const V& v)
+{
+    auto r = v[0];
+    for (Size i = 1; i < V::kSize; ++i)
+        r = Min(r, v[i]);
+    return r;
+}
+
+template<cVectorType V>
+SLIB_FUNC constexpr typename V::ValueType MaxComponent(const V& v)
+{
+    auto r = v[0];
+    for (Size i = 1; i < V::kSize; ++i)
+        r = Max(r, v[i]);
+    return r;
+}
+
+} // namespace slib
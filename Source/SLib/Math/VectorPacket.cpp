@@ -0,0 +1,66 @@
+﻿/**
+ * @File VectorPacket.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "VectorPacket.hpp"
+
+#include <algorithm>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kPacketWidth = Vec3x8::kWidth;
+
+} // namespace
+
+void slib::TransposeToSoA(std::span<const Vec3f> in, std::span<f32> x, std::span<f32> y, std::span<f32> z)
+{
+    SLIB_DEBUG_ASSERT(x.size() >= in.size() && y.size() >= in.size() && z.size() >= in.size());
+
+    const Size n = in.size();
+    Size i       = 0;
+    for (; i + kPacketWidth <= n; i += kPacketWidth) {
+        const Vec3x8 packet = LoadPacket<f32, kPacketWidth>(in.data() + i);
+        std::copy(packet.x.begin(), packet.x.end(), x.data() + i);
+        std::copy(packet.y.begin(), packet.y.end(), y.data() + i);
+        std::copy(packet.z.begin(), packet.z.end(), z.data() + i);
+    }
+    for (; i < n; ++i) {
+        x[i] = in[i].x;
+        y[i] = in[i].y;
+        z[i] = in[i].z;
+    }
+}
+
+void slib::TransposeToAoS(std::span<const f32> x, std::span<const f32> y, std::span<const f32> z, std::span<Vec3f> out)
+{
+    SLIB_DEBUG_ASSERT(y.size() >= x.size() && z.size() >= x.size() && out.size() >= x.size());
+
+    const Size n = x.size();
+    Size i       = 0;
+    for (; i + kPacketWidth <= n; i += kPacketWidth) {
+        Vec3x8 packet;
+        std::copy_n(x.data() + i, kPacketWidth, packet.x.begin());
+        std::copy_n(y.data() + i, kPacketWidth, packet.y.begin());
+        std::copy_n(z.data() + i, kPacketWidth, packet.z.begin());
+        StorePacket(packet, out.data() + i);
+    }
+    for (; i < n; ++i)
+        out[i] = {x[i], y[i], z[i]};
+}
+
+void slib::TransformPoints(const Mat4f& m, std::span<const Vec3f> in, std::span<Vec3f> out)
+{
+    SLIB_DEBUG_ASSERT(out.size() >= in.size());
+
+    const Size n = in.size();
+    Size i       = 0;
+    for (; i + kPacketWidth <= n; i += kPacketWidth)
+        StorePacket(TransformPoint(m, LoadPacket<f32, kPacketWidth>(in.data() + i)), out.data() + i);
+    for (; i < n; ++i)
+        out[i] = TransformPoint(m, in[i]);
+}
@@ -0,0 +1,297 @@
+﻿/**
+ * @File VectorPacket.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include <SLib/Math/Matrix.hpp>
+
+namespace slib {
+
+/**
+ * W 个 3 维向量的 SoA 打包: x、y、z 各自连续存储，逐通道运算的循环可被直接向量化.
+ * 与 SIMD 寄存器类型一样，默认构造不初始化各通道.
+ */
+template<cFloatType T, Size W>
+struct Vector3Packet
+{
+    using ValueType              = T;
+    using Lanes                  = std::array<T, W>;
+    static constexpr Size kWidth = W;
+
+    alignas(W * sizeof(T)) Lanes x;
+    alignas(W * sizeof(T)) Lanes y;
+    alignas(W * sizeof(T)) Lanes z;
+
+    constexpr Vector3Packet() = default;
+
+    /// 将同一个向量广播到所有通道.
+    constexpr explicit Vector3Packet(const Vector3<T>& v)
+    {
+        x.fill(v.x);
+        y.fill(v.y);
+        z.fill(v.z);
+    }
+
+    SLIB_NODISCARD constexpr Vector3<T> lane(Size i) const { return {x[i], y[i], z[i]}; }
+
+    constexpr void setLane(Size i, const Vector3<T>& v)
+    {
+        x[i] = v.x;
+        y[i] = v.y;
+        z[i] = v.z;
+    }
+};
+
+using Vec3x4  = Vector3Packet<f32, 4>;
+using Vec3x8  = Vector3Packet<f32, 8>;
+using Vec3dx4 = Vector3Packet<f64, 4>;
+
+namespace detail {
+
+template<cFloatType T, Size W, typename F>
+SLIB_FORCE_INLINE constexpr Vector3Packet<T, W> MapPacket(F&& f)
+{
+    Vector3Packet<T, W> r;
+    for (Size i = 0; i < W; ++i) {
+        const Vector3<T> v = f(i);
+        r.x[i]             = v.x;
+        r.y[i]             = v.y;
+        r.z[i]             = v.z;
+    }
+    return r;
+}
+
+} // namespace detail
+
+// ==================
+// Lane-wise operations
+// ==================
+
+template<cFloatType T, Size W>
+SLIB_FUNC constexpr Vector3Packet<T, W> operator+(const Vector3Packet<T, W>& a, const Vector3Packet<T, W>& b)
+{
+    return detail::MapPacket<T, W>([&](Size i) { return a.lane(i) + b.lane(i); });
+}
+
+template<cFloatType T, Size W>
+SLIB_FUNC constexpr Vector3Packet<T, W> operator-(const Vector3Packet<T, W>& a, const Vector3Packet<T, W>& b)
+{
+    return detail::MapPacket<T, W>([&](Size i) { return a.lane(i) - b.lane(i); });
+}
+
+template<cFloatType T, Size W>
+SLIB_FUNC constexpr Vector3Packet<T, W> operator*(const Vector3Packet<T, W>& a, T s)
+{
+    return detail::MapPacket<T, W>([&](Size i) { return a.lane(i) * s; });
+}
+
+template<cFloatType T, Size W>
+SLIB_FUNC constexpr std::array<T, W> Dot(const Vector3Packet<T, W>& a, const Vector3Packet<T, W>& b)
+{
+    std::array<T, W> r;
+    for (Size i = 0; i < W; ++i)
+        r[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+    return r;
+}
+
+template<cFloatType T, Size W>
+SLIB_FUNC constexpr Vector3Packet<T, W> Cross(const Vector3Packet<T, W>& a, const Vector3Packet<T, W>& b)
+{
+    Vector3Packet<T, W> r;
+    for (Size i = 0; i < W; ++i) {
+        r.x[i] = a.y[i] * b.z[i] - a.z[i] * b.y[i];
+        r.y[i] = a.z[i] * b.x[i] - a.x[i] * b.z[i];
+        r.z[i] = a.x[i] * b.y[i] - a.y[i] * b.x[i];
+    }
+    return r;
+}
+
+template<cFloatType T, Size W>
+SLIB_FUNC SLIB_CONSTEXPR Vector3Packet<T, W> Normalize(const Vector3Packet<T, W>& a)
+{
+    Vector3Packet<T, W> r;
+    for (Size i = 0; i < W; ++i) {
+        const T inv = T(1) / Sqrt(a.x[i] * a.x[i] + a.y[i] * a.y[i] + a.z[i] * a.z[i]);
+        r.x[i]      = a.x[i] * inv;
+        r.y[i]      = a.y[i] * inv;
+        r.z[i]      = a.z[i] * inv;
+    }
+    return r;
+}
+
+/**
+ * @brief 以仿射矩阵变换所有通道上的点 (w = 1).
+ */
+template<cFloatType T, Size W>
+SLIB_FUNC constexpr Vector3Packet<T, W> TransformPoint(const Matrix4<T>& m, const Vector3Packet<T, W>& p)
+{
+    Vector3Packet<T, W> r;
+    for (Size i = 0; i < W; ++i) {
+        r.x[i] = m[0].x * p.x[i] + m[1].x * p.y[i] + m[2].x * p.z[i] + m[3].x;
+        r.y[i] = m[0].y * p.x[i] + m[1].y * p.y[i] + m[2].y * p.z[i] + m[3].y;
+        r.z[i] = m[0].z * p.x[i] + m[1].z * p.y[i] + m[2].z * p.z[i] + m[3].z;
+    }
+    return r;
+}
+
+/**
+ * @brief 以仿射矩阵变换所有通道上的方向 (w = 0).
+ */
+template<cFloatType T, Size W>
+SLIB_FUNC constexpr Vector3Packet<T, W> TransformVector(const Matrix4<T>& m, const Vector3Packet<T, W>& v)
+{
+    Vector3Packet<T, W> r;
+    for (Size i = 0; i < W; ++i) {
+        r.x[i] = m[0].x * v.x[i] + m[1].x * v.y[i] + m[2].x * v.z[i];
+        r.y[i] = m[0].y * v.x[i] + m[1].y * v.y[i] + m[2].y * v.z[i];
+        r.z[i] = m[0].z * v.x[i] + m[1].z * v.y[i] + m[2].z * v.z[i];
+    }
+    return r;
+}
+
+// ==================
+// AoS <-> SoA
+// ==================
+
+namespace detail {
+
+#if SLIB_ARCH_X86 || SLIB_HAS_NEON
+/**
+ * @brief 4 个连续的 xyz (12 个 f32) 与 x、y、z 三个 4 通道数组互转.
+ */
+SLIB_FORCE_INLINE void Deinterleave3x4(const f32* p, f32* x, f32* y, f32* z)
+{
+#  if SLIB_ARCH_X86
+    // m0 = x0 y0 z0 x1, m1 = y1 z1 x2 y2, m2 = z2 x3 y3 z3
+    const __m128 m0 = _mm_loadu_ps(p + 0);
+    const __m128 m1 = _mm_loadu_ps(p + 4);
+    const __m128 m2 = _mm_loadu_ps(p + 8);
+    const __m128 xy = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+    const __m128 yz = _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+    _mm_store_ps(x, _mm_shuffle_ps(m0, xy, _MM_SHUFFLE(2, 0, 3, 0)));
+    _mm_store_ps(y, _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+    _mm_store_ps(z, _mm_shuffle_ps(yz, m2, _MM_SHUFFLE(3, 0, 3, 1)));
+#  else
+    const float32x4x3_t v = vld3q_f32(p);
+    vst1q_f32(x, v.val[0]);
+    vst1q_f32(y, v.val[1]);
+    vst1q_f32(z, v.val[2]);
+#  endif
+}
+
+SLIB_FORCE_INLINE void Interleave3x4(const f32* x, const f32* y, const f32* z, f32* p)
+{
+#  if SLIB_ARCH_X86
+    const __m128 vx  = _mm_load_ps(x);
+    const __m128 vy  = _mm_load_ps(y);
+    const __m128 vz  = _mm_load_ps(z);
+    const __m128 rxy = _mm_shuffle_ps(vx, vy, _MM_SHUFFLE(2, 0, 2, 0)); // x0 x2 y0 y2
+    const __m128 ryz = _mm_shuffle_ps(vy, vz, _MM_SHUFFLE(3, 1, 3, 1)); // y1 y3 z1 z3
+    const __m128 rzx = _mm_shuffle_ps(vz, vx, _MM_SHUFFLE(3, 1, 2, 0)); // z0 z2 x1 x3
+    _mm_storeu_ps(p + 0, _mm_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0)));
+    _mm_storeu_ps(p + 8, _mm_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1)));
+#  else
+    vst3q_f32(p, float32x4x3_t{{vld1q_f32(x), vld1q_f32(y), vld1q_f32(z)}});
+#  endif
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief 从连续的 W 个 AoS 向量载入一个打包，src 不需要对齐.
+ */
+template<cFloatType T, Size W>
+SLIB_FORCE_INLINE Vector3Packet<T, W> LoadPacket(const Vector3<T>* src)
+{
+    Vector3Packet<T, W> r;
+#if SLIB_HAS_AVX2
+    if constexpr (std::is_same_v<T, f32> && W == 8) {
+        // 与 Deinterleave3x4 相同的 shuffle，两个 128 位通道各处理 4 个向量
+        const f32* p     = &src->x;
+        const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 12), 1);
+        const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+        const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+        const __m256 xy  = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+        const __m256 yz  = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+        _mm256_store_ps(r.x.data(), _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0)));
+        _mm256_store_ps(r.y.data(), _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_store_ps(r.z.data(), _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1)));
+        return r;
+    }
+#endif
+#if SLIB_ARCH_X86 || SLIB_HAS_NEON
+    if constexpr (std::is_same_v<T, f32> && W % 4 == 0) {
+        for (Size g = 0; g < W; g += 4)
+            detail::Deinterleave3x4(&src[g].x, r.x.data() + g, r.y.data() + g, r.z.data() + g);
+        return r;
+    }
+#endif
+    for (Size i = 0; i < W; ++i)
+        r.setLane(i, src[i]);
+    return r;
+}
+
+/**
+ * @brief 将一个打包写回连续的 W 个 AoS 向量，dst 不需要对齐.
+ */
+template<cFloatType T, Size W>
+SLIB_FORCE_INLINE void StorePacket(const Vector3Packet<T, W>& packet, Vector3<T>* dst)
+{
+#if SLIB_HAS_AVX2
+    if constexpr (std::is_same_v<T, f32> && W == 8) {
+        const __m256 x   = _mm256_load_ps(packet.x.data());
+        const __m256 y   = _mm256_load_ps(packet.y.data());
+        const __m256 z   = _mm256_load_ps(packet.z.data());
+        const __m256 rxy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 ryz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m256 rzx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256 r03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 r14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256 r25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+        f32* p = &dst->x;
+        _mm_storeu_ps(p + 0, _mm256_castps256_ps128(r03));
+        _mm_storeu_ps(p + 4, _mm256_castps256_ps128(r14));
+        _mm_storeu_ps(p + 8, _mm256_castps256_ps128(r25));
+        _mm_storeu_ps(p + 12, _mm256_extractf128_ps(r03, 1));
+        _mm_storeu_ps(p + 16, _mm256_extractf128_ps(r14, 1));
+        _mm_storeu_ps(p + 20, _mm256_extractf128_ps(r25, 1));
+        return;
+    }
+#endif
+#if SLIB_ARCH_X86 || SLIB_HAS_NEON
+    if constexpr (std::is_same_v<T, f32> && W % 4 == 0) {
+        for (Size g = 0; g < W; g += 4)
+            detail::Interleave3x4(packet.x.data() + g, packet.y.data() + g, packet.z.data() + g, &dst[g].x);
+        return;
+    }
+#endif
+    for (Size i = 0; i < W; ++i)
+        dst[i] = packet.lane(i);
+}
+
+/**
+ * @brief AoS 数组转为三个 SoA 分量数组，各数组长度不得小于 in.
+ */
+void TransposeToSoA(std::span<const Vec3f> in, std::span<f32> x, std::span<f32> y, std::span<f32> z);
+
+/**
+ * @brief 三个 SoA 分量数组转为 AoS 数组，out 长度不得小于 x.
+ */
+void TransposeToAoS(std::span<const f32> x, std::span<const f32> y, std::span<const f32> z, std::span<Vec3f> out);
+
+/**
+ * @brief 批量变换 AoS 点集 (w = 1)，以 Vec3x8 为单位在寄存器内转置后计算，in 与 out 可以是同一数组.
+ */
+void TransformPoints(const Mat4f& m, std::span<const Vec3f> in, std::span<Vec3f> out);
+
+} // namespace slib
@@ -0,0 +1,59 @@
+﻿/**
+ * @File Memory.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Memory.hpp"
+
+#include <SLib/Concurrency/ShardedCounter.hpp>
+
+using namespace slib;
+
+namespace {
+
+struct AllocationCounters
+{
+    ShardedCounter allocations;
+    ShardedCounter deallocations;
+    ShardedCounter liveBytes;
+    MaxGauge largest;
+};
+
+/**
+ * 计数器不析构: 其他静态或线程局部对象在退出阶段释放内存时仍会上报.
+ */
+AllocationCounters& Counters()
+{
+    static auto* counters = new AllocationCounters;
+    return *counters;
+}
+
+} // namespace
+
+AllocationStats slib::GetAllocationStats()
+{
+    const auto& c = Counters();
+    return {
+        .allocations       = c.allocations.value(),
+        .deallocations     = c.deallocations.value(),
+        .liveBytes         = c.liveBytes.value(),
+        .largestAllocation = Max<i64>(c.largest.value(), 0),
+    };
+}
+
+void slib::detail::TrackAllocation(Size size)
+{
+    auto& c = Counters();
+    c.allocations.increment();
+    c.liveBytes.add(static_cast<i64>(size));
+    c.largest.update(static_cast<i64>(size));
+}
+
+void slib::detail::TrackDeallocation(Size size)
+{
+    auto& c = Counters();
+    c.deallocations.increment();
+    c.liveBytes.add(-static_cast<i64>(size));
+}
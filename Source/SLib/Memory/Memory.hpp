@@ -76,4 +76,24 @@ constexpr Size GiB(Size sz) { return detail::MemorySize<3, 1024z>(sz); }
 constexpr Size kMaxAllocationSize = GiB(16);
 constexpr Size kMaxDynamicSize    = MiB(32);
 
+/// ==========================
+
+/**
+ * 进程级分配统计，由 SLib 内部的分配器 (如 RecyclingAllocator) 上报. 计数器按 CPU 分片，上报无锁且无等待.
+ */
+struct AllocationStats
+{
+    i64 allocations       = 0; ///< 累计分配次数
+    i64 deallocations     = 0; ///< 累计释放次数
+    i64 liveBytes         = 0; ///< 尚未释放的字节数
+    i64 largestAllocation = 0; ///< 单次分配的最大字节数
+};
+
+SLIB_NODISCARD AllocationStats GetAllocationStats();
+
+namespace detail {
+void TrackAllocation(Size size);
+void TrackDeallocation(Size size);
+} // namespace detail
+
 } // namespace slib
\ No newline at end of file
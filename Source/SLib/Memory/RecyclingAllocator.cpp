@@ -0,0 +1,117 @@
+﻿/**
+ * @File RecyclingAllocator.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "RecyclingAllocator.hpp"
+
+#include <array>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kClassCount = RecyclingAllocator::kMaxSize / RecyclingAllocator::kGranularity;
+constexpr auto kAlignment  = std::align_val_t{RecyclingAllocator::kGranularity};
+
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+/**
+ * 缓存本身可平凡析构，线程退出后仍可安全访问; 由 CacheReaper 在线程退出时归还内存并禁用缓存，
+ * 这样其他 thread_local 对象在析构中释放的块也能正确处理.
+ */
+struct ThreadCache
+{
+    std::array<FreeBlock*, kClassCount> heads;
+    std::array<u32, kClassCount> counts;
+    bool registered;
+    bool disabled;
+
+    void* pop(Size cls) noexcept
+    {
+        FreeBlock* block = heads[cls];
+        if (block) {
+            heads[cls] = block->next;
+            --counts[cls];
+        }
+        return block;
+    }
+
+    bool push(Size cls, void* p) noexcept;
+
+    void release() noexcept
+    {
+        disabled = true;
+        for (Size cls = 0; cls < kClassCount; ++cls) {
+            while (FreeBlock* block = static_cast<FreeBlock*>(pop(cls)))
+                ::operator delete(block, kAlignment);
+        }
+    }
+};
+
+struct CacheReaper
+{
+    ~CacheReaper();
+};
+
+constinit thread_local ThreadCache tCache{};
+thread_local CacheReaper tReaper;
+
+CacheReaper::~CacheReaper()
+{
+    tCache.release();
+}
+
+bool ThreadCache::push(Size cls, void* p) noexcept
+{
+    if (disabled || counts[cls] >= RecyclingAllocator::kMaxCachedPerClass)
+        return false;
+
+    if (!registered) {
+        // 首次使用 tReaper 时注册其线程退出时的析构
+        registered = true;
+        (void)&tReaper;
+    }
+
+    auto* block = static_cast<FreeBlock*>(p);
+    block->next = heads[cls];
+    heads[cls]  = block;
+    ++counts[cls];
+    return true;
+}
+
+SLIB_FORCE_INLINE Size SizeClass(Size size)
+{
+    return (size - 1) / RecyclingAllocator::kGranularity;
+}
+
+} // namespace
+
+void* RecyclingAllocator::Allocate(Size size)
+{
+    detail::TrackAllocation(size);
+
+    if (size == 0 || size > kMaxSize)
+        return ::operator new(size == 0 ? 1 : size, kAlignment);
+
+    const Size cls = SizeClass(size);
+    if (void* p = tCache.pop(cls))
+        return p;
+    return ::operator new((cls + 1) * kGranularity, kAlignment);
+}
+
+void RecyclingAllocator::Deallocate(void* p, Size size) noexcept
+{
+    if (!p)
+        return;
+
+    detail::TrackDeallocation(size);
+
+    if (size == 0 || size > kMaxSize || !tCache.push(SizeClass(size), p))
+        ::operator delete(p, kAlignment);
+}
@@ -0,0 +1,39 @@
+﻿/**
+ * @File RecyclingAllocator.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <SLib/Memory/Memory.hpp>
+
+namespace slib {
+
+/**
+ * 按大小分级的线程本地回收分配器，面向大小固定、频繁创建销毁的小对象 (例如协程帧).
+ *
+ * 释放的块进入当前线程的空闲链表，后续同级别的分配直接复用，不再经过 malloc. 块可以在任意线程释放，
+ * 它只会归入释放线程的缓存. 每级缓存有上限，超出部分以及大于 kMaxSize 的请求直接交给全局 operator new/delete.
+ * 所有请求都计入 GetAllocationStats.
+ */
+class RecyclingAllocator
+{
+public:
+    /// 级别粒度 (字节)，同时也是返回地址的对齐.
+    static constexpr Size kGranularity = 64;
+    /// 可回收的最大块大小.
+    static constexpr Size kMaxSize = 2048;
+    /// 每级每线程最多缓存的块数.
+    static constexpr Size kMaxCachedPerClass = 64;
+
+    SLIB_NODISCARD static void* Allocate(Size size);
+
+    /**
+     * @brief size 必须与分配时相同.
+     */
+    static void Deallocate(void* p, Size size) noexcept;
+};
+
+} // namespace slib
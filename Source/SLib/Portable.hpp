@@ -198,6 +198,83 @@ static_assert(SLIB_CPLUSPLUS >= 202'002L, "__cplusplus >= 202002L: C++20 at leas
 #  define SLIB_RESTRICT
 #endif
 
+// simd
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  define SLIB_ARCH_X86 1
+#else
+#  define SLIB_ARCH_X86 0
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#  define SLIB_ARCH_ARM64 1
+#else
+#  define SLIB_ARCH_ARM64 0
+#endif
+
+#if SLIB_ARCH_X86 && defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+#  define SLIB_HAS_AVX512 1
+#else
+#  define SLIB_HAS_AVX512 0
+#endif
+
+#if SLIB_ARCH_X86 && (defined(__AVX2__) || SLIB_HAS_AVX512)
+#  define SLIB_HAS_AVX2 1
+#else
+#  define SLIB_HAS_AVX2 0
+#endif
+
+// MSVC never defines __SSSE3__/__SSE4_1__, but every AVX target has both.
+#if SLIB_ARCH_X86 && (defined(__SSE4_1__) || defined(__AVX__) || SLIB_HAS_AVX2)
+#  define SLIB_HAS_SSE41 1
+#else
+#  define SLIB_HAS_SSE41 0
+#endif
+
+#if SLIB_ARCH_X86 && (defined(__SSSE3__) || SLIB_HAS_SSE41)
+#  define SLIB_HAS_SSSE3 1
+#else
+#  define SLIB_HAS_SSSE3 0
+#endif
+
+#if SLIB_ARCH_X86 && (defined(__BMI2__) || (SLIB_COMPILER_MSVC && SLIB_HAS_AVX2))
+#  define SLIB_HAS_BMI2 1
+#else
+#  define SLIB_HAS_BMI2 0
+#endif
+
+#if (SLIB_ARCH_X86 && (defined(__FMA__) || (SLIB_COMPILER_MSVC && SLIB_HAS_AVX2))) || SLIB_ARCH_ARM64
+#  define SLIB_HAS_FMA 1
+#else
+#  define SLIB_HAS_FMA 0
+#endif
+
+#if SLIB_ARCH_X86 && (defined(__F16C__) || (SLIB_COMPILER_MSVC && SLIB_HAS_AVX2))
+#  define SLIB_HAS_F16C 1
+#else
+#  define SLIB_HAS_F16C 0
+#endif
+
+#if SLIB_HAS_AVX512 && defined(__AVX512BF16__)
+#  define SLIB_HAS_AVX512BF16 1
+#else
+#  define SLIB_HAS_AVX512BF16 0
+#endif
+
+#if SLIB_ARCH_ARM64 && (defined(__ARM_NEON) || defined(_M_ARM64))
+#  define SLIB_HAS_NEON 1
+#else
+#  define SLIB_HAS_NEON 0
+#endif
+
+#if SLIB_ARCH_X86
+#  include <immintrin.h>
+#elif SLIB_HAS_NEON
+#  include <arm_neon.h>
+#endif
+
+// cache line
+#define SLIB_CACHE_LINE_SIZE 64
+
 #define SLIB_NO_UNIQUE_ADDRESS [[no_unique_address]]
 #define SLIB_UNUSED            [[maybe_unused]]
 #define SLIB_NODISCARD         [[nodiscard]]
@@ -0,0 +1,120 @@
+﻿/**
+ * @File HdrHistogram.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "HdrHistogram.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+#include <SLib/Error.hpp>
+
+using namespace slib;
+
+HdrHistogram::HdrHistogram(u32 precisionBits, u64 maxValue) : _precisionBits(precisionBits)
+{
+    SLIB_CHECK(precisionBits >= kMinPrecisionBits && precisionBits <= kMaxPrecisionBits, "HdrHistogram precision must be in [1, 16]");
+
+    _bucketCount = BucketIndex(maxValue, precisionBits) + 1;
+    _counts      = std::make_unique<std::atomic<u64>[]>(_bucketCount);
+}
+
+void HdrHistogram::merge(const HdrHistogram& other)
+{
+    SLIB_CHECK(other._precisionBits == _precisionBits && other._bucketCount == _bucketCount, "Merging histograms with different layouts");
+
+    for (Size i = 0; i < _bucketCount; ++i) {
+        if (const u64 c = other._counts[i].load(std::memory_order_relaxed))
+            _counts[i].fetch_add(c, std::memory_order_relaxed);
+    }
+    _sum.fetch_add(other._sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void HdrHistogram::reset()
+{
+    for (Size i = 0; i < _bucketCount; ++i)
+        _counts[i].store(0, std::memory_order_relaxed);
+    _sum.store(0, std::memory_order_relaxed);
+}
+
+u64 HdrHistogram::count() const
+{
+    u64 n = 0;
+    for (Size i = 0; i < _bucketCount; ++i)
+        n += _counts[i].load(std::memory_order_relaxed);
+    return n;
+}
+
+f64 HdrHistogram::mean() const
+{
+    const u64 n = count();
+    return n == 0 ? 0.0 : static_cast<f64>(_sum.load(std::memory_order_relaxed)) / static_cast<f64>(n);
+}
+
+u64 HdrHistogram::percentile(f64 q) const
+{
+    const u64 total = count();
+    if (total == 0)
+        return 0;
+
+    // 第 rank 个 (从 1 开始) 记录所在的桶
+    const auto rank = Max<u64>(static_cast<u64>(std::ceil(Min(Max(q, 0.0), 1.0) * static_cast<f64>(total))), 1);
+    u64 seen        = 0;
+    for (Size i = 0; i < _bucketCount; ++i) {
+        seen += _counts[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+            return BucketUpperBound(i, _precisionBits);
+    }
+    return BucketUpperBound(_bucketCount - 1, _precisionBits);
+}
+
+u64 HdrHistogram::min() const
+{
+    for (Size i = 0; i < _bucketCount; ++i) {
+        if (_counts[i].load(std::memory_order_relaxed))
+            return BucketLowerBound(i, _precisionBits);
+    }
+    return 0;
+}
+
+u64 HdrHistogram::max() const
+{
+    for (Size i = _bucketCount; i-- > 0;) {
+        if (_counts[i].load(std::memory_order_relaxed))
+            return BucketUpperBound(i, _precisionBits);
+    }
+    return 0;
+}
+
+String HdrHistogram::summary() const
+{
+    StringBuilder out;
+    out.format("count={} mean={:.1f} p50={} p90={} p99={} p999={} max={}", count(), mean(), percentile(0.5), percentile(0.9), percentile(0.99),
+               percentile(0.999), max());
+    return out.release();
+}
+
+Result<void> HdrHistogram::save(StringView path) const
+{
+    std::FILE* file = std::fopen(String(path).c_str(), "w");
+    if (!file)
+        return Unexpected(FailureType::IOError, "Cannot open histogram output file");
+
+    std::fprintf(file, "# HdrHistogram precision=%u count=%llu sum=%llu\n", _precisionBits, static_cast<unsigned long long>(count()),
+                 static_cast<unsigned long long>(_sum.load(std::memory_order_relaxed)));
+    for (Size i = 0; i < _bucketCount; ++i) {
+        if (const u64 c = _counts[i].load(std::memory_order_relaxed)) {
+            std::fprintf(file, "%llu %llu %llu\n", static_cast<unsigned long long>(BucketLowerBound(i, _precisionBits)),
+                         static_cast<unsigned long long>(BucketUpperBound(i, _precisionBits)), static_cast<unsigned long long>(c));
+        }
+    }
+
+    const bool ok = std::ferror(file) == 0;
+    std::fclose(file);
+    if (!ok)
+        return Unexpected(FailureType::IOError, "Failed to write histogram output file");
+    return {};
+}
@@ -0,0 +1,119 @@
+﻿/**
+ * @File HdrHistogram.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Math/Common.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * HDR 风格的对数-线性直方图，用于统计延迟分位数 (p99、p999 等).
+ *
+ * 每个 2 的幂区间 [2^e, 2^(e+1)) 再线性细分为 2^precisionBits 个子桶，小于 2^precisionBits 的值精确记录，
+ * 因此任意值的相对误差不超过 2^-precisionBits (默认 7 位，约 0.8%). 桶下标为
+ * (shift << p) + (v >> shift)，其中 shift = FloorLog2(v | 2^p) - p，只需一次前导零计数与几次移位.
+ *
+ * 记录是对单个桶的 relaxed fetch_add，无锁且无等待，多个线程可以同时写入同一个直方图; 热点路径上也可以
+ * 每线程各用一个直方图，统计时再 merge，避免热点桶的缓存行争用. 超过上限的值计入最后一个桶.
+ */
+class HdrHistogram
+{
+public:
+    static constexpr u32 kMinPrecisionBits = 1;
+    static constexpr u32 kMaxPrecisionBits = 16;
+
+    /**
+     * @param precisionBits 每个 2 的幂区间的子桶位数，取值 [1, 16].
+     * @param maxValue 可区分的最大值，决定桶的数量.
+     */
+    explicit HdrHistogram(u32 precisionBits = 7, u64 maxValue = ~u64(0));
+
+    HdrHistogram(const HdrHistogram&)            = delete;
+    HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+    SLIB_NODISCARD u32 precisionBits() const { return _precisionBits; }
+
+    SLIB_NODISCARD Size bucketCount() const { return _bucketCount; }
+
+    SLIB_FORCE_INLINE void record(u64 value, u64 count = 1)
+    {
+        const Size index = Min(BucketIndex(value, _precisionBits), _bucketCount - 1);
+        _counts[index].fetch_add(count, std::memory_order_relaxed);
+        _sum.fetch_add(value * count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 把另一个直方图的计数累加进来，两者的精度与桶数必须相同.
+     */
+    void merge(const HdrHistogram& other);
+
+    void reset();
+
+    SLIB_NODISCARD u64 count() const;
+
+    SLIB_NODISCARD f64 mean() const;
+
+    /**
+     * @brief 第 q (0 ~ 1) 分位数，返回所在桶内的最大值 (与 HdrHistogram 一致，偏保守). 没有记录时返回 0.
+     */
+    SLIB_NODISCARD u64 percentile(f64 q) const;
+
+    SLIB_NODISCARD u64 min() const;
+
+    SLIB_NODISCARD u64 max() const;
+
+    /**
+     * @brief 单行摘要，便于写入 Logger: "count=.. mean=.. p50=.. p90=.. p99=.. p999=.. max=..".
+     */
+    SLIB_NODISCARD String summary() const;
+
+    /**
+     * @brief 以文本格式保存非空的桶: 首行为 "# HdrHistogram precision=.. count=.. sum=.."，之后每行 "下界 上界 计数".
+     */
+    Result<void> save(StringView path) const;
+
+    // ==================
+
+    SLIB_NODISCARD SLIB_FORCE_INLINE static Size BucketIndex(u64 value, u32 precisionBits)
+    {
+        const int shift = FloorLog2(value | (u64(1) << precisionBits)) - static_cast<int>(precisionBits);
+        return (static_cast<Size>(shift) << precisionBits) + static_cast<Size>(value >> shift);
+    }
+
+    /**
+     * @brief 第 index 个桶的下界 (含).
+     */
+    SLIB_NODISCARD static constexpr u64 BucketLowerBound(Size index, u32 precisionBits)
+    {
+        const Size group = index >> precisionBits;
+        const u64 sub    = index & ((Size(1) << precisionBits) - 1);
+        return group == 0 ? sub : ((u64(1) << precisionBits) + sub) << (group - 1);
+    }
+
+    /**
+     * @brief 第 index 个桶的上界 (含).
+     */
+    SLIB_NODISCARD static constexpr u64 BucketUpperBound(Size index, u32 precisionBits)
+    {
+        const Size group = index >> precisionBits;
+        return BucketLowerBound(index, precisionBits) + (group == 0 ? 0 : (u64(1) << (group - 1)) - 1);
+    }
+
+private:
+    u32 _precisionBits;
+    Size _bucketCount;
+    std::unique_ptr<std::atomic<u64>[]> _counts;
+    std::atomic<u64> _sum{0};
+};
+
+} // namespace slib
@@ -0,0 +1,129 @@
+﻿/**
+ * @File PerfCounters.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "PerfCounters.hpp"
+
+#if defined(SLIB_IN_LINUX)
+#  include <cerrno>
+#  include <cstring>
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+using namespace slib;
+
+#if defined(SLIB_IN_LINUX)
+
+namespace {
+
+constexpr std::array<u64, kPerfEventCount> kEventConfigs = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_MISSES,
+};
+
+int OpenEvent(u64 config, int groupFd)
+{
+    perf_event_attr attr{};
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = config;
+    attr.disabled       = groupFd == -1 ? 1 : 0; // 由组长统一开关
+    attr.exclude_kernel = 1;                     // perf_event_paranoid = 2 时只允许用户态计数
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+} // namespace
+
+PerfCounters::PerfCounters()
+{
+    _fds.fill(-1);
+
+    int error = 0;
+    for (Size i = 0; i < kPerfEventCount; ++i) {
+        const int fd = OpenEvent(kEventConfigs[i], _leader);
+        if (fd < 0) {
+            error = errno;
+            continue;
+        }
+        if (_leader < 0)
+            _leader = fd;
+        _fds[i]           = fd;
+        _order[_opened++] = static_cast<PerfEvent>(i);
+        _mask |= 1u << i;
+    }
+
+    if (error == EACCES || error == EPERM)
+        _reason = "perf_event_open not permitted (see /proc/sys/kernel/perf_event_paranoid)";
+    else if (error == ENOENT || error == EOPNOTSUPP)
+        _reason = "hardware counters not supported (virtual machine or missing PMU)";
+    else if (error != 0)
+        _reason = std::strerror(error);
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (int fd : _fds) {
+        if (fd >= 0)
+            close(fd);
+    }
+}
+
+void PerfCounters::start()
+{
+    if (_leader < 0)
+        return;
+    ioctl(_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfSample PerfCounters::stop()
+{
+    PerfSample sample;
+    if (_leader < 0)
+        return sample;
+    ioctl(_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP: { nr, time_enabled, time_running, values[nr] }
+    std::array<u64, 3 + kPerfEventCount> buffer{};
+    const auto bytes = read(_leader, buffer.data(), sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(u64)) || buffer[0] != _opened || buffer[2] == 0)
+        return sample;
+
+    // 计数器被分时复用时按运行时间比例放大
+    const f64 scale = static_cast<f64>(buffer[1]) / static_cast<f64>(buffer[2]);
+    for (Size i = 0; i < _opened; ++i) {
+        const auto event     = static_cast<Size>(_order[i]);
+        sample.values[event] = static_cast<u64>(static_cast<f64>(buffer[3 + i]) * scale);
+        sample.mask |= 1u << event;
+    }
+    return sample;
+}
+
+#else
+
+PerfCounters::PerfCounters() : _reason("perf_event_open is only available on Linux")
+{
+    _fds.fill(-1);
+}
+
+PerfCounters::~PerfCounters() = default;
+
+void PerfCounters::start() { }
+
+PerfSample PerfCounters::stop()
+{
+    return {};
+}
+
+#endif
@@ -0,0 +1,122 @@
+﻿/**
+ * @File PerfCounters.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <array>
+
+#include <SLib/Math/Numeric.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+enum class PerfEvent : u32
+{
+    Cycles,
+    Instructions,
+    BranchMisses,
+    CacheMisses,
+};
+
+constexpr Size kPerfEventCount = static_cast<Size>(PerfEvent::CacheMisses) + 1;
+
+/**
+ * 一段区间内的硬件计数. 只有 mask 中对应位被置位的计数器有效; 计数器被内核分时复用时，数值已按运行时间比例放大.
+ */
+struct PerfSample
+{
+    std::array<u64, kPerfEventCount> values{};
+    u32 mask = 0;
+
+    SLIB_NODISCARD bool has(PerfEvent event) const { return mask & (1u << static_cast<u32>(event)); }
+
+    SLIB_NODISCARD u64 operator[](PerfEvent event) const { return values[static_cast<Size>(event)]; }
+
+    /**
+     * @brief 每周期指令数，周期或指令计数不可用时为 0.
+     */
+    SLIB_NODISCARD f64 ipc() const
+    {
+        if (!has(PerfEvent::Cycles) || !has(PerfEvent::Instructions) || (*this)[PerfEvent::Cycles] == 0)
+            return 0.0;
+        return static_cast<f64>((*this)[PerfEvent::Instructions]) / static_cast<f64>((*this)[PerfEvent::Cycles]);
+    }
+
+    PerfSample& operator+=(const PerfSample& other)
+    {
+        for (Size i = 0; i < kPerfEventCount; ++i)
+            values[i] += other.values[i];
+        mask = mask ? mask & other.mask : other.mask;
+        return *this;
+    }
+};
+
+/**
+ * 基于 Linux perf_event_open 的硬件计数器组 (周期、指令、分支预测失败、缓存未命中)，只统计创建它的线程的用户态事件.
+ *
+ * 虚拟机、容器或 perf_event_paranoid 限制下部分或全部计数器可能无法打开，此时 available() 为 false (或 mask 只包含
+ * 可用的计数器)，start/stop 仍可调用并返回空样本，调用方无需区分平台.
+ */
+class PerfCounters
+{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&)            = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    SLIB_NODISCARD bool available() const { return _mask != 0; }
+
+    /**
+     * @brief 成功打开的计数器的位掩码 (按 PerfEvent 编号).
+     */
+    SLIB_NODISCARD u32 mask() const { return _mask; }
+
+    /**
+     * @brief 计数器不可用的原因，全部可用时为空.
+     */
+    SLIB_NODISCARD const String& unavailableReason() const { return _reason; }
+
+    /**
+     * @brief 清零并开始计数.
+     */
+    void start();
+
+    /**
+     * @brief 停止计数并返回自 start 以来的计数.
+     */
+    PerfSample stop();
+
+private:
+    int _leader = -1;
+    std::array<int, kPerfEventCount> _fds;
+    std::array<PerfEvent, kPerfEventCount> _order{}; ///< 组内读出的顺序
+    Size _opened = 0;
+    u32 _mask    = 0;
+    String _reason;
+};
+
+/**
+ * 作用域计数: 构造时开始，析构时把区间内的计数累加到 out.
+ */
+class PerfScope
+{
+public:
+    PerfScope(PerfCounters& counters, PerfSample& out) : _counters(counters), _out(out) { _counters.start(); }
+
+    ~PerfScope() { _out += _counters.stop(); }
+
+    PerfScope(const PerfScope&)            = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+private:
+    PerfCounters& _counters;
+    PerfSample& _out;
+};
+
+} // namespace slib
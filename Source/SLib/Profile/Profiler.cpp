@@ -0,0 +1,287 @@
+﻿/**
+ * @File Profiler.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Profiler.hpp"
+
+#include <charconv>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace slib;
+using namespace slib::detail;
+
+namespace {
+
+/**
+ * 线程退出时标记缓冲为已退役，缓冲本身由写出线程在排空后回收.
+ */
+struct BufferOwner
+{
+    ProfileBuffer* buffer = nullptr;
+
+    ~BufferOwner()
+    {
+        if (buffer)
+            buffer->retired.store(true, std::memory_order_release);
+        tProfileBuffer = nullptr;
+    }
+};
+
+thread_local BufferOwner tOwner;
+
+/**
+ * 会话状态. mutex 保护缓冲列表与文件; 事件的读取只发生在持有 mutex 的写出方.
+ */
+struct Session
+{
+    std::mutex mutex;
+    std::vector<UniquePtr<ProfileBuffer>> buffers;
+    u32 nextTid = 1;
+
+    std::FILE* file = nullptr;
+    std::string out; ///< 待写出的文本，每次排空后整体写入文件
+    bool firstEvent = true;
+    u64 written     = 0;
+    u64 droppedBase = 0;
+
+    // 计数器校准的起点
+    u64 tick0 = 0;
+    std::chrono::steady_clock::time_point time0;
+
+    std::thread flusher;
+    std::condition_variable wake;
+    bool stop = false;
+};
+
+/**
+ * 会话对象不析构，退出阶段线程仍可能登记缓冲.
+ */
+Session& GetSession()
+{
+    static auto* session = new Session;
+    return *session;
+}
+
+void AppendEscaped(std::string& out, const char* s)
+{
+    for (; *s; ++s) {
+        const auto c = static_cast<unsigned char>(*s);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += static_cast<char>(c);
+        }
+        else if (c < 0x20) {
+            constexpr const char* kHex = "0123456789abcdef";
+            out += "\\u00";
+            out += kHex[c >> 4];
+            out += kHex[c & 0xF];
+        }
+        else {
+            out += static_cast<char>(c);
+        }
+    }
+}
+
+/**
+ * @brief 追加整数或保留 3 位小数的浮点数. 事件量大，避免逐条 fprintf.
+ */
+template<typename T>
+void AppendNumber(std::string& out, T value)
+{
+    char buffer[32];
+    std::to_chars_result result;
+    if constexpr (std::is_floating_point_v<T>)
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 3);
+    else
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+void BeginRecord(Session& session)
+{
+    if (!session.firstEvent)
+        session.out += ",\n";
+    session.firstEvent = false;
+}
+
+void WriteOut(Session& session)
+{
+    std::fwrite(session.out.data(), 1, session.out.size(), session.file);
+    session.out.clear();
+}
+
+void WriteThreadName(Session& session, const ProfileBuffer& buffer)
+{
+    if (!session.file || buffer.name.empty())
+        return;
+    BeginRecord(session);
+    session.out += R"({"name":"thread_name","ph":"M","pid":1,"tid":)";
+    AppendNumber(session.out, buffer.tid);
+    session.out += R"(,"args":{"name":")";
+    AppendEscaped(session.out, buffer.name.c_str());
+    session.out += "\"}}";
+}
+
+/**
+ * @brief 排空所有缓冲并写出，回收已退役的缓冲. 调用方持有 mutex.
+ */
+void Drain(Session& session)
+{
+    // 以会话开始至今的区间校准计数器频率，越往后越精确
+    const u64 tick1        = ReadTimestamp();
+    const auto time1       = std::chrono::steady_clock::now();
+    const double elapsed   = std::chrono::duration<double, std::micro>(time1 - session.time0).count();
+    const double usPerTick = tick1 > session.tick0 && elapsed > 0 ? elapsed / static_cast<double>(tick1 - session.tick0) : 0.0;
+
+    for (Size i = 0; i < session.buffers.size();) {
+        ProfileBuffer& buffer = *session.buffers[i];
+        const bool retired    = buffer.retired.load(std::memory_order_acquire);
+
+        while (auto event = buffer.events.tryPop()) {
+            if (!session.file || event->begin < session.tick0)
+                continue;
+
+            const double ts  = static_cast<double>(event->begin - session.tick0) * usPerTick;
+            const double dur = static_cast<double>(event->end - event->begin) * usPerTick;
+
+            auto& out = session.out;
+            BeginRecord(session);
+            out += R"({"name":")";
+            AppendEscaped(out, event->site->name);
+            out += R"(","cat":"slib","ph":"X","ts":)";
+            AppendNumber(out, ts);
+            out += R"(,"dur":)";
+            AppendNumber(out, dur);
+            out += R"(,"pid":1,"tid":)";
+            AppendNumber(out, buffer.tid);
+            out += R"(,"args":{"loc":")";
+            AppendEscaped(out, event->site->location.file_name());
+            out += ':';
+            AppendNumber(out, event->site->location.line());
+            out += "\"}}";
+            ++session.written;
+        }
+
+        if (retired) {
+            WriteThreadName(session, buffer);
+            session.droppedBase += buffer.dropped.load(std::memory_order_relaxed);
+            session.buffers.erase(session.buffers.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        else {
+            ++i;
+        }
+    }
+}
+
+void FlusherLoop(Session& session, u32 intervalMs)
+{
+    std::unique_lock lock(session.mutex);
+    while (!session.stop) {
+        session.wake.wait_for(lock, std::chrono::milliseconds(intervalMs), [&] { return session.stop; });
+        Drain(session);
+        WriteOut(session);
+        std::fflush(session.file);
+    }
+}
+
+} // namespace
+
+ProfileBuffer* slib::detail::AcquireProfileBuffer()
+{
+    auto& session = GetSession();
+    std::lock_guard lock(session.mutex);
+
+    auto buffer    = MakeUnique<ProfileBuffer>(Profiler::kThreadBufferEvents, session.nextTid++);
+    tProfileBuffer = buffer.get();
+    tOwner.buffer  = buffer.get();
+    session.buffers.push_back(std::move(buffer));
+    return tProfileBuffer;
+}
+
+Result<void> Profiler::Start(const ProfilerOptions& options)
+{
+    auto& session = GetSession();
+    std::lock_guard lock(session.mutex);
+
+    if (session.file)
+        return Unexpected(FailureType::AlreadyExists, "Profiler is already running");
+
+    std::FILE* file = std::fopen(options.path.c_str(), "wb");
+    if (!file)
+        return Unexpected(FailureType::IOError, "Cannot open profiler output file");
+
+    // 丢弃上次会话结束后才完成的区间
+    session.file = nullptr;
+    Drain(session);
+
+    session.file        = file;
+    session.firstEvent  = true;
+    session.written     = 0;
+    session.droppedBase = 0;
+    session.out.clear();
+    for (const auto& buffer : session.buffers)
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    session.tick0 = ReadTimestamp();
+    session.time0 = std::chrono::steady_clock::now();
+    session.stop  = false;
+
+    std::fputs(R"({"displayTimeUnit":"ns","traceEvents":[)" "\n", file);
+    session.flusher = std::thread(FlusherLoop, std::ref(session), Max<u32>(options.flushIntervalMs, 1));
+    sProfilerActive.store(true, std::memory_order_relaxed);
+    return {};
+}
+
+u64 Profiler::Stop()
+{
+    auto& session = GetSession();
+    sProfilerActive.store(false, std::memory_order_relaxed);
+
+    {
+        std::lock_guard lock(session.mutex);
+        if (!session.file || session.stop)
+            return 0;
+        session.stop = true;
+    }
+    session.wake.notify_all();
+    session.flusher.join();
+
+    std::lock_guard lock(session.mutex);
+    Drain(session);
+
+    // 仍存活线程的名称以元数据事件写出，已退出线程的名称在回收缓冲时写出
+    for (const auto& buffer : session.buffers)
+        WriteThreadName(session, *buffer);
+    session.out += "\n]}\n";
+    WriteOut(session);
+    std::fclose(session.file);
+    session.file = nullptr;
+    return session.written;
+}
+
+void Profiler::SetThreadName(StringView name)
+{
+    ProfileBuffer* buffer = tProfileBuffer ? tProfileBuffer : AcquireProfileBuffer();
+
+    auto& session = GetSession();
+    std::lock_guard lock(session.mutex);
+    buffer->name = String(name);
+}
+
+u64 Profiler::DroppedEvents()
+{
+    auto& session = GetSession();
+    std::lock_guard lock(session.mutex);
+
+    u64 dropped = session.droppedBase;
+    for (const auto& buffer : session.buffers)
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    return dropped;
+}
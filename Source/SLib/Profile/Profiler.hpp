@@ -0,0 +1,168 @@
+﻿/**
+ * @File Profiler.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <source_location>
+
+#include <SLib/Concurrency/SPSCQueue.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * @brief 读取高精度计数器: x86 上为 TSC，ARM64 上为虚拟计数器，其他平台为 steady_clock 纳秒.
+ *        计数单位由 Profiler 在导出时对照 steady_clock 校准.
+ */
+SLIB_FORCE_INLINE u64 ReadTimestamp()
+{
+#if SLIB_ARCH_X86
+    return __rdtsc();
+#elif SLIB_ARCH_ARM64 && !SLIB_COMPILER_MSVC
+    u64 value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * 插桩点的静态信息，由 SLIB_PROFILE_SCOPE 在编译期生成.
+ */
+struct ProfileSite
+{
+    const char* name;
+    std::source_location location;
+};
+
+struct ProfileEvent
+{
+    const ProfileSite* site;
+    u64 begin;
+    u64 end;
+};
+
+namespace detail {
+
+/**
+ * 每线程的事件缓冲: 所属线程写入，后台写出线程读取. 线程退出后缓冲由写出线程排空并回收.
+ */
+struct ProfileBuffer
+{
+    ProfileBuffer(Size capacity, u32 tid) : events(capacity), tid(tid) { }
+
+    SPSCQueue<ProfileEvent> events;
+    std::atomic<u64> dropped{0};
+    std::atomic<bool> retired{false};
+    const u32 tid;
+    String name;
+};
+
+inline constinit std::atomic<bool> sProfilerActive{false};
+inline constinit thread_local ProfileBuffer* tProfileBuffer = nullptr;
+
+/**
+ * @brief 为当前线程创建并登记缓冲.
+ */
+ProfileBuffer* AcquireProfileBuffer();
+
+SLIB_FORCE_INLINE void RecordZone(const ProfileSite& site, u64 begin, u64 end)
+{
+    ProfileBuffer* buffer = tProfileBuffer;
+    if (SLIB_UNLIKELY(!buffer))
+        buffer = AcquireProfileBuffer();
+    if (SLIB_UNLIKELY(!buffer->events.tryPush({&site, begin, end})))
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+/**
+ * 作用域计时: 构造时记录开始时间，析构时把完整的区间写入当前线程的缓冲. Profiler 未运行时只有一次 relaxed 读取.
+ */
+class ProfileScope
+{
+public:
+    SLIB_FORCE_INLINE explicit ProfileScope(const ProfileSite& site)
+        : _site(detail::sProfilerActive.load(std::memory_order_relaxed) ? &site : nullptr), _begin(_site ? ReadTimestamp() : 0)
+    {
+    }
+
+    SLIB_FORCE_INLINE ~ProfileScope()
+    {
+        if (_site)
+            detail::RecordZone(*_site, _begin, ReadTimestamp());
+    }
+
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const ProfileSite* _site;
+    u64 _begin;
+};
+
+struct ProfilerOptions
+{
+    String path         = "slib_trace.json"; ///< 输出文件 (Chrome trace-event JSON，可直接用 Perfetto UI 或 chrome://tracing 打开)
+    u32 flushIntervalMs = 20;                ///< 后台写出的间隔 (毫秒)
+};
+
+/**
+ * 进程级的性能记录会话. 运行期间后台线程定期排空各线程缓冲并追加写入文件; 缓冲写满时丢弃新事件并计数.
+ */
+class Profiler
+{
+public:
+    /// 每个线程缓冲的事件数.
+    static constexpr Size kThreadBufferEvents = Size(1) << 15;
+
+    /**
+     * @brief 开始记录. 已在记录或无法创建输出文件时返回错误.
+     */
+    static Result<void> Start(const ProfilerOptions& options = {});
+
+    /**
+     * @brief 停止记录，写出剩余事件并关闭文件. 返回本次会话写出的事件数.
+     */
+    static u64 Stop();
+
+    SLIB_NODISCARD static bool IsActive() { return detail::sProfilerActive.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 设置当前线程在 trace 中显示的名称.
+     */
+    static void SetThreadName(StringView name);
+
+    /**
+     * @brief 本次会话中因缓冲已满而丢弃的事件数.
+     */
+    SLIB_NODISCARD static u64 DroppedEvents();
+};
+
+} // namespace slib
+
+// clang-format off
+
+#if defined(SLIB_ENABLE_PROFILING)
+#  define SLIB_PROFILE_CONCAT_IMPL(a, b) a##b
+#  define SLIB_PROFILE_CONCAT(a, b)      SLIB_PROFILE_CONCAT_IMPL(a, b)
+#  define SLIB_PROFILE_SCOPE(name)                                                                                               \
+      static constexpr ::slib::ProfileSite SLIB_PROFILE_CONCAT(sProfileSite, __LINE__){name, std::source_location::current()}; \
+      ::slib::ProfileScope SLIB_PROFILE_CONCAT(profileScope, __LINE__)(SLIB_PROFILE_CONCAT(sProfileSite, __LINE__))
+#  define SLIB_PROFILE_FUNCTION()   SLIB_PROFILE_SCOPE(std::source_location::current().function_name())
+#  define SLIB_PROFILE_THREAD(name) ::slib::Profiler::SetThreadName(name)
+#else
+#  define SLIB_PROFILE_SCOPE(name)  ((void)0)
+#  define SLIB_PROFILE_FUNCTION()   ((void)0)
+#  define SLIB_PROFILE_THREAD(name) ((void)0)
+#endif
+
+// clang-format on
@@ -0,0 +1,116 @@
+﻿/**
+ * @File BitPack.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "BitPack.hpp"
+#include "Endian.hpp"
+#include <SLib/Error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+using namespace slib;
+
+namespace {
+
+template<u32 Bits>
+constexpr u64 kBitMask = Bits == 64 ? ~0ull : (1ull << Bits) - 1;
+
+template<u32 Bits>
+void PackKernel(std::span<const u32> in, u8* out)
+{
+    u64 buffer = 0;
+    u32 filled = 0;
+    for (const u32 v : in) {
+        buffer |= (v & kBitMask<Bits>) << filled;
+        filled += Bits;
+        if (filled >= 32) {
+            StoreLittleEndian(out, static_cast<u32>(buffer));
+            out     += 4;
+            buffer >>= 32;
+            filled  -= 32;
+        }
+    }
+
+    for (; filled > 0; filled = filled > 8 ? filled - 8 : 0) {
+        *out++   = static_cast<u8>(buffer);
+        buffer >>= 8;
+    }
+}
+
+template<u32 Bits>
+void UnpackKernel(const u8* in, std::span<u32> out)
+{
+    const Size n     = out.size();
+    const Size total = BitPackedSize(n, Bits);
+
+    // Bits + 7 <= 39, 一次 8 字节的非对齐读取总能覆盖一个完整的值
+    Size i = 0;
+    for (; i < n; ++i) {
+        const Size bit = i * Bits;
+        if ((bit >> 3) + 8 > total)
+            break;
+        out[i] = static_cast<u32>((LoadLittleEndian<u64>(in + (bit >> 3)) >> (bit & 7)) & kBitMask<Bits>);
+    }
+
+    for (; i < n; ++i) {
+        const Size bit   = i * Bits;
+        const Size first = bit >> 3;
+        u64 word         = 0;
+        for (Size b = first; b < total; ++b)
+            word |= static_cast<u64>(in[b]) << (8 * (b - first));
+        out[i] = static_cast<u32>((word >> (bit & 7)) & kBitMask<Bits>);
+    }
+}
+
+using PackFunc   = void (*)(std::span<const u32>, u8*);
+using UnpackFunc = void (*)(const u8*, std::span<u32>);
+
+template<Size... I>
+constexpr std::array<PackFunc, sizeof...(I)> MakePackTable(std::index_sequence<I...>)
+{
+    return {&PackKernel<I + 1>...};
+}
+
+template<Size... I>
+constexpr std::array<UnpackFunc, sizeof...(I)> MakeUnpackTable(std::index_sequence<I...>)
+{
+    return {&UnpackKernel<I + 1>...};
+}
+
+constexpr auto kPackTable   = MakePackTable(std::make_index_sequence<32>{});
+constexpr auto kUnpackTable = MakeUnpackTable(std::make_index_sequence<32>{});
+
+} // namespace
+
+u32 slib::RequiredBitWidth(std::span<const u32> values)
+{
+    u32 acc = 0;
+    for (const u32 v : values)
+        acc |= v;
+    return static_cast<u32>(BitWidth(acc));
+}
+
+void slib::BitPack(std::span<const u32> in, u32 bits, u8* out)
+{
+    SLIB_CHECK(bits <= 32, "Invalid bit width '{}'.", bits);
+    if (bits == 0)
+        return;
+
+    kPackTable[bits - 1](in, out);
+}
+
+void slib::BitUnpack(const u8* in, u32 bits, std::span<u32> out)
+{
+    SLIB_CHECK(bits <= 32, "Invalid bit width '{}'.", bits);
+    if (bits == 0) {
+        std::ranges::fill(out, 0u);
+        return;
+    }
+
+    kUnpackTable[bits - 1](in, out);
+}
@@ -0,0 +1,42 @@
+﻿/**
+ * @File BitPack.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <span>
+
+#include <SLib/Math/Bits.hpp>
+
+namespace slib {
+
+/**
+ * @brief 以 bits 位宽紧密排列 count 个整数所需的字节数.
+ */
+SLIB_FUNC constexpr Size BitPackedSize(Size count, u32 bits)
+{
+    return (count * bits + 7) / 8;
+}
+
+/**
+ * @brief 计算能无损打包 values 的最小位宽.
+ */
+u32 RequiredBitWidth(std::span<const u32> values);
+
+/**
+ * @brief 将每个整数的低 bits 位 (1-32) 按 LSB 优先的顺序紧密写入 out.
+ *
+ * out 至少需要 BitPackedSize(in.size(), bits) 字节；超出 bits 的高位会被丢弃.
+ * 每种位宽都有独立的模板实例，移位量均为编译期常量.
+ */
+void BitPack(std::span<const u32> in, u32 bits, u8* out);
+
+/**
+ * @brief BitPack 的逆操作，从 in 中读取 out.size() 个 bits 位宽的整数.
+ */
+void BitUnpack(const u8* in, u32 bits, std::span<u32> out);
+
+} // namespace slib
@@ -0,0 +1,93 @@
+﻿/**
+ * @File Endian.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Endian.hpp"
+#include <SLib/Error.hpp>
+
+using namespace slib;
+
+namespace {
+
+#if SLIB_HAS_SSSE3
+template<typename T>
+__m128i ByteSwapMask()
+{
+    if constexpr (sizeof(T) == 2)
+        return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    else if constexpr (sizeof(T) == 4)
+        return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    else
+        return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+#endif
+
+#if SLIB_HAS_NEON
+template<typename T>
+uint8x16_t ByteSwap128(uint8x16_t v)
+{
+    if constexpr (sizeof(T) == 2)
+        return vrev16q_u8(v);
+    else if constexpr (sizeof(T) == 4)
+        return vrev32q_u8(v);
+    else
+        return vrev64q_u8(v);
+}
+#endif
+
+template<typename T>
+void ByteSwapKernel(std::span<const T> src, std::span<T> dst)
+{
+    SLIB_CHECK(dst.size() >= src.size(), "Destination is too small ({} < {}).", dst.size(), src.size());
+
+    Size i = 0;
+
+#if SLIB_HAS_SSSE3 || SLIB_HAS_NEON
+    const auto* s    = reinterpret_cast<const u8*>(src.data());
+    auto* d          = reinterpret_cast<u8*>(dst.data());
+    const Size bytes = src.size_bytes();
+#endif
+
+#if SLIB_HAS_SSSE3
+    const __m128i mask = ByteSwapMask<T>();
+#  if SLIB_HAS_AVX2
+    const __m256i mask2 = _mm256_broadcastsi128_si256(mask);
+    for (; i + 64 <= bytes; i += 64) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), _mm256_shuffle_epi8(a, mask2));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i + 32), _mm256_shuffle_epi8(b, mask2));
+    }
+#  endif
+    for (; i + 16 <= bytes; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_shuffle_epi8(v, mask));
+    }
+#elif SLIB_HAS_NEON
+    for (; i + 16 <= bytes; i += 16)
+        vst1q_u8(d + i, ByteSwap128<T>(vld1q_u8(s + i)));
+#endif
+
+    for (Size k = i / sizeof(T); k < src.size(); ++k)
+        dst[k] = BitSwap(src[k]);
+}
+
+} // namespace
+
+void slib::ByteSwapBuffer(std::span<const u16> src, std::span<u16> dst)
+{
+    ByteSwapKernel(src, dst);
+}
+
+void slib::ByteSwapBuffer(std::span<const u32> src, std::span<u32> dst)
+{
+    ByteSwapKernel(src, dst);
+}
+
+void slib::ByteSwapBuffer(std::span<const u64> src, std::span<u64> dst)
+{
+    ByteSwapKernel(src, dst);
+}
@@ -0,0 +1,133 @@
+﻿/**
+ * @File Endian.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <span>
+
+#include <SLib/Math/Bits.hpp>
+
+namespace slib {
+
+using Endian = std::endian;
+
+constexpr bool kLittleEndian = Endian::native == Endian::little;
+
+template<std::unsigned_integral T>
+SLIB_FUNC SLIB_CONSTEXPR T ToLittleEndian(T value)
+{
+    if constexpr (kLittleEndian)
+        return value;
+    else
+        return BitSwap(value);
+}
+
+template<std::unsigned_integral T>
+SLIB_FUNC SLIB_CONSTEXPR T ToBigEndian(T value)
+{
+    if constexpr (kLittleEndian)
+        return BitSwap(value);
+    else
+        return value;
+}
+
+template<std::unsigned_integral T>
+SLIB_FUNC SLIB_CONSTEXPR T FromLittleEndian(T value)
+{
+    return ToLittleEndian(value);
+}
+
+template<std::unsigned_integral T>
+SLIB_FUNC SLIB_CONSTEXPR T FromBigEndian(T value)
+{
+    return ToBigEndian(value);
+}
+
+/**
+ * @brief 从任意（可能未对齐的）地址读取小端序整数.
+ */
+template<std::unsigned_integral T>
+SLIB_FUNC T LoadLittleEndian(const void* src)
+{
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return FromLittleEndian(value);
+}
+
+template<std::unsigned_integral T>
+SLIB_FUNC T LoadBigEndian(const void* src)
+{
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return FromBigEndian(value);
+}
+
+template<std::unsigned_integral T>
+SLIB_FUNC void StoreLittleEndian(void* dst, T value)
+{
+    value = ToLittleEndian(value);
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+template<std::unsigned_integral T>
+SLIB_FUNC void StoreBigEndian(void* dst, T value)
+{
+    value = ToBigEndian(value);
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+// ==================
+// Bulk byte swap
+// ==================
+
+/**
+ * @brief 批量翻转每个元素的字节序，x86 上使用 pshufb/vpshufb，ARM 上使用 vrev.
+ *
+ * src 与 dst 可以是同一块内存（原地翻转），但不能部分重叠.
+ */
+void ByteSwapBuffer(std::span<const u16> src, std::span<u16> dst);
+void ByteSwapBuffer(std::span<const u32> src, std::span<u32> dst);
+void ByteSwapBuffer(std::span<const u64> src, std::span<u64> dst);
+
+template<std::unsigned_integral T>
+    requires(sizeof(T) > 1)
+void ByteSwapBuffer(std::span<T> data)
+{
+    ByteSwapBuffer(std::span<const T>(data), data);
+}
+
+/**
+ * @brief 将本机字节序的数组转换为小端序（小端平台上只做拷贝）.
+ */
+template<std::unsigned_integral T>
+    requires(sizeof(T) > 1)
+void ToLittleEndianBuffer(std::span<const T> src, std::span<T> dst)
+{
+    if constexpr (kLittleEndian) {
+        if (src.data() != dst.data())
+            std::memcpy(dst.data(), src.data(), src.size_bytes());
+    }
+    else {
+        ByteSwapBuffer(src, dst);
+    }
+}
+
+template<std::unsigned_integral T>
+    requires(sizeof(T) > 1)
+void ToBigEndianBuffer(std::span<const T> src, std::span<T> dst)
+{
+    if constexpr (kLittleEndian) {
+        ByteSwapBuffer(src, dst);
+    }
+    else {
+        if (src.data() != dst.data())
+            std::memcpy(dst.data(), src.data(), src.size_bytes());
+    }
+}
+
+} // namespace slib
@@ -0,0 +1,209 @@
+﻿/**
+ * @File VarInt.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "VarInt.hpp"
+#include "Endian.hpp"
+
+#include <array>
+
+using namespace slib;
+
+namespace {
+
+constexpr u64 kMsbMask  = 0x8080808080808080ull;
+constexpr u64 kDataMask = 0x7F7F7F7F7F7F7F7Full;
+
+/**
+ * @brief 将（已去掉延续位的）最多 5 个 7 位分组拼接为一个整数.
+ */
+SLIB_FORCE_INLINE u64 CompactGroups(u64 word)
+{
+#if SLIB_HAS_BMI2
+    return _pext_u64(word, kDataMask);
+#else
+    return (word & 0x7F) | ((word >> 1) & (0x7Full << 7)) | ((word >> 2) & (0x7Full << 14)) | ((word >> 3) & (0x7Full << 21)) |
+           ((word >> 4) & (0x7Full << 28));
+#endif
+}
+
+template<typename T>
+Size EncodeVarIntsImpl(std::span<const T> in, u8* out)
+{
+    u8* p = out;
+    for (const T v : in)
+        p += EncodeVarInt(v, p);
+    return static_cast<Size>(p - out);
+}
+
+template<typename T>
+Opt<Size> DecodeVarIntsScalar(const u8* begin, const u8* p, const u8* end, std::span<T> out, Size i)
+{
+    for (; i < out.size(); ++i) {
+        const Size n = DecodeVarInt(p, end, out[i]);
+        if (n == 0)
+            return std::nullopt;
+        p += n;
+    }
+    return static_cast<Size>(p - begin);
+}
+
+// ==================
+// Stream VByte tables
+// ==================
+
+struct StreamVByteTables
+{
+    alignas(16) std::array<std::array<u8, 16>, 256> shuffle{};
+    std::array<u8, 256> length{};
+};
+
+consteval StreamVByteTables MakeStreamVByteTables()
+{
+    StreamVByteTables tables;
+    for (int c = 0; c < 256; ++c) {
+        int offset = 0;
+        for (int lane = 0; lane < 4; ++lane) {
+            const int len = ((c >> (2 * lane)) & 3) + 1;
+            for (int b = 0; b < 4; ++b)
+                tables.shuffle[c][lane * 4 + b] = b < len ? static_cast<u8>(offset + b) : 0x80;
+            offset += len;
+        }
+        tables.length[c] = static_cast<u8>(offset);
+    }
+    return tables;
+}
+
+constexpr StreamVByteTables kStreamVByte = MakeStreamVByteTables();
+
+SLIB_FORCE_INLINE Size StreamVByteLaneLength(u8 control, Size lane)
+{
+    return ((control >> (2 * lane)) & 3) + 1;
+}
+
+SLIB_FORCE_INLINE u32 StreamVByteLength(u32 value)
+{
+    return value < (1u << 8) ? 1 : value < (1u << 16) ? 2 : value < (1u << 24) ? 3 : 4;
+}
+
+} // namespace
+
+Size slib::EncodeVarInts(std::span<const u32> in, u8* out)
+{
+    return EncodeVarIntsImpl(in, out);
+}
+
+Size slib::EncodeVarInts(std::span<const u64> in, u8* out)
+{
+    return EncodeVarIntsImpl(in, out);
+}
+
+Opt<Size> slib::DecodeVarInts(std::span<const u8> in, std::span<u32> out)
+{
+    const u8* begin = in.data();
+    const u8* end   = begin + in.size();
+    const u8* p     = begin;
+
+    Size i = 0;
+    for (; i < out.size() && end - p >= 8; ++i) {
+        const u64 word = LoadLittleEndian<u64>(p);
+        if ((word & 0x80) == 0) {
+            out[i] = static_cast<u32>(word & 0x7F);
+            p     += 1;
+            continue;
+        }
+
+        // 第一个最高位为 0 的字节即为终止字节; 全部置位时 CTZ 返回 64, 长度为 9
+        const int len = (CountTrailingZeros(~word & kMsbMask) >> 3) + 1;
+        if (len > static_cast<int>(kMaxVarIntSize<u32>))
+            return std::nullopt;
+
+        const u64 value = CompactGroups(word & kDataMask & (~0ull >> (64 - 8 * len)));
+        if (value > numeric_limits<u32>::max())
+            return std::nullopt;
+
+        out[i]  = static_cast<u32>(value);
+        p      += len;
+    }
+
+    return DecodeVarIntsScalar(begin, p, end, out, i);
+}
+
+Opt<Size> slib::DecodeVarInts(std::span<const u8> in, std::span<u64> out)
+{
+    return DecodeVarIntsScalar(in.data(), in.data(), in.data() + in.size(), out, 0);
+}
+
+Size slib::StreamVByteEncode(std::span<const u32> in, u8* out)
+{
+    const Size n = in.size();
+    u8* control  = out;
+    u8* data     = out + (n + 3) / 4;
+
+    for (Size i = 0; i < n; i += 4) {
+        u8 c = 0;
+        for (Size lane = 0; lane < 4 && i + lane < n; ++lane) {
+            const u32 v   = in[i + lane];
+            const u32 len = StreamVByteLength(v);
+            // 最大输出长度按每个整数 4 字节预留, 因此总是可以整字写入
+            StoreLittleEndian(data, v);
+            c    |= static_cast<u8>((len - 1) << (2 * lane));
+            data += len;
+        }
+        control[i / 4] = c;
+    }
+
+    return static_cast<Size>(data - out);
+}
+
+Opt<Size> slib::StreamVByteDecode(std::span<const u8> in, std::span<u32> out)
+{
+    const Size n           = out.size();
+    const Size controlSize = (n + 3) / 4;
+    if (in.size() < controlSize)
+        return std::nullopt;
+
+    const u8* control = in.data();
+    const u8* data    = control + controlSize;
+    const u8* end     = in.data() + in.size();
+
+    Size dataSize = 0;
+    for (Size k = 0; k < n / 4; ++k)
+        dataSize += kStreamVByte.length[control[k]];
+    for (Size lane = 0; lane < n % 4; ++lane)
+        dataSize += StreamVByteLaneLength(control[n / 4], lane);
+    if (dataSize > static_cast<Size>(end - data))
+        return std::nullopt;
+
+    Size i = 0;
+#if SLIB_HAS_SSSE3
+    for (; i + 4 <= n && end - data >= 16; i += 4) {
+        const u8 c         = control[i / 4];
+        const __m128i v    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(kStreamVByte.shuffle[c].data()));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_shuffle_epi8(v, mask));
+        data += kStreamVByte.length[c];
+    }
+#elif SLIB_HAS_NEON
+    for (; i + 4 <= n && end - data >= 16; i += 4) {
+        const u8 c = control[i / 4];
+        const uint8x16_t v = vqtbl1q_u8(vld1q_u8(data), vld1q_u8(kStreamVByte.shuffle[c].data()));
+        vst1q_u32(out.data() + i, vreinterpretq_u32_u8(v));
+        data += kStreamVByte.length[c];
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const Size len = StreamVByteLaneLength(control[i / 4], i % 4);
+        u32 v          = 0;
+        for (Size b = 0; b < len; ++b)
+            v |= static_cast<u32>(data[b]) << (8 * b);
+        out[i]  = v;
+        data   += len;
+    }
+
+    return static_cast<Size>(data - in.data());
+}
@@ -0,0 +1,131 @@
+﻿/**
+ * @File VarInt.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <span>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+// ==================
+// ZigZag
+// ==================
+
+/**
+ * @brief 将有符号整数映射为无符号整数，使绝对值小的数编码后也小: 0, -1, 1, -2 -> 0, 1, 2, 3.
+ */
+template<std::signed_integral T>
+SLIB_FUNC SLIB_CONSTEXPR std::make_unsigned_t<T> ZigZagEncode(T value)
+{
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(value >> (detail::BitSize<U>() - 1));
+}
+
+template<std::unsigned_integral T>
+SLIB_FUNC SLIB_CONSTEXPR std::make_signed_t<T> ZigZagDecode(T value)
+{
+    return static_cast<std::make_signed_t<T>>(static_cast<T>(value >> 1) ^ static_cast<T>(-static_cast<T>(value & 1)));
+}
+
+// ==================
+// LEB128 varint
+// ==================
+
+template<std::unsigned_integral T>
+constexpr Size kMaxVarIntSize = (numeric_limits<T>::digits + 6) / 7;
+
+template<std::unsigned_integral T>
+SLIB_FUNC SLIB_CONSTEXPR Size VarIntSize(T value)
+{
+    return static_cast<Size>(BitWidth(static_cast<T>(value | 1)) + 6) / 7;
+}
+
+/**
+ * @brief 写入 LEB128 编码，out 至少需要 kMaxVarIntSize<T> 字节，返回写入的字节数.
+ */
+template<std::unsigned_integral T>
+SLIB_FUNC Size EncodeVarInt(T value, u8* out)
+{
+    Size n = 0;
+    while (value >= 0x80) {
+        out[n++]   = static_cast<u8>(value | 0x80);
+        value    >>= 7;
+    }
+    out[n++] = static_cast<u8>(value);
+    return n;
+}
+
+/**
+ * @brief 读取一个 LEB128 编码，返回消耗的字节数；输入被截断或数值超出 T 的范围时返回 0.
+ */
+template<std::unsigned_integral T>
+SLIB_FUNC Size DecodeVarInt(const u8* in, const u8* end, T& value)
+{
+    T result  = 0;
+    int shift = 0;
+    for (Size i = 0; i < kMaxVarIntSize<T>; ++i) {
+        if (in + i >= end)
+            return 0;
+
+        const T bits = in[i] & 0x7F;
+        // 最后一个字节只能携带 T 剩余的高位
+        if (i + 1 == kMaxVarIntSize<T> && (bits >> (detail::BitSize<T>() - shift)) != 0)
+            return 0;
+
+        result |= static_cast<T>(bits << shift);
+        if ((in[i] & 0x80) == 0) {
+            value = result;
+            return i + 1;
+        }
+        shift += 7;
+    }
+    return 0;
+}
+
+/**
+ * @brief 批量编码，out 至少需要 in.size() * kMaxVarIntSize<T> 字节，返回写入的字节数.
+ */
+Size EncodeVarInts(std::span<const u32> in, u8* out);
+Size EncodeVarInts(std::span<const u64> in, u8* out);
+
+/**
+ * @brief 批量解码 out.size() 个整数，返回消耗的字节数.
+ *
+ * 32 位版本在剩余输入充足时每次读入 8 字节，用 SWAR 一次定位终止字节，
+ * 并用 pext（BMI2）或移位合并 7 位分组，不再逐字节分支.
+ */
+Opt<Size> DecodeVarInts(std::span<const u8> in, std::span<u32> out);
+Opt<Size> DecodeVarInts(std::span<const u8> in, std::span<u64> out);
+
+// ==================
+// Stream VByte
+// ==================
+
+/**
+ * Stream VByte 将每 4 个整数的长度 (1-4 字节) 放进一个控制字节，数据字节紧随所有控制字节之后.
+ * 解码时每个控制字节查表得到一个 pshufb 掩码，一条 shuffle 指令就能还原 4 个整数.
+ * 与 LEB128 不兼容，适合由 SLib 自己读写的数据.
+ */
+SLIB_FUNC constexpr Size StreamVByteMaxEncodedSize(Size count)
+{
+    return (count + 3) / 4 + count * sizeof(u32);
+}
+
+/**
+ * @brief out 至少需要 StreamVByteMaxEncodedSize(in.size()) 字节，返回写入的字节数.
+ */
+Size StreamVByteEncode(std::span<const u32> in, u8* out);
+
+/**
+ * @brief 解码 out.size() 个整数，返回消耗的字节数；输入不完整时返回空.
+ */
+Opt<Size> StreamVByteDecode(std::span<const u8> in, std::span<u32> out);
+
+} // namespace slib
@@ -0,0 +1,220 @@
+﻿/**
+ * @File Atom.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Atom.hpp"
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <SLib/Error.hpp>
+
+using namespace slib;
+using namespace slib::detail;
+
+namespace {
+
+constexpr Size kShardBits    = 6;
+constexpr Size kShards       = Size(1) << kShardBits;
+constexpr Size kInitialSlots = 64;
+constexpr Size kChunkBytes   = 64 * 1024;
+constexpr u32 kAtomsPerPage  = 1u << kAtomPageBits;
+
+/**
+ * 开放寻址的槽位表，槽位为 (哈希低 32 位 << 32 | 编号)，0 表示空. 扩容时整体替换，旧表保留到进程结束，
+ * 正在无锁探测旧表的线程不受影响.
+ */
+struct SlotTable
+{
+    explicit SlotTable(Size capacity) : mask(capacity - 1), slots(std::make_unique<std::atomic<u64>[]>(capacity)) { }
+
+    Size mask;
+    std::unique_ptr<std::atomic<u64>[]> slots;
+};
+
+struct alignas(SLIB_CACHE_LINE_SIZE) Shard
+{
+    std::atomic<SlotTable*> table{nullptr};
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<SlotTable>> tables;
+    Size count = 0;
+
+    // 只追加的内容分块
+    std::vector<std::unique_ptr<char[]>> chunks;
+    char* cursor   = nullptr;
+    Size remaining = 0;
+    Size bytes     = 0;
+};
+
+struct Interner
+{
+    Interner()
+    {
+        for (auto& shard : shards) {
+            shard.tables.push_back(std::make_unique<SlotTable>(kInitialSlots));
+            shard.table.store(shard.tables.back().get(), std::memory_order_release);
+        }
+    }
+
+    Shard shards[kShards];
+    std::atomic<u32> nextId{1};
+};
+
+/**
+ * 不析构，退出阶段仍可能有线程访问驻留字符串.
+ */
+Interner& GetInterner()
+{
+    static auto* interner = new Interner;
+    return *interner;
+}
+
+const AtomEntry& GetEntry(u32 id)
+{
+    return sAtomPages[id >> kAtomPageBits].load(std::memory_order_acquire)[id & (kAtomsPerPage - 1)];
+}
+
+u32 Probe(const SlotTable& table, StringView s, u32 hash)
+{
+    for (Size i = hash & table.mask;; i = (i + 1) & table.mask) {
+        const u64 slot = table.slots[i].load(std::memory_order_acquire);
+        if (slot == 0)
+            return 0;
+        if (static_cast<u32>(slot >> 32) != hash)
+            continue;
+
+        const auto id     = static_cast<u32>(slot);
+        const auto& entry = GetEntry(id);
+        if (entry.size == s.size() && std::memcmp(entry.data, s.data(), s.size()) == 0)
+            return id;
+    }
+}
+
+void InsertSlot(SlotTable& table, u64 slot)
+{
+    Size i = static_cast<u32>(slot >> 32) & table.mask;
+    while (table.slots[i].load(std::memory_order_relaxed) != 0)
+        i = (i + 1) & table.mask;
+    table.slots[i].store(slot, std::memory_order_release);
+}
+
+/**
+ * @brief 复制内容到分片的分块内存，并补上 '\0'. 调用方持有分片锁.
+ */
+const char* CopyPayload(Shard& shard, StringView s)
+{
+    const Size size = s.size() + 1;
+    char* out;
+    if (size > kChunkBytes / 4) {
+        // 大字符串单独分配，不浪费当前分块的剩余空间
+        shard.chunks.push_back(std::make_unique_for_overwrite<char[]>(size));
+        out          = shard.chunks.back().get();
+        shard.bytes += size;
+    }
+    else {
+        if (size > shard.remaining) {
+            shard.chunks.push_back(std::make_unique_for_overwrite<char[]>(kChunkBytes));
+            shard.cursor    = shard.chunks.back().get();
+            shard.remaining = kChunkBytes;
+            shard.bytes    += kChunkBytes;
+        }
+        out              = shard.cursor;
+        shard.cursor    += size;
+        shard.remaining -= size;
+    }
+
+    std::memcpy(out, s.data(), s.size());
+    out[s.size()] = '\0';
+    return out;
+}
+
+u32 NewEntry(Interner& interner, const char* data, u32 size, u32 hash)
+{
+    const u32 id = interner.nextId.fetch_add(1, std::memory_order_relaxed);
+    SLIB_CHECK(id < Atom::kMaxAtoms, "Too many interned strings ({})", id);
+
+    auto& page     = sAtomPages[id >> kAtomPageBits];
+    AtomEntry* ptr = page.load(std::memory_order_acquire);
+    if (!ptr) {
+        // 多个分片可能同时需要新页，只保留一个
+        auto fresh = std::make_unique<AtomEntry[]>(kAtomsPerPage);
+        if (page.compare_exchange_strong(ptr, fresh.get(), std::memory_order_acq_rel))
+            ptr = fresh.release();
+    }
+    ptr[id & (kAtomsPerPage - 1)] = {data, size, hash};
+    return id;
+}
+
+} // namespace
+
+Atom Atom::Intern(StringView s)
+{
+    if (s.empty())
+        return {};
+    SLIB_CHECK(s.size() <= std::numeric_limits<u32>::max(), "Interned string is too long");
+
+    const u64 hash = HashBytes(s.data(), s.size());
+    const auto low = static_cast<u32>(hash);
+    auto& interner = GetInterner();
+    Shard& shard   = interner.shards[hash >> (64 - kShardBits)];
+
+    if (const u32 id = Probe(*shard.table.load(std::memory_order_acquire), s, low))
+        return Atom(id);
+
+    std::lock_guard lock(shard.mutex);
+    SlotTable* table = shard.table.load(std::memory_order_relaxed);
+    if (const u32 id = Probe(*table, s, low))
+        return Atom(id);
+
+    // 负载超过一半时换用两倍大小的表
+    if ((shard.count + 1) * 2 > table->mask + 1) {
+        auto grown = std::make_unique<SlotTable>((table->mask + 1) * 2);
+        for (Size i = 0; i <= table->mask; ++i) {
+            if (const u64 slot = table->slots[i].load(std::memory_order_relaxed))
+                InsertSlot(*grown, slot);
+        }
+        table = grown.get();
+        shard.tables.push_back(std::move(grown));
+        shard.table.store(table, std::memory_order_release);
+    }
+
+    const char* data = CopyPayload(shard, s);
+    const u32 id     = NewEntry(interner, data, static_cast<u32>(s.size()), low);
+    InsertSlot(*table, (u64(low) << 32) | id);
+    ++shard.count;
+    return Atom(id);
+}
+
+Opt<Atom> Atom::Find(StringView s)
+{
+    if (s.empty())
+        return Atom{};
+
+    const u64 hash = HashBytes(s.data(), s.size());
+    Shard& shard   = GetInterner().shards[hash >> (64 - kShardBits)];
+    if (const u32 id = Probe(*shard.table.load(std::memory_order_acquire), s, static_cast<u32>(hash)))
+        return Atom(id);
+    return std::nullopt;
+}
+
+Size Atom::Count()
+{
+    return GetInterner().nextId.load(std::memory_order_relaxed) - 1;
+}
+
+Size Atom::ArenaBytes()
+{
+    auto& interner = GetInterner();
+    Size bytes     = 0;
+    for (auto& shard : interner.shards) {
+        std::lock_guard lock(shard.mutex);
+        bytes += shard.bytes;
+    }
+    return bytes;
+}
@@ -0,0 +1,125 @@
+﻿/**
+ * @File Atom.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <format>
+
+#include <SLib/Math/Hash.hpp>
+#include <SLib/String/StringType.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+namespace detail {
+
+/**
+ * 驻留字符串的记录，写入后不再改变.
+ */
+struct AtomEntry
+{
+    const char* data;
+    u32 size;
+    u32 hash;
+};
+
+inline constexpr u32 kAtomPageBits = 12;
+inline constexpr u32 kAtomPages    = 4096;
+
+/**
+ * 记录按页存放，页一经分配便不再移动或释放，因此可以无锁地由编号找到记录.
+ */
+inline constinit std::atomic<AtomEntry*> sAtomPages[kAtomPages] = {};
+
+} // namespace detail
+
+/**
+ * 进程级的驻留字符串句柄. 相同内容的字符串总是得到同一个 32 位编号，比较与哈希都只涉及整数.
+ *
+ * 内容存放在只追加的分块内存中，直到进程结束都有效，因此 view() 返回的视图可以长期持有 (并以 '\0' 结尾).
+ * 查找按哈希分片，已存在的字符串只需无锁的探测; 首次出现时才获取所在分片的锁并复制内容.
+ * 默认构造的 Atom 表示空字符串.
+ */
+class Atom
+{
+public:
+    /// 最多可驻留的字符串数.
+    static constexpr u32 kMaxAtoms = detail::kAtomPages << detail::kAtomPageBits;
+
+    constexpr Atom() = default;
+
+    /**
+     * @brief 驻留 s，返回其句柄. 可在任意线程调用.
+     */
+    static Atom Intern(StringView s);
+
+    /**
+     * @brief 只查找不插入，s 未被驻留过时返回空.
+     */
+    SLIB_NODISCARD static Opt<Atom> Find(StringView s);
+
+    /**
+     * @brief 已驻留的字符串数 (不含空字符串).
+     */
+    SLIB_NODISCARD static Size Count();
+
+    /**
+     * @brief 为内容分配的总字节数.
+     */
+    SLIB_NODISCARD static Size ArenaBytes();
+
+    SLIB_NODISCARD constexpr u32 id() const { return _id; }
+
+    SLIB_NODISCARD constexpr bool empty() const { return _id == 0; }
+
+    SLIB_NODISCARD StringView view() const
+    {
+        const auto& entry = this->entry();
+        return StringView(entry.data, entry.size);
+    }
+
+    SLIB_NODISCARD const char* c_str() const { return entry().data; }
+
+    SLIB_NODISCARD Size size() const { return entry().size; }
+
+    friend constexpr bool operator==(Atom, Atom)  = default;
+    friend constexpr auto operator<=>(Atom, Atom) = default;
+
+private:
+    constexpr explicit Atom(u32 id) : _id(id) { }
+
+    SLIB_FORCE_INLINE const detail::AtomEntry& entry() const
+    {
+        static constexpr detail::AtomEntry kEmpty{"", 0, 0};
+        if (_id == 0)
+            return kEmpty;
+        const auto* page = detail::sAtomPages[_id >> detail::kAtomPageBits].load(std::memory_order_acquire);
+        return page[_id & ((1u << detail::kAtomPageBits) - 1)];
+    }
+
+    u32 _id = 0;
+};
+
+} // namespace slib
+
+template<>
+struct std::hash<slib::Atom>
+{
+    size_t operator()(slib::Atom atom) const noexcept { return static_cast<size_t>(slib::MixBits(atom.id())); }
+};
+
+template<>
+struct std::formatter<slib::Atom> : std::formatter<std::string_view>
+{
+    template<typename Context>
+    auto format(slib::Atom atom, Context& ctx) const
+    {
+        return std::formatter<std::string_view>::format(std::string_view(atom.c_str(), atom.size()), ctx);
+    }
+};
@@ -0,0 +1,730 @@
+﻿/**
+ * @File Number.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Number.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cstring>
+
+#include <SLib/Math/Bits.hpp>
+#include <SLib/String/Text.hpp>
+
+using namespace slib;
+
+namespace slib::detail {
+
+inline constexpr i32 kMinPowerOfFive = -342;
+inline constexpr i32 kMaxPowerOfFive = 324;
+
+extern const u64 kPowersOfFive128[kMaxPowerOfFive - kMinPowerOfFive + 1][2];
+
+} // namespace slib::detail
+
+namespace {
+
+// ==================
+// 8 个数字一组的 SWAR 解析
+// ==================
+
+SLIB_FORCE_INLINE u64 LoadEight(const char* p)
+{
+    u64 v;
+    std::memcpy(&v, p, sizeof(v));
+    if constexpr (std::endian::native == std::endian::big)
+        v = std::byteswap(v);
+    return v;
+}
+
+/**
+ * @brief 8 个字节是否都是 '0' ~ '9': 高半字节都为 3，且加 6 后不进位到高半字节.
+ */
+SLIB_FORCE_INLINE bool IsEightDigits(u64 v)
+{
+    return ((v & 0xF0F0F0F0F0F0F0F0) | (((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+/**
+ * @brief 把 8 个数字字符转为整数: 相邻两位、四位、八位依次合并，共三次乘法.
+ */
+SLIB_FORCE_INLINE u32 ParseEightDigits(u64 v)
+{
+    constexpr u64 kMask = 0x000000FF000000FF;
+    constexpr u64 kMul1 = 100 + (u64(1000000) << 32);
+    constexpr u64 kMul2 = 1 + (u64(10000) << 32);
+
+    v -= 0x3030303030303030;
+    v  = v * 10 + (v >> 8);
+    v  = ((v & kMask) * kMul1 + ((v >> 16) & kMask) * kMul2) >> 32;
+    return static_cast<u32>(v);
+}
+
+/**
+ * @brief 从 p 开始读取连续的数字累加到 value，返回数字的末尾. 超过 19 位时 value 会回绕，由调用方按位数判断.
+ */
+SLIB_FORCE_INLINE const char* AccumulateDigits(const char* p, const char* end, u64& value)
+{
+    while (end - p >= 8 && IsEightDigits(LoadEight(p))) {
+        value  = value * 100000000 + ParseEightDigits(LoadEight(p));
+        p     += 8;
+    }
+    for (; p < end && IsAsciiDigit(*p); ++p)
+        value = value * 10 + static_cast<u64>(*p - '0');
+    return p;
+}
+
+struct Magnitude
+{
+    u64 value;
+    const char* end;
+    bool overflow;
+};
+
+/**
+ * @brief 解析无符号的数字序列. 超过 19 位时才去掉前导零再数位数: 20 位数只有以 1 开头且没有回绕 (结果不小于 10^19)
+ *        时才不溢出.
+ */
+SLIB_FORCE_INLINE Magnitude ParseMagnitude(const char* p, const char* end)
+{
+    u64 value          = 0;
+    const char* digits = p;
+    p                  = AccumulateDigits(p, end, value);
+
+    auto size = static_cast<Size>(p - digits);
+    if (SLIB_LIKELY(size <= 19))
+        return {value, p, false};
+    for (; *digits == '0'; ++digits)
+        --size;
+    const bool overflow = size > 20 || (size == 20 && (*digits != '1' || value < u64(10000000000000000000u)));
+    return {value, p, overflow};
+}
+
+// ==================
+// 整数格式化: 定点乘法一次得到 n / 10^k 的 32.32 位表示，之后每乘 100 取出两位数字
+// ==================
+
+constexpr char kDigitPairs[] = "00010203040506070809"
+                               "10111213141516171819"
+                               "20212223242526272829"
+                               "30313233343536373839"
+                               "40414243444546474849"
+                               "50515253545556575859"
+                               "60616263646566676869"
+                               "70717273747576777879"
+                               "80818283848586878889"
+                               "90919293949596979899";
+
+SLIB_FORCE_INLINE char* WritePair(char* out, u64 pair)
+{
+    std::memcpy(out, kDigitPairs + pair * 2, 2);
+    return out + 2;
+}
+
+/**
+ * @brief 写出 t 的整数部分 (1 或 2 位)，之后再写 pairs 组两位数字.
+ */
+SLIB_FORCE_INLINE char* WriteFixedPoint(char* out, u64 t, bool oneDigit, int pairs)
+{
+    if (oneDigit)
+        *out++ = static_cast<char>('0' + (t >> 32));
+    else
+        out = WritePair(out, t >> 32);
+    for (int i = 0; i < pairs; ++i) {
+        t   = u64(100) * static_cast<u32>(t);
+        out = WritePair(out, t >> 32);
+    }
+    return out;
+}
+
+/**
+ * @brief 写出恰好 8 位数字，不足时补前导零.
+ */
+SLIB_FORCE_INLINE char* WriteEightDigits(char* out, u32 n)
+{
+    return WriteFixedPoint(out, (u64(n) * 2251799815 >> 19) + 4, false, 3);
+}
+
+// ==================
+// 浮点数的位布局与常量
+// ==================
+
+template<typename Float>
+struct FloatTraits;
+
+template<>
+struct FloatTraits<f64>
+{
+    using Bits = u64;
+
+    static constexpr int kMantissaBits       = 52;
+    static constexpr int kMinExponent        = -1023;
+    static constexpr int kInfinitePower      = 0x7FF;
+    static constexpr i64 kSmallestPowerOfTen = -342;
+    static constexpr i64 kLargestPowerOfTen  = 308;
+    static constexpr i64 kMinRoundToEven     = -4;
+    static constexpr i64 kMaxRoundToEven     = 23;
+    static constexpr i64 kMaxExactPowerOfTen = 22;
+    static constexpr int kMinQ               = -1074; ///< 最小的二进制指数 (次正规数)
+
+    static constexpr f64 kPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+template<>
+struct FloatTraits<f32>
+{
+    using Bits = u32;
+
+    static constexpr int kMantissaBits       = 23;
+    static constexpr int kMinExponent        = -127;
+    static constexpr int kInfinitePower      = 0xFF;
+    static constexpr i64 kSmallestPowerOfTen = -65;
+    static constexpr i64 kLargestPowerOfTen  = 38;
+    static constexpr i64 kMinRoundToEven     = -17;
+    static constexpr i64 kMaxRoundToEven     = 10;
+    static constexpr i64 kMaxExactPowerOfTen = 10;
+    static constexpr int kMinQ               = -149;
+
+    static constexpr f32 kPowersOfTen[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+struct U128
+{
+    u64 high;
+    u64 low;
+};
+
+SLIB_FORCE_INLINE U128 FullMultiply(u64 a, u64 b)
+{
+#if SLIB_COMPILER_MSVC && defined(_M_X64)
+    U128 r;
+    r.low = _umul128(a, b, &r.high);
+    return r;
+#elif SLIB_COMPILER_MSVC
+    return {MulHi64(a, b), a * b};
+#else
+    const auto r = static_cast<unsigned __int128>(a) * b;
+    return {static_cast<u64>(r >> 64), static_cast<u64>(r)};
+#endif
+}
+
+SLIB_FORCE_INLINE const u64* PowerOfFive(i64 q)
+{
+    return detail::kPowersOfFive128[q - detail::kMinPowerOfFive];
+}
+
+// ==================
+// 浮点数解析: Clinger 快速路径与 Eisel-Lemire
+// ==================
+
+template<typename Float>
+SLIB_FORCE_INLINE Float FromBits(u64 mantissa, int power2, bool negative)
+{
+    using Traits = FloatTraits<Float>;
+    u64 bits     = mantissa | (u64(power2) << Traits::kMantissaBits);
+    bits        |= u64(negative) << (sizeof(Float) * 8 - 1);
+    return std::bit_cast<Float>(static_cast<typename Traits::Bits>(bits));
+}
+
+/**
+ * @brief 求 w * 10^q (w 不超过 19 位) 正确舍入后的尾数与阶码. 128 位乘积不足以判定舍入时返回 false.
+ *
+ * 规格化的 w 与 5^q 的 128 位近似相乘，取乘积的高 (尾数位数 + 3) 位; 其余位全为 1 时才需要用近似值的低 64 位修正.
+ * 2 的幂部分由 floor(q * log2(10)) 得到. 恰在两个可表示值正中间的情况只可能出现在 q 较小的一段，此时乘积是精确的，
+ * 单独按偶数舍入.
+ */
+template<typename Float>
+bool ComputeFloat(u64 w, i64 q, u64& mantissa, int& power2)
+{
+    using Traits = FloatTraits<Float>;
+
+    if (w == 0 || q < Traits::kSmallestPowerOfTen) {
+        mantissa = 0;
+        power2   = 0;
+        return true;
+    }
+    if (q > Traits::kLargestPowerOfTen) {
+        mantissa = 0;
+        power2   = Traits::kInfinitePower;
+        return true;
+    }
+
+    const int lz = std::countl_zero(w);
+    w          <<= lz;
+
+    const u64* power             = PowerOfFive(q);
+    constexpr u64 kPrecisionMask = ~u64(0) >> (Traits::kMantissaBits + 3);
+    U128 product                 = FullMultiply(w, power[0]);
+    if ((product.high & kPrecisionMask) == kPrecisionMask) {
+        const U128 second  = FullMultiply(w, power[1]);
+        product.low       += second.high;
+        product.high      += second.high > product.low;
+    }
+    // 近似值的误差只在 q 超出 5^q 可精确表示的范围时才可能影响结果
+    if (product.low == ~u64(0) && (q < -27 || q > 55))
+        return false;
+
+    const int upper = static_cast<int>(product.high >> 63);
+    const int shift = upper + 64 - Traits::kMantissaBits - 3;
+    mantissa        = product.high >> shift;
+    power2          = static_cast<int>((((152170 + 65536) * q) >> 16) + 63) + upper - lz - Traits::kMinExponent;
+
+    if (power2 <= 0) {
+        // 次正规数
+        if (-power2 + 1 >= 64) {
+            mantissa = 0;
+            power2   = 0;
+            return true;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa  += mantissa & 1;
+        mantissa >>= 1;
+        power2     = mantissa < (u64(1) << Traits::kMantissaBits) ? 0 : 1;
+        return true;
+    }
+
+    if (product.low <= 1 && q >= Traits::kMinRoundToEven && q <= Traits::kMaxRoundToEven && (mantissa & 3) == 1) {
+        if ((mantissa << shift) == product.high)
+            mantissa &= ~u64(1);
+    }
+    mantissa  += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (u64(2) << Traits::kMantissaBits)) {
+        mantissa = u64(1) << Traits::kMantissaBits;
+        ++power2;
+    }
+    mantissa &= ~(u64(1) << Traits::kMantissaBits);
+    if (power2 >= Traits::kInfinitePower) {
+        mantissa = 0;
+        power2   = Traits::kInfinitePower;
+    }
+    return true;
+}
+
+template<typename Float>
+Result<ParsedNumber<Float>> FallbackParse(const char* first, const char* last)
+{
+    Float value{};
+    const auto [ptr, ec] = std::from_chars(first, last, value);
+    if (ec == std::errc::invalid_argument)
+        return Unexpected(FailureType::ParseError);
+    if (ec == std::errc::result_out_of_range)
+        return Unexpected(FailureType::OutOfRange);
+    return ParsedNumber<Float>{value, static_cast<Size>(ptr - first)};
+}
+
+template<typename Float>
+Result<ParsedNumber<Float>> ParseFloat(StringView text)
+{
+    using Traits = FloatTraits<Float>;
+
+    const char* const first = text.data();
+    const char* const last  = first + text.size();
+    const char* p           = first;
+
+    const bool negative = p < last && *p == '-';
+    p                  += negative;
+    const char* digits  = p;
+
+    u64 w           = 0;
+    p               = AccumulateDigits(p, last, w);
+    Size digitCount = static_cast<Size>(p - digits);
+    i64 exponent    = 0;
+    if (p < last && *p == '.') {
+        const char* fraction = ++p;
+        p                    = AccumulateDigits(p, last, w);
+        exponent             = -(p - fraction);
+        digitCount          += static_cast<Size>(p - fraction);
+    }
+    // 没有数字: inf、nan 或非法输入
+    if (digitCount == 0)
+        return FallbackParse<Float>(first, last);
+
+    // 指数部分必须至少有一位数字，否则不属于这个数
+    if (p < last && (*p | 0x20) == 'e') {
+        const char* e     = p + 1;
+        const bool negExp = e < last && *e == '-';
+        e                += e < last && (*e == '-' || *e == '+');
+        if (e < last && IsAsciiDigit(*e)) {
+            i64 value = 0;
+            for (; e < last && IsAsciiDigit(*e); ++e) {
+                if (value < 0x10000000)
+                    value = value * 10 + (*e - '0');
+            }
+            exponent += negExp ? -value : value;
+            p         = e;
+        }
+    }
+    const auto length = static_cast<Size>(p - first);
+
+    if (digitCount > 19) {
+        // 前导零 (包括小数点后的) 不是有效数字
+        for (const char* z = digits; z < p && (*z == '0' || *z == '.'); ++z)
+            digitCount -= *z == '0';
+        if (digitCount > 19)
+            return FallbackParse<Float>(first, last);
+    }
+
+    Float value;
+    if (w <= (u64(1) << (Traits::kMantissaBits + 1)) && exponent >= -Traits::kMaxExactPowerOfTen &&
+        exponent <= Traits::kMaxExactPowerOfTen) {
+        // w 与 10^|q| 都能精确表示，一次乘除即为正确舍入的结果
+        value = static_cast<Float>(w);
+        value = exponent < 0 ? value / Traits::kPowersOfTen[-exponent] : value * Traits::kPowersOfTen[exponent];
+        value = negative ? -value : value;
+    }
+    else {
+        u64 mantissa;
+        int power2;
+        if (!ComputeFloat<Float>(w, exponent, mantissa, power2))
+            return FallbackParse<Float>(first, last);
+        if (power2 == Traits::kInfinitePower || (w != 0 && power2 == 0 && mantissa == 0))
+            return Unexpected(FailureType::OutOfRange);
+        value = FromBits<Float>(mantissa, power2, negative);
+    }
+    return ParsedNumber<Float>{value, length};
+}
+
+// ==================
+// 浮点数格式化: Schubfach
+// ==================
+
+SLIB_FORCE_INLINE i32 FloorLog10Pow2(i32 q)
+{
+    return static_cast<i32>((i64(q) * 661971961083) >> 41);
+}
+
+SLIB_FORCE_INLINE i32 FloorLog10ThreeQuartersPow2(i32 q)
+{
+    return static_cast<i32>((i64(q) * 661971961083 - 274743187321) >> 41);
+}
+
+SLIB_FORCE_INLINE i32 FloorLog2Pow10(i32 e)
+{
+    return static_cast<i32>((i64(e) * 913124641741) >> 38);
+}
+
+/**
+ * @brief 10^-k 规格化到 [2^125, 2^126) 后取 floor + 1，拆为高 63 位 g1 与低 63 位 g0.
+ *        由 5^-k 的 128 位近似去掉末两位得到; 5^q (-27 <= q < 0) 的表项是向上取整的，先减 1.
+ */
+SLIB_FORCE_INLINE void InversePowerOfTen(i32 k, u64& g1, u64& g0)
+{
+    const u64* power = PowerOfFive(-k);
+    const u64 borrow = k > 0 && k <= 27;
+    const u64 low    = power[1] - borrow;
+    const u64 high   = power[0] - (power[1] < borrow);
+
+    u64 gLow        = ((high << 62) | (low >> 2)) + 1;
+    const u64 gHigh = (high >> 2) + (gLow == 0);
+    g1              = (gHigh << 1) | (gLow >> 63);
+    g0              = gLow & (~u64(0) >> 1);
+}
+
+struct Decimal
+{
+    u64 significand;
+    i32 exponent;
+};
+
+/**
+ * @brief g * cp / 2^127 的整数部分，有非零余数时置最低位 (向奇数舍入)，保留判定舍入所需的信息.
+ */
+SLIB_FORCE_INLINE u64 RoundToOdd(u64 g1, u64 g0, u64 cp)
+{
+    const u64 x1 = MulHi64(g0, cp);
+    const u64 y0 = g1 * cp;
+    const u64 y1 = MulHi64(g1, cp);
+    const u64 z  = (y0 >> 1) + x1;
+    const u64 vb = y1 + (z >> 63);
+    return vb | (((z & (~u64(0) >> 1)) + (~u64(0) >> 1)) >> 63);
+}
+
+SLIB_FORCE_INLINE u64 RoundToOdd(u64 g, u64 cp)
+{
+    const u64 x1 = MulHi64(g, cp);
+    return (x1 >> 31) | (((x1 & 0xFFFFFFFF) + 0xFFFFFFFF) >> 32);
+}
+
+/**
+ * @brief c * 2^q 的舍入区间内最短的十进制数. 先在区间内找 10 的倍数 (少一位)，否则在最近的两个整数中选择更近者.
+ *        原算法要求至少两位有效数字 (s >= 100)，这里放宽到 s >= 10，使最小的次正规数也输出一位数字.
+ */
+template<typename Float>
+Decimal ToDecimal(i32 q, u64 c)
+{
+    using Traits = FloatTraits<Float>;
+
+    const u64 out = c & 1;
+    const u64 cb  = c << 2;
+    const u64 cbr = cb + 2;
+    u64 cbl;
+    i32 k;
+    // 尾数为 2 的幂时下侧间隔只有上侧的一半
+    if (c != (u64(1) << Traits::kMantissaBits) || q == Traits::kMinQ) {
+        cbl = cb - 2;
+        k   = FloorLog10Pow2(q);
+    }
+    else {
+        cbl = cb - 1;
+        k   = FloorLog10ThreeQuartersPow2(q);
+    }
+
+    u64 vb, vbl, vbr;
+    if constexpr (std::is_same_v<Float, f64>) {
+        const i32 h = q + FloorLog2Pow10(-k) + 2;
+        u64 g1, g0;
+        InversePowerOfTen(k, g1, g0);
+        vb  = RoundToOdd(g1, g0, cb << h);
+        vbl = RoundToOdd(g1, g0, cbl << h);
+        vbr = RoundToOdd(g1, g0, cbr << h);
+    }
+    else {
+        const i32 h = q + FloorLog2Pow10(-k) + 33;
+        u64 g1, g0;
+        InversePowerOfTen(k, g1, g0);
+        vb  = RoundToOdd(g1 + 1, cb << h);
+        vbl = RoundToOdd(g1 + 1, cbl << h);
+        vbr = RoundToOdd(g1 + 1, cbr << h);
+    }
+
+    const u64 s = vb >> 2;
+    if (s >= 10) {
+        const u64 sp10  = s / 10 * 10;
+        const u64 tp10  = sp10 + 10;
+        const bool upin = vbl + out <= sp10 << 2;
+        const bool wpin = (tp10 << 2) + out <= vbr;
+        if (upin != wpin)
+            return {upin ? sp10 : tp10, k};
+    }
+
+    const u64 t    = s + 1;
+    const bool uin = vbl + out <= s << 2;
+    const bool win = (t << 2) + out <= vbr;
+    if (uin != win)
+        return {uin ? s : t, k};
+
+    const auto cmp = static_cast<i64>(vb - ((s + t) << 1));
+    return {cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k};
+}
+
+/**
+ * @brief 有限且非零的 |value| 的最短十进制表示.
+ */
+template<typename Float>
+Decimal ShortestDecimal(Float value)
+{
+    using Traits = FloatTraits<Float>;
+
+    const u64 bits = std::bit_cast<typename Traits::Bits>(value);
+    const auto bq  = static_cast<i32>((bits >> Traits::kMantissaBits) & Traits::kInfinitePower);
+    const u64 t    = bits & ((u64(1) << Traits::kMantissaBits) - 1);
+
+    if (bq == 0)
+        return ToDecimal<Float>(Traits::kMinQ, t);
+
+    const i32 q = bq + Traits::kMinQ - 1;
+    const u64 c = t | (u64(1) << Traits::kMantissaBits);
+    // 小于 2^(尾数位数 + 1) 的整数直接输出
+    if (q < 0 && -q <= Traits::kMantissaBits) {
+        const u64 f = c >> -q;
+        if (f << -q == c)
+            return {f, 0};
+    }
+    return ToDecimal<Float>(q, c);
+}
+
+/**
+ * @brief 写出整数 c * 2^q 的全部数字，c * 2^q 小于 10^22. 把 c 拆为 a * 10^8 + b 后两部分都不超过 64 位.
+ */
+char* WriteExactInteger(char* out, u64 c, i32 q)
+{
+    const u64 a    = c / 100000000;
+    const u64 b    = (c - a * 100000000) << q;
+    const u64 high = (a << q) + b / 100000000;
+    const auto low = static_cast<u32>(b % 100000000);
+    if (high == 0)
+        return detail::FormatU32(out, low);
+    return WriteEightDigits(detail::FormatU64(out, high), low);
+}
+
+/**
+ * @brief 按 std::to_chars 的最短格式写出 significand * 10^exponent: 定点与科学计数取较短者，等长取定点.
+ *        定点写法补零时与 std::to_chars 一样写出 c * 2^q 的精确整数值.
+ */
+char* WriteDecimal(char* out, Decimal decimal, u64 c, i32 q)
+{
+    while (decimal.significand % 10 == 0) {
+        decimal.significand /= 10;
+        ++decimal.exponent;
+    }
+
+    char digits[20];
+    const auto n       = static_cast<i32>(detail::FormatU64(digits, decimal.significand) - digits);
+    const i32 e        = decimal.exponent;
+    const i32 sciExp   = e + n - 1;
+    const i32 sciLen   = n + (n > 1) + 2 + (sciExp >= 100 || sciExp <= -100 ? 3 : 2);
+    const i32 fixedLen = e >= 0 ? n + e : (sciExp >= 0 ? n + 1 : n + 1 - sciExp);
+
+    if (fixedLen <= sciLen) {
+        if (e > 0 && q > 0)
+            return WriteExactInteger(out, c, q);
+        if (e >= 0) {
+            std::memcpy(out, digits, static_cast<Size>(n));
+            std::memset(out + n, '0', static_cast<Size>(e));
+            return out + n + e;
+        }
+        if (sciExp >= 0) {
+            std::memcpy(out, digits, static_cast<Size>(sciExp + 1));
+            out[sciExp + 1] = '.';
+            std::memcpy(out + sciExp + 2, digits + sciExp + 1, static_cast<Size>(n - sciExp - 1));
+            return out + n + 1;
+        }
+        out[0] = '0';
+        out[1] = '.';
+        std::memset(out + 2, '0', static_cast<Size>(-sciExp - 1));
+        std::memcpy(out + 1 - sciExp, digits, static_cast<Size>(n));
+        return out + fixedLen;
+    }
+
+    *out++ = digits[0];
+    if (n > 1) {
+        *out++ = '.';
+        std::memcpy(out, digits + 1, static_cast<Size>(n - 1));
+        out += n - 1;
+    }
+    *out++        = 'e';
+    *out++        = sciExp < 0 ? '-' : '+';
+    const u32 abs = static_cast<u32>(sciExp < 0 ? -sciExp : sciExp);
+    if (abs >= 100) {
+        *out++ = static_cast<char>('0' + abs / 100);
+        return WritePair(out, abs % 100);
+    }
+    return WritePair(out, abs);
+}
+
+template<typename Float>
+char* FormatFloat(char* out, Float value)
+{
+    using Traits = FloatTraits<Float>;
+
+    const u64 bits = std::bit_cast<typename Traits::Bits>(value);
+    if (bits >> (sizeof(Float) * 8 - 1))
+        *out++ = '-';
+
+    const u64 exponentBits = (bits >> Traits::kMantissaBits) & Traits::kInfinitePower;
+    const u64 mantissaBits = bits & ((u64(1) << Traits::kMantissaBits) - 1);
+    if (exponentBits == Traits::kInfinitePower) {
+        std::memcpy(out, mantissaBits ? "nan" : "inf", 3);
+        return out + 3;
+    }
+    if (exponentBits == 0 && mantissaBits == 0) {
+        *out = '0';
+        return out + 1;
+    }
+    const i32 q = static_cast<i32>(exponentBits) + Traits::kMinQ - 1;
+    const u64 c = mantissaBits | (u64(1) << Traits::kMantissaBits);
+    return WriteDecimal(out, ShortestDecimal(value), c, q);
+}
+
+} // namespace
+
+// ==================
+// 解析
+// ==================
+
+Result<ParsedNumber<u64>> slib::detail::ParseUnsigned(StringView text, u64 max)
+{
+    const char* const first = text.data();
+    const char* const last  = first + text.size();
+    if (first == last || !IsAsciiDigit(*first))
+        return Unexpected(FailureType::ParseError);
+
+    const auto magnitude = ParseMagnitude(first, last);
+    if (magnitude.overflow || magnitude.value > max)
+        return Unexpected(FailureType::OutOfRange);
+    return ParsedNumber<u64>{magnitude.value, static_cast<Size>(magnitude.end - first)};
+}
+
+Result<ParsedNumber<i64>> slib::detail::ParseSigned(StringView text, i64 min, i64 max)
+{
+    const char* const first = text.data();
+    const char* const last  = first + text.size();
+    const bool negative     = first != last && *first == '-';
+    const char* p           = first + negative;
+    if (p == last || !IsAsciiDigit(*p))
+        return Unexpected(FailureType::ParseError);
+
+    const auto magnitude = ParseMagnitude(p, last);
+    const u64 limit      = negative ? u64(0) - static_cast<u64>(min) : static_cast<u64>(max);
+    if (magnitude.overflow || magnitude.value > limit)
+        return Unexpected(FailureType::OutOfRange);
+
+    const u64 value = negative ? u64(0) - magnitude.value : magnitude.value;
+    return ParsedNumber<i64>{static_cast<i64>(value), static_cast<Size>(magnitude.end - first)};
+}
+
+Result<ParsedNumber<f32>> slib::detail::ParseF32(StringView text)
+{
+    return ParseFloat<f32>(text);
+}
+
+Result<ParsedNumber<f64>> slib::detail::ParseF64(StringView text)
+{
+    return ParseFloat<f64>(text);
+}
+
+// ==================
+// 格式化
+// ==================
+
+char* slib::detail::FormatU32(char* out, u32 n)
+{
+    if (n < 100) {
+        if (n < 10) {
+            *out = static_cast<char>('0' + n);
+            return out + 1;
+        }
+        return WritePair(out, n);
+    }
+    if (n < 1000000) {
+        if (n < 10000)
+            return WriteFixedPoint(out, u64(n) * 42949673, n < 1000, 1);
+        return WriteFixedPoint(out, u64(n) * 429497, n < 100000, 2);
+    }
+    if (n < 100000000)
+        return WriteFixedPoint(out, (u64(n) * 2251799815 >> 19) + 4, n < 10000000, 3);
+    return WriteFixedPoint(out, (u64(n) * 2882303762 >> 26) + 4, n < 1000000000, 4);
+}
+
+char* slib::detail::FormatU64(char* out, u64 n)
+{
+    if (n <= 0xFFFFFFFF)
+        return FormatU32(out, static_cast<u32>(n));
+
+    const u64 high = n / 100000000;
+    const auto low = static_cast<u32>(n - high * 100000000);
+    if (high <= 0xFFFFFFFF) {
+        out = FormatU32(out, static_cast<u32>(high));
+    }
+    else {
+        const auto top = static_cast<u32>(high / 100000000);
+        out            = FormatU32(out, top);
+        out            = WriteEightDigits(out, static_cast<u32>(high - u64(top) * 100000000));
+    }
+    return WriteEightDigits(out, low);
+}
+
+char* slib::detail::FormatF32(char* out, f32 value)
+{
+    return FormatFloat(out, value);
+}
+
+char* slib::detail::FormatF64(char* out, f64 value)
+{
+    return FormatFloat(out, value);
+}
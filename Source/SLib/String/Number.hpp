@@ -0,0 +1,144 @@
+﻿/**
+ * @File Number.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/String/StringType.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+/**
+ * 可以解析与格式化的数值类型: 除 bool 外的整数，以及 f32、f64.
+ */
+template<typename T>
+concept cNumberType = (cIntegralType<T> and not cBoolType<T>) or cF32Type<T> or cF64Type<T>;
+
+/// FormatNumber 最多写出的字节数，例如 "-2.2250738585072014e-308".
+inline constexpr Size kMaxNumberLength = 24;
+
+template<cNumberType T>
+struct ParsedNumber
+{
+    T value;
+    Size length; ///< 消耗的字节数
+};
+
+namespace detail {
+
+SLIB_NODISCARD Result<ParsedNumber<u64>> ParseUnsigned(StringView text, u64 max);
+SLIB_NODISCARD Result<ParsedNumber<i64>> ParseSigned(StringView text, i64 min, i64 max);
+SLIB_NODISCARD Result<ParsedNumber<f32>> ParseF32(StringView text);
+SLIB_NODISCARD Result<ParsedNumber<f64>> ParseF64(StringView text);
+
+char* FormatU32(char* out, u32 value);
+char* FormatU64(char* out, u64 value);
+char* FormatF32(char* out, f32 value);
+char* FormatF64(char* out, f64 value);
+
+} // namespace detail
+
+// ==================
+// 解析
+// ==================
+
+/**
+ * 从 text 开头解析一个十进制数，语法与 std::from_chars 相同: 可选的 '-' (无符号类型不接受)，不接受 '+' 与前导空白;
+ * 浮点数还接受小数点、指数与 inf/infinity/nan (不区分大小写)，按最近偶数舍入.
+ *
+ * 整数每次检查并转换 8 个数字 (SWAR). 浮点数不超过 19 位有效数字时先试 Clinger 快速路径，再用 Eisel-Lemire 算法
+ * 由 128 位的 5 的幂一次乘法得到正确舍入的结果; 更多有效数字或无法判定舍入的少数情况交给 std::from_chars.
+ *
+ * 开头不是数字时返回 ParseError，超出 T 的范围时返回 OutOfRange.
+ */
+template<cNumberType T>
+SLIB_NODISCARD Result<ParsedNumber<T>> ParseNumberPrefix(StringView text)
+{
+    if constexpr (cF32Type<T>) {
+        return detail::ParseF32(text);
+    }
+    else if constexpr (cF64Type<T>) {
+        return detail::ParseF64(text);
+    }
+    else if constexpr (cSignedType<T>) {
+        const auto parsed = detail::ParseSigned(text, numeric_limits<T>::min(), numeric_limits<T>::max());
+        if (!parsed)
+            return std::unexpected(parsed.error());
+        return ParsedNumber<T>{static_cast<T>(parsed->value), parsed->length};
+    }
+    else {
+        const auto parsed = detail::ParseUnsigned(text, numeric_limits<T>::max());
+        if (!parsed)
+            return std::unexpected(parsed.error());
+        return ParsedNumber<T>{static_cast<T>(parsed->value), parsed->length};
+    }
+}
+
+/**
+ * @brief 解析整个 text，其后有多余字节时返回 ParseError.
+ */
+template<cNumberType T>
+SLIB_NODISCARD Result<T> ParseNumber(StringView text)
+{
+    auto parsed = ParseNumberPrefix<T>(text);
+    if (!parsed)
+        return std::unexpected(std::move(parsed.error()));
+    if (parsed->length != text.size())
+        return Unexpected(FailureType::ParseError);
+    return parsed->value;
+}
+
+// ==================
+// 格式化
+// ==================
+
+/**
+ * 把 value 写到 out，返回写出内容的末尾. out 至少要有 kMaxNumberLength 字节，不写结尾的 '\0'.
+ *
+ * 整数每次由定点乘法产生两位数字，不做除法. 浮点数输出能精确读回原值的最短十进制表示 (Schubfach 算法)，
+ * 定点与科学计数两种写法中取较短者，等长时取定点，与 std::to_chars(first, last, value) 的输出相同.
+ */
+template<cNumberType T>
+char* FormatNumber(char* out, T value)
+{
+    if constexpr (cF32Type<T>) {
+        return detail::FormatF32(out, value);
+    }
+    else if constexpr (cF64Type<T>) {
+        return detail::FormatF64(out, value);
+    }
+    else {
+        using Unsigned = std::make_unsigned_t<T>;
+        auto magnitude = static_cast<Unsigned>(value);
+        if constexpr (cSignedType<T>) {
+            if (value < 0) {
+                *out++    = '-';
+                magnitude = static_cast<Unsigned>(Unsigned(0) - magnitude);
+            }
+        }
+        if constexpr (sizeof(T) <= sizeof(u32))
+            return detail::FormatU32(out, magnitude);
+        else
+            return detail::FormatU64(out, magnitude);
+    }
+}
+
+/**
+ * @brief 格式化到 String.
+ */
+template<cNumberType T>
+SLIB_NODISCARD String NumberToString(T value)
+{
+    char buffer[kMaxNumberLength];
+    return String(buffer, static_cast<Size>(FormatNumber(buffer, value) - buffer));
+}
+
+} // namespace slib
@@ -0,0 +1,161 @@
+﻿/**
+ * @File StringBuilder.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <iterator>
+
+#include <SLib/Math/Numeric.hpp>
+#include <SLib/String/StringType.hpp>
+
+namespace slib {
+
+/**
+ * 拼接与格式化字符串的缓冲. 内容先写入对象内的 InlineCapacity 字节，超出后转入一个 String 的堆存储并按倍数增长;
+ * release() 直接移出该 String，不再复制. format() 经由 std::vformat_to 写入缓冲，不产生中间的 std::string.
+ *
+ * 缓冲不以 '\0' 结尾，应通过 view() 或 data()/size() 使用其内容.
+ */
+template<Size InlineCapacity = 256>
+class BasicStringBuilder
+{
+public:
+    /**
+     * 向缓冲追加字符的输出迭代器，可直接用于 std::format_to.
+     */
+    class Appender
+    {
+    public:
+        using difference_type = std::ptrdiff_t;
+
+        Appender() = default;
+
+        explicit Appender(BasicStringBuilder& builder) : _builder(&builder) { }
+
+        SLIB_FORCE_INLINE Appender& operator=(char c)
+        {
+            _builder->append(c);
+            return *this;
+        }
+
+        Appender& operator*() { return *this; }
+
+        Appender& operator++() { return *this; }
+
+        Appender operator++(int) { return *this; }
+
+    private:
+        BasicStringBuilder* _builder = nullptr;
+    };
+
+    BasicStringBuilder() = default;
+
+    BasicStringBuilder(const BasicStringBuilder&)            = delete;
+    BasicStringBuilder& operator=(const BasicStringBuilder&) = delete;
+
+    SLIB_NODISCARD const char* data() const { return _data; }
+
+    SLIB_NODISCARD Size size() const { return _size; }
+
+    SLIB_NODISCARD Size capacity() const { return _capacity; }
+
+    SLIB_NODISCARD bool empty() const { return _size == 0; }
+
+    SLIB_NODISCARD StringView view() const { return StringView(_data, _size); }
+
+    SLIB_NODISCARD Appender appender() { return Appender(*this); }
+
+    void clear() { _size = 0; }
+
+    void reserve(Size capacity)
+    {
+        if (capacity > _capacity)
+            grow(capacity);
+    }
+
+    SLIB_FORCE_INLINE BasicStringBuilder& append(char c)
+    {
+        if (SLIB_UNLIKELY(_size == _capacity))
+            grow(_size + 1);
+        _data[_size++] = c;
+        return *this;
+    }
+
+    BasicStringBuilder& append(Size count, char c)
+    {
+        reserve(_size + count);
+        std::memset(_data + _size, c, count);
+        _size += count;
+        return *this;
+    }
+
+    BasicStringBuilder& append(const char* s, Size n)
+    {
+        reserve(_size + n);
+        std::memcpy(_data + _size, s, n);
+        _size += n;
+        return *this;
+    }
+
+    BasicStringBuilder& append(StringView s) { return append(s.data(), s.size()); }
+
+    template<typename... Args>
+    BasicStringBuilder& format(std::format_string<Args...> fmt, Args&&... args)
+    {
+        return vformat(fmt.get(), std::make_format_args(args...));
+    }
+
+    BasicStringBuilder& vformat(std::string_view fmt, std::format_args args)
+    {
+        std::vformat_to(Appender(*this), fmt, args);
+        return *this;
+    }
+
+    /**
+     * @brief 取出内容并清空缓冲. 已转入堆存储时直接移出，否则复制对象内的字节.
+     */
+    SLIB_NODISCARD String release()
+    {
+        String result;
+        if (_data == _inline) {
+            result = String(view());
+        }
+        else {
+            _heap.resize(_size);
+            result = std::move(_heap);
+            _heap  = String();
+        }
+        _data     = _inline;
+        _size     = 0;
+        _capacity = InlineCapacity;
+        return result;
+    }
+
+private:
+    SLIB_NOINLINE void grow(Size required)
+    {
+        const Size capacity = std::max(required, _capacity * 2);
+        _heap.resize(capacity);
+        if (_data == _inline)
+            std::memcpy(_heap.data(), _inline, _size);
+        _data     = _heap.data();
+        _capacity = capacity;
+    }
+
+    char* _data    = _inline;
+    Size _size     = 0;
+    Size _capacity = InlineCapacity;
+    String _heap;
+    char _inline[InlineCapacity];
+};
+
+using StringBuilder = BasicStringBuilder<>;
+
+} // namespace slib
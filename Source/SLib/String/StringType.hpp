@@ -20,26 +20,23 @@ using StringView = sz::string_view;
 
 } // namespace slib
 
+// 按 (data, size) 转为 std::string_view 输出，视图不保证以 '\0' 结尾; 同时支持宽度、对齐等格式说明
 template<>
-struct std::formatter<slib::String>
+struct std::formatter<slib::String> : std::formatter<std::string_view>
 {
-    constexpr auto parse(const format_parse_context& ctx) { return ctx.begin(); }
-
     template<typename Context>
-    constexpr auto format(const slib::String& bs, Context& ctx) const
+    auto format(const slib::String& bs, Context& ctx) const
     {
-        return format_to(ctx.out(), "{}", bs.data());
+        return std::formatter<std::string_view>::format(std::string_view(bs.data(), bs.size()), ctx);
     }
 };
 
 template<>
-struct std::formatter<slib::StringView>
+struct std::formatter<slib::StringView> : std::formatter<std::string_view>
 {
-    constexpr auto parse(const format_parse_context& ctx) { return ctx.begin(); }
-
     template<typename Context>
-    constexpr auto format(const slib::StringView& bsv, Context& ctx) const
+    auto format(const slib::StringView& bsv, Context& ctx) const
     {
-        return format_to(ctx.out(), "{}", bsv.data());
+        return std::formatter<std::string_view>::format(std::string_view(bsv.data(), bsv.size()), ctx);
     }
-};
\ No newline at end of file
+};
@@ -0,0 +1,544 @@
+﻿/**
+ * @File Text.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Text.hpp"
+
+#include <bit>
+
+#include <SLib/Error.hpp>
+
+using namespace slib;
+
+namespace {
+
+// ==================
+// 16 字节向量的最小封装. 比较结果为每字节 0x00/0xFF，ToMask 压缩为整数，每个字节占 kMaskStep 位.
+// ==================
+
+#if SLIB_HAS_SSSE3
+#  define SLIB_TEXT_SIMD 1
+
+using Vec                   = __m128i;
+constexpr u32 kMaskStep     = 1;
+constexpr u64 kMaskByteBits = 0x1;
+
+SLIB_FORCE_INLINE Vec Load(const void* p)
+{
+    return _mm_loadu_si128(static_cast<const __m128i*>(p));
+}
+
+SLIB_FORCE_INLINE void Store(void* p, Vec v)
+{
+    _mm_storeu_si128(static_cast<__m128i*>(p), v);
+}
+
+SLIB_FORCE_INLINE Vec Splat(u8 b)
+{
+    return _mm_set1_epi8(static_cast<char>(b));
+}
+
+SLIB_FORCE_INLINE Vec Lookup(Vec table, Vec index)
+{
+    return _mm_shuffle_epi8(table, index);
+}
+
+SLIB_FORCE_INLINE Vec LowNibbles(Vec v)
+{
+    return _mm_and_si128(v, Splat(0x0F));
+}
+
+SLIB_FORCE_INLINE Vec HighNibbles(Vec v)
+{
+    return _mm_and_si128(_mm_srli_epi16(v, 4), Splat(0x0F));
+}
+
+SLIB_FORCE_INLINE Vec And(Vec a, Vec b)
+{
+    return _mm_and_si128(a, b);
+}
+
+SLIB_FORCE_INLINE Vec Or(Vec a, Vec b)
+{
+    return _mm_or_si128(a, b);
+}
+
+SLIB_FORCE_INLINE Vec Xor(Vec a, Vec b)
+{
+    return _mm_xor_si128(a, b);
+}
+
+/// 最高位为 1 的字节选 b，否则选 a.
+SLIB_FORCE_INLINE Vec SelectBySign(Vec sign, Vec a, Vec b)
+{
+    const Vec high = _mm_cmplt_epi8(sign, _mm_setzero_si128());
+    return _mm_or_si128(_mm_and_si128(high, b), _mm_andnot_si128(high, a));
+}
+
+SLIB_FORCE_INLINE Vec IsZero(Vec v)
+{
+    return _mm_cmpeq_epi8(v, _mm_setzero_si128());
+}
+
+SLIB_FORCE_INLINE Vec Equal(Vec a, Vec b)
+{
+    return _mm_cmpeq_epi8(a, b);
+}
+
+/// 无符号比较 lo <= v <= hi (逐字节).
+SLIB_FORCE_INLINE Vec InRange(Vec v, u8 lo, u8 hi)
+{
+    const Vec shifted = _mm_sub_epi8(v, Splat(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(shifted, Splat(static_cast<u8>(hi - lo))), shifted);
+}
+
+SLIB_FORCE_INLINE u64 ToMask(Vec v)
+{
+    return static_cast<u32>(_mm_movemask_epi8(v));
+}
+
+#elif SLIB_HAS_NEON
+#  define SLIB_TEXT_SIMD 1
+
+using Vec                   = uint8x16_t;
+constexpr u32 kMaskStep     = 4;
+constexpr u64 kMaskByteBits = 0xF;
+
+SLIB_FORCE_INLINE Vec Load(const void* p)
+{
+    return vld1q_u8(static_cast<const u8*>(p));
+}
+
+SLIB_FORCE_INLINE void Store(void* p, Vec v)
+{
+    vst1q_u8(static_cast<u8*>(p), v);
+}
+
+SLIB_FORCE_INLINE Vec Splat(u8 b)
+{
+    return vdupq_n_u8(b);
+}
+
+SLIB_FORCE_INLINE Vec Lookup(Vec table, Vec index)
+{
+    return vqtbl1q_u8(table, index);
+}
+
+SLIB_FORCE_INLINE Vec LowNibbles(Vec v)
+{
+    return vandq_u8(v, Splat(0x0F));
+}
+
+SLIB_FORCE_INLINE Vec HighNibbles(Vec v)
+{
+    return vshrq_n_u8(v, 4);
+}
+
+SLIB_FORCE_INLINE Vec And(Vec a, Vec b)
+{
+    return vandq_u8(a, b);
+}
+
+SLIB_FORCE_INLINE Vec Or(Vec a, Vec b)
+{
+    return vorrq_u8(a, b);
+}
+
+SLIB_FORCE_INLINE Vec Xor(Vec a, Vec b)
+{
+    return veorq_u8(a, b);
+}
+
+SLIB_FORCE_INLINE Vec SelectBySign(Vec sign, Vec a, Vec b)
+{
+    return vbslq_u8(vcltzq_s8(vreinterpretq_s8_u8(sign)), b, a);
+}
+
+SLIB_FORCE_INLINE Vec IsZero(Vec v)
+{
+    return vceqzq_u8(v);
+}
+
+SLIB_FORCE_INLINE Vec Equal(Vec a, Vec b)
+{
+    return vceqq_u8(a, b);
+}
+
+SLIB_FORCE_INLINE Vec InRange(Vec v, u8 lo, u8 hi)
+{
+    return vcleq_u8(vsubq_u8(v, Splat(lo)), Splat(static_cast<u8>(hi - lo)));
+}
+
+/// NEON 没有 movemask，用窄化移位把每字节压缩为 4 位.
+SLIB_FORCE_INLINE u64 ToMask(Vec v)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+}
+
+#else
+#  define SLIB_TEXT_SIMD 0
+#endif
+
+#if SLIB_TEXT_SIMD
+
+SLIB_FORCE_INLINE Size FirstByte(u64 mask)
+{
+    return static_cast<Size>(std::countr_zero(mask)) / kMaskStep;
+}
+
+/**
+ * @brief 16 个字节中属于集合的字节，见 CharSet 的说明.
+ */
+struct SetClassifier
+{
+    explicit SetClassifier(const CharSet& set)
+        : low(Load(set.nibbles(0))), high(Load(set.nibbles(1))),
+          bits(Load("\x01\x02\x04\x08\x10\x20\x40\x80\x01\x02\x04\x08\x10\x20\x40\x80"))
+    {
+    }
+
+    SLIB_FORCE_INLINE Vec members(Vec v) const
+    {
+        const Vec lo    = LowNibbles(v);
+        const Vec table = SelectBySign(v, Lookup(low, lo), Lookup(high, lo));
+        return Xor(IsZero(And(table, Lookup(bits, HighNibbles(v)))), Splat(0xFF));
+    }
+
+    Vec low;
+    Vec high;
+    Vec bits;
+};
+
+/// 把 'A'..'Z' 转为小写.
+SLIB_FORCE_INLINE Vec Lower(Vec v)
+{
+    return Or(v, And(InRange(v, 'A', 'Z'), Splat(0x20)));
+}
+
+SLIB_FORCE_INLINE Vec Upper(Vec v)
+{
+    return Xor(v, And(InRange(v, 'a', 'z'), Splat(0x20)));
+}
+
+#endif
+
+template<bool Member>
+Size FindFirst(StringView text, const CharSet& set)
+{
+    const char* p = text.data();
+    const Size n  = text.size();
+    Size i        = 0;
+
+#if SLIB_TEXT_SIMD
+    const SetClassifier classifier(set);
+    for (; i + 16 <= n; i += 16) {
+        Vec m = classifier.members(Load(p + i));
+        if constexpr (!Member)
+            m = Xor(m, Splat(0xFF));
+        if (const u64 mask = ToMask(m))
+            return i + FirstByte(mask);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (set.contains(p[i]) == Member)
+            return i;
+    }
+    return kNoPosition;
+}
+
+} // namespace
+
+u64 slib::detail::ClassifyBlock(const char* p, Size n, const CharSet& set)
+{
+    n        = std::min<Size>(n, 64);
+    u64 mask = 0;
+    Size i   = 0;
+
+#if SLIB_TEXT_SIMD
+    const SetClassifier classifier(set);
+    for (; i + 16 <= n; i += 16) {
+        u64 bits = ToMask(classifier.members(Load(p + i)));
+        if constexpr (kMaskStep != 1) {
+            // 每字节 4 位压缩为 1 位
+            bits &= 0x1111111111111111ULL;
+            bits  = (bits | (bits >> 3)) & 0x0303030303030303ULL;
+            bits  = (bits | (bits >> 6)) & 0x000F000F000F000FULL;
+            bits  = (bits | (bits >> 12)) & 0x000000FF000000FFULL;
+            bits  = (bits | (bits >> 24)) & 0xFFFFULL;
+        }
+        mask |= bits << i;
+    }
+#endif
+
+    for (; i < n; ++i)
+        mask |= static_cast<u64>(set.contains(p[i])) << i;
+    return mask;
+}
+
+Size slib::FindFirstOf(StringView text, const CharSet& set)
+{
+    return FindFirst<true>(text, set);
+}
+
+Size slib::FindFirstNotOf(StringView text, const CharSet& set)
+{
+    return FindFirst<false>(text, set);
+}
+
+Size slib::FindLastNotOf(StringView text, const CharSet& set)
+{
+    const char* p = text.data();
+    Size i        = text.size();
+
+#if SLIB_TEXT_SIMD
+    const SetClassifier classifier(set);
+    for (; i >= 16; i -= 16) {
+        const u64 mask = ToMask(Xor(classifier.members(Load(p + i - 16)), Splat(0xFF)));
+        if (mask)
+            return i - 16 + (63 - static_cast<Size>(std::countl_zero(mask))) / kMaskStep;
+    }
+#endif
+
+    while (i-- > 0) {
+        if (!set.contains(p[i]))
+            return i;
+    }
+    return kNoPosition;
+}
+
+Size slib::CountOf(StringView text, const CharSet& set)
+{
+    const char* p = text.data();
+    const Size n  = text.size();
+    Size i        = 0;
+    Size count    = 0;
+
+#if SLIB_TEXT_SIMD
+    const SetClassifier classifier(set);
+    for (; i + 16 <= n; i += 16)
+        count += static_cast<Size>(std::popcount(ToMask(classifier.members(Load(p + i))))) / std::popcount(kMaskByteBits);
+#endif
+
+    for (; i < n; ++i)
+        count += set.contains(p[i]);
+    return count;
+}
+
+bool slib::IsAscii(StringView text)
+{
+    const char* p = text.data();
+    const Size n  = text.size();
+    Size i        = 0;
+
+    // 以 8 字节为单位合并最高位，最后统一判断
+    u64 high = 0;
+    for (; i + 8 <= n; i += 8) {
+        u64 word;
+        std::memcpy(&word, p + i, sizeof(word));
+        high |= word;
+    }
+    for (; i < n; ++i)
+        high |= static_cast<u8>(p[i]);
+    return (high & 0x8080808080808080ULL) == 0;
+}
+
+StringView slib::TrimLeft(StringView text, const CharSet& set)
+{
+    const Size begin = FindFirstNotOf(text, set);
+    return begin == kNoPosition ? StringView(text.data() + text.size(), 0) : StringView(text.data() + begin, text.size() - begin);
+}
+
+StringView slib::TrimRight(StringView text, const CharSet& set)
+{
+    const Size last = FindLastNotOf(text, set);
+    return StringView(text.data(), last == kNoPosition ? 0 : last + 1);
+}
+
+StringView slib::Trim(StringView text, const CharSet& set)
+{
+    return TrimRight(TrimLeft(text, set), set);
+}
+
+bool slib::EqualsIgnoreAsciiCase(StringView a, StringView b)
+{
+    if (a.size() != b.size())
+        return false;
+
+    const char* pa = a.data();
+    const char* pb = b.data();
+    const Size n   = a.size();
+    Size i         = 0;
+
+#if SLIB_TEXT_SIMD
+    for (; i + 16 <= n; i += 16) {
+        if (ToMask(Equal(Lower(Load(pa + i)), Lower(Load(pb + i)))) != (kMaskStep == 1 ? 0xFFFFu : ~u64(0)))
+            return false;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (ToAsciiLower(pa[i]) != ToAsciiLower(pb[i]))
+            return false;
+    }
+    return true;
+}
+
+bool slib::StartsWithIgnoreAsciiCase(StringView text, StringView prefix)
+{
+    return text.size() >= prefix.size() && EqualsIgnoreAsciiCase(StringView(text.data(), prefix.size()), prefix);
+}
+
+void slib::ToAsciiLower(StringView src, char* dst)
+{
+    const char* p = src.data();
+    const Size n  = src.size();
+    Size i        = 0;
+
+#if SLIB_TEXT_SIMD
+    for (; i + 16 <= n; i += 16)
+        Store(dst + i, Lower(Load(p + i)));
+#endif
+
+    for (; i < n; ++i)
+        dst[i] = ToAsciiLower(p[i]);
+}
+
+void slib::ToAsciiUpper(StringView src, char* dst)
+{
+    const char* p = src.data();
+    const Size n  = src.size();
+    Size i        = 0;
+
+#if SLIB_TEXT_SIMD
+    for (; i + 16 <= n; i += 16)
+        Store(dst + i, Upper(Load(p + i)));
+#endif
+
+    for (; i < n; ++i)
+        dst[i] = ToAsciiUpper(p[i]);
+}
+
+// ==================
+// MultiFinder
+// ==================
+
+MultiFinder::MultiFinder(std::span<const StringView> patterns)
+{
+    SLIB_CHECK(!patterns.empty(), "MultiFinder needs at least one pattern");
+    SLIB_CHECK(patterns.size() < std::numeric_limits<u32>::max(), "Too many patterns");
+
+    _offsets.reserve(patterns.size() + 1);
+    _offsets.push_back(0);
+    for (Size index = 0; index < patterns.size(); ++index) {
+        const StringView pattern = patterns[index];
+        SLIB_CHECK(!pattern.empty(), "MultiFinder patterns must not be empty");
+
+        _storage.insert(_storage.end(), pattern.data(), pattern.data() + pattern.size());
+        _offsets.push_back(_storage.size());
+
+        const Size bucket = index % kBuckets;
+        const auto bit    = static_cast<u8>(1u << bucket);
+        _buckets[bucket].push_back(static_cast<u32>(index));
+
+        for (Size k = 0; k < 2; ++k) {
+            if (k < pattern.size()) {
+                const auto b          = static_cast<u8>(pattern[k]);
+                _masks[k][0][b & 15] |= bit;
+                _masks[k][1][b >> 4] |= bit;
+            }
+            else {
+                // 单字节的模式串对第二个字节没有要求
+                for (auto& entry : _masks[k][0])
+                    entry |= bit;
+                for (auto& entry : _masks[k][1])
+                    entry |= bit;
+            }
+        }
+    }
+}
+
+bool MultiFinder::verify(StringView text, Size position, u32 buckets, Match& match) const
+{
+    const char* p   = text.data() + position;
+    const Size rest = text.size() - position;
+
+    u32 best = ~u32(0);
+    for (; buckets; buckets &= buckets - 1) {
+        for (const u32 index : _buckets[std::countr_zero(buckets)]) {
+            if (index >= best)
+                break;
+            const StringView candidate = pattern(index);
+            if (candidate.size() <= rest && std::memcmp(p, candidate.data(), candidate.size()) == 0) {
+                best = index;
+                break;
+            }
+        }
+    }
+    if (best == ~u32(0))
+        return false;
+
+    match = {position, best, pattern(best).size()};
+    return true;
+}
+
+Opt<MultiFinder::Match> MultiFinder::find(StringView text, Size from) const
+{
+    const auto* p = reinterpret_cast<const u8*>(text.data());
+    const Size n  = text.size();
+    Size i        = from;
+    Match match{};
+
+#if SLIB_TEXT_SIMD
+    const Vec lo0 = Load(_masks[0][0]);
+    const Vec hi0 = Load(_masks[0][1]);
+    const Vec lo1 = Load(_masks[1][0]);
+    const Vec hi1 = Load(_masks[1][1]);
+
+    // 第二个字节的读取需要多 1 个字节
+    for (; i + 17 <= n; i += 16) {
+        const Vec v0 = Load(p + i);
+        const Vec v1 = Load(p + i + 1);
+        const Vec m0 = And(Lookup(lo0, LowNibbles(v0)), Lookup(hi0, HighNibbles(v0)));
+        const Vec m1 = And(Lookup(lo1, LowNibbles(v1)), Lookup(hi1, HighNibbles(v1)));
+        const Vec m  = And(m0, m1);
+
+        u64 mask = ToMask(Xor(IsZero(m), Splat(0xFF)));
+        if (SLIB_LIKELY(mask == 0))
+            continue;
+
+        alignas(16) u8 buckets[16];
+        Store(buckets, m);
+        for (; mask; mask &= ~(kMaskByteBits << (std::countr_zero(mask) / kMaskStep * kMaskStep))) {
+            const Size offset = FirstByte(mask);
+            if (verify(text, i + offset, buckets[offset], match))
+                return match;
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const u8 b0 = p[i];
+        u32 buckets = _masks[0][0][b0 & 15] & _masks[0][1][b0 >> 4];
+        if (i + 1 < n) {
+            const u8 b1 = p[i + 1];
+            buckets    &= _masks[1][0][b1 & 15] & _masks[1][1][b1 >> 4];
+        }
+        if (buckets && verify(text, i, buckets, match))
+            return match;
+    }
+    return std::nullopt;
+}
+
+Size MultiFinder::count(StringView text) const
+{
+    Size count = 0;
+    for (Size from = 0; auto match = find(text, from);) {
+        ++count;
+        from = match->position + match->length;
+    }
+    return count;
+}
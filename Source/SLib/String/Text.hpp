@@ -0,0 +1,451 @@
+﻿/**
+ * @File Text.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <vector>
+
+#include <SLib/Math/Math.hpp>
+#include <SLib/String/StringType.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+namespace slib {
+
+inline constexpr Size kNoPosition = ~Size(0);
+
+// ==================
+// ASCII 字符分类
+// ==================
+
+SLIB_FUNC constexpr bool IsAsciiSpace(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+SLIB_FUNC constexpr bool IsAsciiDigit(char c)
+{
+    return static_cast<u8>(c - '0') < 10;
+}
+
+SLIB_FUNC constexpr bool IsAsciiUpper(char c)
+{
+    return static_cast<u8>(c - 'A') < 26;
+}
+
+SLIB_FUNC constexpr bool IsAsciiLower(char c)
+{
+    return static_cast<u8>(c - 'a') < 26;
+}
+
+SLIB_FUNC constexpr bool IsAsciiAlpha(char c)
+{
+    return IsAsciiLower(static_cast<char>(c | 0x20));
+}
+
+SLIB_FUNC constexpr bool IsAsciiAlnum(char c)
+{
+    return IsAsciiAlpha(c) || IsAsciiDigit(c);
+}
+
+SLIB_FUNC constexpr char ToAsciiLower(char c)
+{
+    return IsAsciiUpper(c) ? static_cast<char>(c | 0x20) : c;
+}
+
+SLIB_FUNC constexpr char ToAsciiUpper(char c)
+{
+    return IsAsciiLower(c) ? static_cast<char>(c & ~0x20) : c;
+}
+
+/**
+ * 任意字节的集合. 除 256 位的位图外还保存按低 4 位索引的两张查找表，使 SIMD 实现可以用两次字节重排一次分类 16 个字节:
+ * 字节 b 属于集合当且仅当 nibbles[b >> 7][b & 15] 的第 (b >> 4) & 7 位为 1.
+ */
+class CharSet
+{
+public:
+    constexpr CharSet() = default;
+
+    constexpr explicit CharSet(StringView chars)
+    {
+        for (const char c : chars)
+            add(c);
+    }
+
+    constexpr explicit CharSet(const char* chars)
+    {
+        for (; *chars; ++chars)
+            add(*chars);
+    }
+
+    constexpr CharSet& add(char c)
+    {
+        const auto b = static_cast<u8>(c);
+        _bits[b >> 6]            |= u64(1) << (b & 63);
+        _nibbles[b >> 7][b & 15] |= static_cast<u8>(1u << ((b >> 4) & 7));
+        return *this;
+    }
+
+    SLIB_NODISCARD constexpr bool contains(char c) const
+    {
+        const auto b = static_cast<u8>(c);
+        return (_bits[b >> 6] >> (b & 63)) & 1;
+    }
+
+    SLIB_NODISCARD constexpr const u8* nibbles(Size half) const { return _nibbles[half]; }
+
+    /// 空格、\t、\n、\v、\f、\r.
+    SLIB_NODISCARD static constexpr CharSet Whitespace() { return CharSet(" \t\n\v\f\r"); }
+
+private:
+    u64 _bits[4]        = {};
+    u8 _nibbles[2][16] = {};
+};
+
+// ==================
+// 整段缓冲的扫描
+// ==================
+
+/**
+ * @brief 第一个属于 set 的字节的位置，没有时返回 kNoPosition.
+ */
+SLIB_NODISCARD Size FindFirstOf(StringView text, const CharSet& set);
+
+/**
+ * @brief 第一个不属于 set 的字节的位置，没有时返回 kNoPosition.
+ */
+SLIB_NODISCARD Size FindFirstNotOf(StringView text, const CharSet& set);
+
+/**
+ * @brief 最后一个不属于 set 的字节的位置，没有时返回 kNoPosition.
+ */
+SLIB_NODISCARD Size FindLastNotOf(StringView text, const CharSet& set);
+
+/**
+ * @brief 属于 set 的字节数.
+ */
+SLIB_NODISCARD Size CountOf(StringView text, const CharSet& set);
+
+SLIB_NODISCARD bool IsAscii(StringView text);
+
+SLIB_NODISCARD StringView TrimLeft(StringView text, const CharSet& set = CharSet::Whitespace());
+
+SLIB_NODISCARD StringView TrimRight(StringView text, const CharSet& set = CharSet::Whitespace());
+
+SLIB_NODISCARD StringView Trim(StringView text, const CharSet& set = CharSet::Whitespace());
+
+/**
+ * @brief 忽略 ASCII 大小写比较，非 ASCII 字节按原值比较.
+ */
+SLIB_NODISCARD bool EqualsIgnoreAsciiCase(StringView a, StringView b);
+
+SLIB_NODISCARD bool StartsWithIgnoreAsciiCase(StringView text, StringView prefix);
+
+/**
+ * @brief 把 src 转为小写/大写写入 dst，dst 至少有 src.size() 字节，可以与 src 相同.
+ */
+void ToAsciiLower(StringView src, char* dst);
+
+void ToAsciiUpper(StringView src, char* dst);
+
+// ==================
+// 切分
+// ==================
+
+namespace detail {
+
+struct DelimiterMatch
+{
+    Size position;
+    Size length;
+};
+
+SLIB_FORCE_INLINE DelimiterMatch FindDelimiter(StringView text, char delimiter)
+{
+    const void* p = text.empty() ? nullptr : std::memchr(text.data(), delimiter, text.size());
+    return {p ? static_cast<Size>(static_cast<const char*>(p) - text.data()) : kNoPosition, 1};
+}
+
+SLIB_FORCE_INLINE DelimiterMatch FindDelimiter(StringView text, StringView delimiter)
+{
+    const auto pos = std::string_view(text.data(), text.size()).find(std::string_view(delimiter.data(), delimiter.size()));
+    return {pos == std::string_view::npos ? kNoPosition : pos, delimiter.size()};
+}
+
+SLIB_FORCE_INLINE DelimiterMatch FindDelimiter(StringView text, const CharSet& delimiters)
+{
+    return {FindFirstOf(text, delimiters), 1};
+}
+
+} // namespace detail
+
+/**
+ * 按分隔符惰性切分，逐个产生指向原文的视图，不复制也不分配. 相邻的分隔符之间产生空字段，n 个分隔符产生 n + 1 个字段.
+ * 分隔符可以是单个字符、字符串或 CharSet. 空文本产生一个空字段.
+ */
+template<typename Delimiter>
+class SplitRange
+{
+public:
+    class Iterator
+    {
+    public:
+        using value_type        = StringView;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        Iterator() = default;
+
+        Iterator(StringView rest, const Delimiter* delimiter) : _rest(rest), _delimiter(delimiter) { next(); }
+
+        StringView operator*() const { return _current; }
+
+        Iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            next();
+            return copy;
+        }
+
+        friend bool operator==(const Iterator& it, std::default_sentinel_t) { return it._done; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a._done == b._done && a._current.data() == b._current.data(); }
+
+    private:
+        void next()
+        {
+            if (_last) {
+                _done = true;
+                return;
+            }
+            const auto match = detail::FindDelimiter(_rest, *_delimiter);
+            if (match.position == kNoPosition) {
+                _current = _rest;
+                _last    = true;
+                return;
+            }
+            _current = StringView(_rest.data(), match.position);
+            _rest    = StringView(_rest.data() + match.position + match.length, _rest.size() - match.position - match.length);
+        }
+
+        StringView _rest;
+        StringView _current;
+        const Delimiter* _delimiter = nullptr;
+        bool _last                  = false;
+        bool _done                  = false;
+    };
+
+    SplitRange(StringView text, Delimiter delimiter) : _text(text), _delimiter(delimiter) { }
+
+    Iterator begin() const { return Iterator(_text, &_delimiter); }
+
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    StringView _text;
+    Delimiter _delimiter;
+};
+
+SLIB_NODISCARD inline SplitRange<char> Split(StringView text, char delimiter)
+{
+    return {text, delimiter};
+}
+
+SLIB_NODISCARD inline SplitRange<StringView> Split(StringView text, StringView delimiter)
+{
+    return {text, delimiter};
+}
+
+SLIB_NODISCARD inline SplitRange<CharSet> Split(StringView text, const CharSet& delimiters)
+{
+    return {text, delimiters};
+}
+
+namespace detail {
+
+/**
+ * @brief 从 p 开始至多 64 个字节中属于 set 的字节，第 i 位对应 p[i]; 超出 n 的位为 0.
+ */
+SLIB_NODISCARD u64 ClassifyBlock(const char* p, Size n, const CharSet& set);
+
+} // namespace detail
+
+/**
+ * 惰性的分词: 跳过连续的分隔字节，只产生非空的词. 每 64 字节分类一次，由分隔符位掩码直接得到块内所有词的起点与终点，
+ * 之后每个词只需两次取最低位，适合大量短词的文本.
+ */
+class TokenRange
+{
+public:
+    class Iterator
+    {
+    public:
+        using value_type        = StringView;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        Iterator() = default;
+
+        Iterator(StringView text, const CharSet* delimiters) : _text(text), _delimiters(delimiters) { next(); }
+
+        StringView operator*() const { return _current; }
+
+        Iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            next();
+            return copy;
+        }
+
+        friend bool operator==(const Iterator& it, std::default_sentinel_t) { return it._done; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a._done == b._done && a._current.data() == b._current.data(); }
+
+    private:
+        /**
+         * @brief 分类下一个 64 字节块. 起点是前一字节为分隔符的非分隔字节，终点是前一字节不是分隔符的分隔字节;
+         *        文本开头之前与末尾之后都视为分隔符.
+         */
+        bool loadBlock()
+        {
+            if (_next >= _text.size())
+                return false;
+
+            const Size valid = _text.size() - _next;
+            u64 delimiters   = detail::ClassifyBlock(_text.data() + _next, valid, *_delimiters);
+            delimiters      |= valid >= 64 ? 0 : ~u64(0) << valid;
+
+            const u64 previous = (delimiters << 1) | _carry;
+            _starts            = ~delimiters & previous;
+            _ends              = delimiters & ~previous;
+            _carry             = delimiters >> 63;
+            _block             = _next;
+            _next             += 64;
+            return true;
+        }
+
+        void next()
+        {
+            while (_starts == 0) {
+                if (!loadBlock()) {
+                    _done = true;
+                    return;
+                }
+            }
+            const Size begin  = _block + static_cast<Size>(std::countr_zero(_starts));
+            _starts          &= _starts - 1;
+
+            // 起点与终点交替出现，下一个终点即为本词的结尾
+            Size end = _text.size();
+            while (_ends == 0 && loadBlock()) { }
+            if (_ends) {
+                end    = _block + static_cast<Size>(std::countr_zero(_ends));
+                _ends &= _ends - 1;
+            }
+            _current = StringView(_text.data() + begin, end - begin);
+        }
+
+        StringView _text;
+        StringView _current;
+        const CharSet* _delimiters = nullptr;
+        Size _block                = 0;
+        Size _next                 = 0;
+        u64 _starts                = 0;
+        u64 _ends                  = 0;
+        u64 _carry                 = 1;
+        bool _done                 = false;
+    };
+
+    TokenRange(StringView text, const CharSet& delimiters) : _text(text), _delimiters(delimiters) { }
+
+    Iterator begin() const { return Iterator(_text, &_delimiters); }
+
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    StringView _text;
+    CharSet _delimiters;
+};
+
+SLIB_NODISCARD inline TokenRange Tokenize(StringView text, const CharSet& delimiters = CharSet::Whitespace())
+{
+    return {text, delimiters};
+}
+
+// ==================
+// 多模式查找
+// ==================
+
+/**
+ * 同时查找多个模式串 (Teddy 式的 SIMD 预筛选). 模式串按编号分入 8 个桶，对前两个字节各建一组按高低 4 位索引的桶掩码;
+ * 扫描时每次对 16 个位置各做四次字节重排，得到可能在该位置开始匹配的桶，只对这些位置逐个比较桶内的模式串.
+ * 模式串较少且首字节分散时，大多数 16 字节块没有候选，吞吐接近内存带宽.
+ */
+class MultiFinder
+{
+public:
+    struct Match
+    {
+        Size position; ///< 匹配在文本中的起点
+        u32 pattern;   ///< 模式串编号 (构造时的顺序)
+        Size length;   ///< 模式串长度
+    };
+
+    /**
+     * @brief 模式串被复制保存，不能为空串.
+     */
+    explicit MultiFinder(std::span<const StringView> patterns);
+
+    /**
+     * @brief 从 from 开始最左的匹配; 同一位置有多个模式串匹配时取编号最小的.
+     */
+    SLIB_NODISCARD Opt<Match> find(StringView text, Size from = 0) const;
+
+    /**
+     * @brief 从左到右、互不重叠的匹配数.
+     */
+    SLIB_NODISCARD Size count(StringView text) const;
+
+    SLIB_NODISCARD Size patternCount() const { return _offsets.size() - 1; }
+
+    SLIB_NODISCARD StringView pattern(Size index) const
+    {
+        return StringView(_storage.data() + _offsets[index], _offsets[index + 1] - _offsets[index]);
+    }
+
+    // ==================
+
+    static constexpr Size kBuckets = 8;
+
+private:
+    SLIB_NODISCARD bool verify(StringView text, Size position, u32 buckets, Match& match) const;
+
+    // [位置 (0/1)][低 4 位 / 高 4 位][16]
+    alignas(16) u8 _masks[2][2][16] = {};
+    std::vector<char> _storage;
+    std::vector<Size> _offsets;
+    std::vector<u32> _buckets[kBuckets];
+};
+
+} // namespace slib
@@ -0,0 +1,113 @@
+﻿/**
+ * @File InlineFunction.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <SLib/Math/Numeric.hpp>
+
+namespace slib {
+
+/**
+ * 小缓冲区函数对象: 可调用对象总是存放在内联缓冲区中，从不分配堆内存.
+ * 与 std::function 不同，它只能移动，且可调用对象必须能放进 Capacity 字节，否则编译失败.
+ */
+template<typename Signature, Size Capacity = 48>
+class InlineFunction;
+
+template<typename R, typename... Args, Size Capacity>
+class InlineFunction<R(Args...), Capacity>
+{
+    struct Operations
+    {
+        R (*invoke)(void*, Args&&...);
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename F>
+    static constexpr Operations kOperations = {
+        [](void* f, Args&&... args) -> R { return std::invoke(*static_cast<F*>(f), std::forward<Args>(args)...); },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) F(std::move(*static_cast<F*>(src)));
+            static_cast<F*>(src)->~F();
+        },
+        [](void* f) noexcept { static_cast<F*>(f)->~F(); },
+    };
+
+public:
+    static constexpr Size kCapacity = Capacity;
+
+    InlineFunction() noexcept = default;
+
+    InlineFunction(std::nullptr_t) noexcept { }
+
+    template<typename F, typename D = std::decay_t<F>>
+        requires(!std::is_same_v<D, InlineFunction> && std::is_invocable_r_v<R, D&, Args...>)
+    InlineFunction(F&& f) // NOLINT(google-explicit-constructor)
+    {
+        static_assert(sizeof(D) <= Capacity, "Callable is too large for InlineFunction, increase the capacity.");
+        static_assert(alignof(D) <= alignof(std::max_align_t), "Callable is over-aligned for InlineFunction.");
+        static_assert(std::is_nothrow_move_constructible_v<D>, "Callable must be nothrow move constructible.");
+
+        ::new (static_cast<void*>(_storage)) D(std::forward<F>(f));
+        _ops = &kOperations<D>;
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept : _ops(other._ops)
+    {
+        if (_ops) {
+            _ops->relocate(_storage, other._storage);
+            other._ops = nullptr;
+        }
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            if (other._ops) {
+                other._ops->relocate(_storage, other._storage);
+                _ops       = other._ops;
+                other._ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&)            = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction() { reset(); }
+
+    void reset() noexcept
+    {
+        if (_ops) {
+            _ops->destroy(_storage);
+            _ops = nullptr;
+        }
+    }
+
+    R operator()(Args... args) const
+    {
+        SLIB_ASSUME(_ops != nullptr);
+        return _ops->invoke(_storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return _ops != nullptr; }
+
+private:
+    const Operations* _ops = nullptr;
+    alignas(std::max_align_t) mutable std::byte _storage[Capacity];
+};
+
+} // namespace slib
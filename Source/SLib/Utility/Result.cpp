@@ -0,0 +1,58 @@
+﻿/**
+ * @File Result.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "Result.hpp"
+
+#include <cstring>
+#include <new>
+
+using namespace slib;
+
+detail::FailureContext* slib::detail::CreateFailureContext(StringView text)
+{
+    void* memory  = ::operator new(sizeof(FailureContext) + text.size() + 1);
+    auto* context = new (memory) FailureContext{{1}, static_cast<u32>(text.size())};
+
+    auto* dst = reinterpret_cast<char*>(context + 1);
+    std::memcpy(dst, text.data(), text.size());
+    dst[text.size()] = '\0';
+    return context;
+}
+
+void slib::detail::DestroyFailureContext(FailureContext* context)
+{
+    context->~FailureContext();
+    ::operator delete(context);
+}
+
+Failure& Failure::withContext(StringView context) &
+{
+    if (context.empty())
+        return *this;
+
+    const auto inner = this->context();
+    std::string text(context.data(), context.size());
+    if (!inner.empty()) {
+        text += ": ";
+        text += inner;
+    }
+
+    release();
+    _context = detail::CreateFailureContext(StringView(text.data(), text.size()));
+    return *this;
+}
+
+String Failure::toString() const
+{
+    const auto name = FailureName(_type);
+    std::string text(name.data(), name.size());
+    if (_context) {
+        text += ": ";
+        text += context();
+    }
+    return String(StringView(text.data(), text.size()));
+}
@@ -0,0 +1,207 @@
+﻿/**
+ * @File Result.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <expected>
+#include <format>
+#include <utility>
+
+#include <SLib/Math/Numeric.hpp>
+#include <SLib/String/StringBuilder.hpp>
+#include <SLib/Enum/Enum.hpp>
+
+namespace slib {
+
+enum class FailureType : u32
+{
+    Failed = 0,      ///> General Failed.
+    InvalidArgument, ///> 参数不合法.
+    OutOfRange,      ///> 数值或下标越界.
+    NotFound,        ///> 对象、文件或键不存在.
+    AlreadyExists,   ///> 对象已存在或状态已被占用.
+    Unsupported,     ///> 当前平台或配置不支持.
+    IOError,         ///> 读写失败.
+    ParseError,      ///> 输入格式错误.
+    OutOfMemory,     ///> 内存不足.
+    Timeout,         ///> 超时.
+    Cancelled,       ///> 操作被取消.
+};
+
+constexpr std::string_view FailureName(FailureType failure)
+{
+    return me::enum_name(failure);
+}
+
+namespace detail {
+
+/**
+ * 失败的附加说明，引用计数，文本紧随其后存放.
+ */
+struct FailureContext
+{
+    std::atomic<u32> refs;
+    u32 size;
+
+    SLIB_NODISCARD const char* text() const { return reinterpret_cast<const char*>(this + 1); }
+};
+
+FailureContext* CreateFailureContext(StringView text);
+void DestroyFailureContext(FailureContext* context);
+
+} // namespace detail
+
+/**
+ * 紧凑的错误值: 错误码加可选的说明，占两个机器字.
+ *
+ * 只有错误码时不分配内存，复制只是两个字; 说明在需要时才附加 (构造时给出，或沿调用链向上传递时用 withContext 补充)，
+ * 以引用计数共享，复制不会复制文本. 热点路径可以只返回错误码，由外层决定是否补充说明.
+ */
+class Failure
+{
+public:
+    constexpr Failure() noexcept = default;
+
+    constexpr Failure(FailureType type) noexcept : _type(type) { }
+
+    Failure(FailureType type, StringView context) : _type(type), _context(context.empty() ? nullptr : detail::CreateFailureContext(context)) { }
+
+    Failure(const Failure& other) noexcept : _type(other._type), _context(other._context) { retain(); }
+
+    Failure(Failure&& other) noexcept : _type(other._type), _context(std::exchange(other._context, nullptr)) { }
+
+    Failure& operator=(const Failure& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            _type    = other._type;
+            _context = other._context;
+            retain();
+        }
+        return *this;
+    }
+
+    Failure& operator=(Failure&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            _type    = other._type;
+            _context = std::exchange(other._context, nullptr);
+        }
+        return *this;
+    }
+
+    ~Failure() { release(); }
+
+    SLIB_NODISCARD FailureType type() const noexcept { return _type; }
+
+    SLIB_NODISCARD bool hasContext() const noexcept { return _context != nullptr; }
+
+    /**
+     * @brief 附加的说明，没有时为空.
+     */
+    SLIB_NODISCARD StringView context() const noexcept { return _context ? StringView(_context->text(), _context->size) : StringView{}; }
+
+    /**
+     * @brief 在已有说明之前补充一层说明，形如 "outer: inner".
+     */
+    Failure& withContext(StringView context) &;
+
+    Failure&& withContext(StringView context) && { return std::move(withContext(context)); }
+
+    /**
+     * @brief "错误码: 说明"，没有说明时只有错误码.
+     */
+    SLIB_NODISCARD String toString() const;
+
+    friend bool operator==(const Failure& failure, FailureType type) noexcept { return failure._type == type; }
+
+private:
+    void retain() const noexcept
+    {
+        if (_context)
+            _context->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept
+    {
+        if (_context && _context->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            detail::DestroyFailureContext(_context);
+        _context = nullptr;
+    }
+
+    FailureType _type = FailureType::Failed;
+    detail::FailureContext* _context = nullptr;
+};
+
+static_assert(sizeof(Failure) == 2 * sizeof(void*));
+
+using UnexpectedType = Failure;
+
+template<typename T>
+using Result = std::expected<T, Failure>;
+
+inline std::unexpected<Failure> Unexpected(FailureType failure)
+{
+    return std::unexpected<Failure>{failure};
+}
+
+inline std::unexpected<Failure> Unexpected(FailureType failure, StringView msg)
+{
+    return std::unexpected<Failure>{
+      Failure{failure, msg}
+    };
+}
+
+template<typename... Args>
+std::unexpected<Failure> Unexpected(FailureType failure, std::format_string<Args...> fmt, Args&&... args)
+{
+    StringBuilder msg;
+    msg.format(fmt, std::forward<Args>(args)...);
+    return std::unexpected<Failure>{
+      Failure{failure, msg.view()}
+    };
+}
+
+} // namespace slib
+
+// clang-format off
+
+#define SLIB_RESULT_CONCAT_IMPL(a, b) a##b
+#define SLIB_RESULT_CONCAT(a, b)      SLIB_RESULT_CONCAT_IMPL(a, b)
+
+/**
+ * 对返回 Result 的表达式求值，失败时把错误原样返回给调用者 (调用者也须返回 Result).
+ */
+#define SLIB_TRY(expr)                                                                                \
+    do {                                                                                              \
+        auto&& slibTryResult = (expr);                                                                \
+        if (!slibTryResult) [[unlikely]]                                                              \
+            return ::std::unexpected(::std::forward<decltype(slibTryResult)>(slibTryResult).error()); \
+    } while (0)
+
+/**
+ * 同 SLIB_TRY，成功时把值赋给 lhs (可以是新声明，如 `auto value`).
+ */
+#define SLIB_TRY_ASSIGN(lhs, expr) SLIB_TRY_ASSIGN_IMPL(SLIB_RESULT_CONCAT(slibTryResult, __COUNTER__), lhs, expr)
+#define SLIB_TRY_ASSIGN_IMPL(result, lhs, expr)                                     \
+    auto&& result = (expr);                                                         \
+    if (!result) [[unlikely]]                                                       \
+        return ::std::unexpected(::std::forward<decltype(result)>(result).error()); \
+    lhs = *::std::forward<decltype(result)>(result)
+
+/**
+ * SLIB_CHECK 的无异常版本: 条件不成立时返回 Unexpected(failure, 说明...).
+ */
+#define SLIB_CHECK_RESULT(cond, failure, ...)                              \
+    do {                                                                   \
+        if (!(cond)) [[unlikely]]                                          \
+            return ::slib::Unexpected(failure __VA_OPT__(, ) __VA_ARGS__); \
+    } while (0)
+
+// clang-format on
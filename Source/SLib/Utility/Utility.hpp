@@ -12,6 +12,7 @@
 
 #include <SLib/String/StringType.hpp>
 #include <SLib/Enum/Enum.hpp>
+#include <SLib/Utility/Result.hpp>
 
 namespace slib {
 
@@ -19,35 +20,4 @@ namespace slib {
 template<typename T>
 using Opt = std::optional<T>;
 
-// Result
-enum class FailureType
-{
-    Failed = 0, ///> General Failed.
-};
-
-constexpr std::string_view FailureName(FailureType failure)
-{
-    return me::enum_name(failure);
-}
-
-using UnexpectedType = std::pair<FailureType, String>;
-
-inline std::unexpected<UnexpectedType> Unexpected(FailureType failure, StringView msg)
-{
-    return std::unexpected<UnexpectedType>{
-      {failure, String(msg)}
-    };
-}
-
-template<typename... Args>
-std::unexpected<UnexpectedType> Unexpected(FailureType failure, std::format_string<Args...> fmt, Args&&... args)
-{
-    return std::unexpected<UnexpectedType>{
-      {failure, String(std::format(fmt, std::forward<Args>(args)...))}
-    };
-}
-
-template<typename T>
-using Result = std::expected<T, UnexpectedType>;
-
 } // namespace slib
\ No newline at end of file
@@ -0,0 +1,220 @@
+﻿/**
+ * @File AsyncFileThroughput.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <SLib/Concurrency/Task.hpp>
+#include <SLib/IO/AsyncFile.hpp>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kFileSize   = Size(32) << 20;
+constexpr Size kWriteChunk = Size(256) << 10;
+constexpr Size kReadBlock  = 4096;
+constexpr Size kReads      = 32768;
+constexpr u32 kQueueDepth  = 64;
+
+int gErrors = 0;
+
+void Check(bool ok, const char* what)
+{
+    if (!ok && gErrors++ < 20)
+        std::printf("failed: %s\n", what);
+}
+
+char Pattern(Size i)
+{
+    return static_cast<char>((i >> 12) * 131 + i * 7);
+}
+
+bool Verify(const char* data, u64 offset, Size length)
+{
+    for (Size i = 0; i < length; ++i) {
+        if (data[i] != Pattern(offset + i))
+            return false;
+    }
+    return true;
+}
+
+template<typename F>
+double Seconds(F&& f)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+void Report(const char* name, Size bytes, double seconds)
+{
+    std::printf("%-32s%10.1f MB/s\n", name, static_cast<double>(bytes) / seconds / 1e6);
+}
+
+std::vector<u64> RandomOffsets()
+{
+    std::mt19937_64 rng(42);
+    std::vector<u64> offsets(kReads);
+    for (auto& offset : offsets)
+        offset = rng() % (kFileSize / kReadBlock) * kReadBlock;
+    return offsets;
+}
+
+/**
+ * @brief 每轮排队 kQueueDepth 个随机读并一次提交，等待完成后校验内容.
+ */
+void RandomReads(AsyncFile& file, const std::vector<u64>& offsets, std::vector<char>& buffer)
+{
+    std::atomic<Size> failures = 0;
+    for (Size base = 0; base < offsets.size(); base += kQueueDepth) {
+        for (Size i = 0; i < kQueueDepth && base + i < offsets.size(); ++i) {
+            char* data = buffer.data() + i * kReadBlock;
+            file.read(offsets[base + i], {data, kReadBlock}, [&failures, data, offset = offsets[base + i]](Result<Size> result) {
+                if (!result || *result != kReadBlock || !Verify(data, offset, kReadBlock))
+                    failures.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        file.submit();
+        file.drain();
+    }
+    Check(failures.load() == 0, "random reads");
+}
+
+/**
+ * @brief 协程顺序读完整个文件，返回读到的字节数.
+ */
+Task<Size> ReadAll(AsyncFile& file, std::vector<char>& buffer)
+{
+    Size total = 0;
+    for (;;) {
+        auto result = co_await file.readAsync(total, buffer);
+        if (!result || *result == 0)
+            break;
+        Check(Verify(buffer.data(), total, *result), "coroutine read content");
+        total += *result;
+    }
+    co_return total;
+}
+
+void TestBackend(AsyncIoBackend backend, const char* name, const std::string& path, const std::vector<u64>& offsets)
+{
+    auto opened = AsyncFile::Open(path, {.mode = FileMode::Write, .backend = backend, .queueDepth = kQueueDepth});
+    if (!opened) {
+        std::printf("%-32sskipped (%s)\n", name, opened.error().toString().c_str());
+        return;
+    }
+    AsyncFile file = std::move(*opened);
+    Check(file.backend() == backend, "backend");
+
+    // 写入: 一次排队全部分块，在途数受 queueDepth 限制，其余在完成时补充提交
+    std::vector<char> content(kFileSize);
+    for (Size i = 0; i < kFileSize; ++i)
+        content[i] = Pattern(i);
+
+    std::atomic<Size> written = 0;
+
+    const double writeTime = Seconds([&] {
+        for (Size offset = 0; offset < kFileSize; offset += kWriteChunk) {
+            file.write(offset, {content.data() + offset, kWriteChunk}, [&written](Result<Size> result) {
+                if (result)
+                    written.fetch_add(*result, std::memory_order_relaxed);
+            });
+        }
+        file.drain();
+    });
+    Check(written.load() == kFileSize, "write size");
+
+    bool synced = false;
+    file.fsync([&synced](Result<Size> result) { synced = static_cast<bool>(result); }, true);
+    file.drain();
+    Check(synced && file.pending() == 0, "fsync");
+    Check(file.size() && *file.size() == kFileSize, "file size");
+    file.close();
+    Check(!file.isOpen(), "close");
+
+    opened = AsyncFile::Open(path, {.backend = backend, .queueDepth = kQueueDepth});
+    Check(static_cast<bool>(opened), "reopen");
+    if (!opened)
+        return;
+    file = std::move(*opened);
+
+    std::vector<char> buffer(kQueueDepth * kReadBlock);
+    const double readTime = Seconds([&] { RandomReads(file, offsets, buffer); });
+
+    const std::span<char> registered[] = {buffer};
+    Check(static_cast<bool>(file.registerBuffers(registered)), "register buffers");
+    const double fixedTime = Seconds([&] { RandomReads(file, offsets, buffer); });
+    file.unregisterBuffers();
+
+    // 文件末尾: 跨过末尾的读返回实际长度，末尾处的读返回 0
+    Size tail = 1, end = 1;
+    file.read(kFileSize - 100, {buffer.data(), kReadBlock}, [&tail](Result<Size> result) { tail = result ? *result : 0; });
+    file.read(kFileSize, {buffer.data() + kReadBlock, kReadBlock}, [&end](Result<Size> result) { end = result ? *result : 1; });
+    file.drain();
+    Check(tail == 100 && Verify(buffer.data(), kFileSize - 100, 100) && end == 0, "read at end of file");
+
+    std::vector<char> chunk(Size(1) << 20);
+    Size total             = 0;
+    const double awaitTime = Seconds([&] { total = SyncWait(ReadAll(file, chunk)); });
+    Check(total == kFileSize, "coroutine read size");
+
+    // 只读文件上的写入以错误完成
+    bool failed = false;
+    file.write(0, {content.data(), 16}, [&failed](Result<Size> result) { failed = !result; });
+    file.drain();
+    Check(failed, "write error");
+
+    const std::string prefix = name;
+    Report((prefix + " write").c_str(), kFileSize, writeTime);
+    Report((prefix + " random read").c_str(), kReads * kReadBlock, readTime);
+    Report((prefix + " random read, fixed").c_str(), kReads * kReadBlock, fixedTime);
+    Report((prefix + " co_await read").c_str(), kFileSize, awaitTime);
+}
+
+} // namespace
+
+int main()
+{
+    const auto path    = (std::filesystem::temp_directory_path() / "SLibAsyncFile.bin").string();
+    const auto offsets = RandomOffsets();
+
+    TestBackend(AsyncIoBackend::IoUring, "io_uring", path, offsets);
+    TestBackend(AsyncIoBackend::ThreadPool, "thread pool", path, offsets);
+
+    // 基准: 阻塞的逐个 pread
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    std::vector<char> buffer(kReadBlock);
+    Size failures          = 0;
+    const double preadTime = Seconds([&] {
+        for (const u64 offset : offsets) {
+            if (::pread(fd, buffer.data(), kReadBlock, static_cast<off_t>(offset)) != static_cast<ssize_t>(kReadBlock) ||
+                !Verify(buffer.data(), offset, kReadBlock))
+                ++failures;
+        }
+    });
+    ::close(fd);
+    Check(failures == 0, "blocking pread");
+    Report("blocking pread", kReads * kReadBlock, preadTime);
+
+    auto missing = AsyncFile::Open((std::filesystem::temp_directory_path() / "SLibMissing.bin").string());
+    Check(!missing && missing.error().type() == FailureType::NotFound, "missing file");
+
+    std::filesystem::remove(path);
+    if (gErrors)
+        std::printf("%d errors\n", gErrors);
+    return gErrors == 0 ? 0 : 1;
+}
@@ -0,0 +1,349 @@
+﻿/**
+ * @File MappedTextReader.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <SLib/Concurrency/ThreadPool.hpp>
+#include <SLib/IO/Csv.hpp>
+#include <SLib/IO/Json.hpp>
+#include <SLib/IO/MappedFile.hpp>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kCsvRecords  = 200000;
+constexpr Size kJsonRecords = 100000;
+constexpr Size kParts       = 8;
+
+int gErrors = 0;
+
+void Check(bool ok, const char* what)
+{
+    if (!ok && gErrors++ < 20)
+        std::printf("failed: %s\n", what);
+}
+
+std::string View(StringView text)
+{
+    return {text.data(), text.size()};
+}
+
+std::string WriteTemp(const char* name, const std::string& content)
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream(path, std::ios::binary) << content;
+    return path;
+}
+
+template<typename F>
+double Seconds(F&& f)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// ==================
+// CSV
+// ==================
+
+/**
+ * @brief 随机字段，其中一部分含有分隔符、换行或引号.
+ */
+std::string RandomValue(std::mt19937_64& rng)
+{
+    static constexpr const char* kWords[]    = {"alpha", "beta", "3.14159", "-42", "", "x y z", "2026-10-19"};
+    static constexpr const char* kSuffixes[] = {",comma", "\nline", "\"quoted\"", "\r\n"};
+    std::string value                        = kWords[rng() % std::size(kWords)];
+    if (const Size i = rng() % 8; i < std::size(kSuffixes))
+        value += kSuffixes[i];
+    return value;
+}
+
+std::string EncodeField(const std::string& value)
+{
+    if (value.find_first_of(",\r\n\"") == std::string::npos)
+        return value;
+    std::string encoded = "\"";
+    for (const char c : value)
+        encoded += c == '"' ? std::string("\"\"") : std::string(1, c);
+    return encoded + '"';
+}
+
+void TestCsv()
+{
+    std::mt19937_64 rng(19);
+    std::string text;
+    std::vector<std::vector<std::string>> expected(kCsvRecords);
+    for (auto& record : expected) {
+        const Size fields = 1 + rng() % 8;
+        for (Size f = 0; f < fields; ++f) {
+            record.push_back(RandomValue(rng));
+            text += (f ? "," : "") + EncodeField(record.back());
+        }
+        // 只有一个空字段的记录与空行无法区分
+        if (fields == 1 && record[0].empty()) {
+            record[0] = "-";
+            text     += "-";
+        }
+        text += rng() % 4 == 0 ? "\r\n" : "\n";
+        if (rng() % 64 == 0)
+            text += "\n";
+    }
+
+    const auto path = WriteTemp("SLibMappedText.csv", text);
+    auto file       = MappedFile::Open(path, {.hugePages = true});
+    Check(file.has_value() && file->size() == text.size(), "map csv");
+    if (!file)
+        return;
+
+    // 顺序读取，每隔一段归还已处理的页
+    Size records = 0;
+    String buffer;
+    CsvReader reader(file->view());
+    double elapsed = Seconds([&] {
+        for (;;) {
+            auto more = reader.next();
+            if (!more || !*more) {
+                Check(more.has_value(), "csv parse");
+                break;
+            }
+            const auto& record = expected[records++];
+            bool same          = reader.fieldCount() == record.size();
+            for (Size f = 0; same && f < record.size(); ++f)
+                same = View(CsvUnescape(reader.field(f), buffer)) == record[f];
+            if (!same && gErrors++ < 20)
+                std::printf("csv record %zu differs\n", records - 1);
+            if (records % 4096 == 0)
+                file->evict(0, reader.position());
+        }
+    });
+    Check(records == expected.size(), "csv record count");
+    std::printf("%-24s%10.1f MB/s\n", "csv, sequential", static_cast<double>(text.size()) / elapsed / 1e6);
+
+    // 按记录边界切分后并行解析
+    const auto chunks = SplitCsv(file->view(), kParts);
+    std::vector<Size> counts(chunks.size());
+    std::atomic<int> failures{0};
+    elapsed = Seconds([&] {
+        ParallelFor(0, chunks.size(), [&](Size i) {
+            CsvReader part(chunks[i]);
+            for (;;) {
+                auto more = part.next();
+                if (!more || !*more) {
+                    failures += !more.has_value();
+                    return;
+                }
+                ++counts[i];
+            }
+        });
+    });
+    Size total = 0;
+    for (const Size c : counts)
+        total += c;
+    Check(failures == 0 && total == expected.size() && chunks.size() > 1, "csv parallel");
+    std::printf("%-24s%10.1f MB/s (%zu chunks)\n", "csv, parallel", static_cast<double>(text.size()) / elapsed / 1e6, chunks.size());
+
+    // 格式错误
+    for (const char* bad : {"a,\"b", "a,b\"c\n", "\"a\"b,c\n", "x\n\"a\"\"\n"}) {
+        CsvReader r(bad);
+        bool failed = false;
+        for (;;) {
+            auto more = r.next();
+            if (!more) {
+                failed = more.error().type() == FailureType::ParseError;
+                break;
+            }
+            if (!*more)
+                break;
+        }
+        Check(failed, bad);
+    }
+
+    CsvReader edge("a,,\"\"\r\n\n,\n\"x\"\"y\"");
+    Check(edge.next().value_or(false) && edge.fieldCount() == 3 && edge.field(1).empty() && edge.field(2).empty(), "csv empty fields");
+    Check(edge.next().value_or(false) && edge.fieldCount() == 2, "csv delimiter only");
+    Check(edge.next().value_or(false) && View(CsvUnescape(edge.field(0), buffer)) == "x\"y", "csv escaped quote");
+    Check(!edge.next().value_or(true), "csv end");
+}
+
+// ==================
+// JSON
+// ==================
+
+struct ExpectedToken
+{
+    JsonTokenType type;
+    std::string text; ///< 字符串为还原转义后的内容
+};
+
+void AppendString(std::mt19937_64& rng, std::string& json, std::vector<ExpectedToken>& tokens, JsonTokenType type)
+{
+    static constexpr const char* kPlain[]   = {"id", "name", "value", "tags", "", "a longer string with spaces"};
+    static constexpr const char* kEscaped[] = {R"(line\nbreak)", R"(quote\"d)", R"(back\\slash\\)", R"(été)", R"(😀)"};
+    static constexpr const char* kDecoded[] = {"line\nbreak", "quote\"d", "back\\slash\\", "\xc3\xa9t\xc3\xa9", "\xf0\x9f\x98\x80"};
+    const Size i                            = rng() % 8;
+    if (i < std::size(kEscaped)) {
+        json += '"' + std::string(kEscaped[i]) + '"';
+        tokens.push_back({type, kDecoded[i]});
+        return;
+    }
+    const char* s = kPlain[rng() % std::size(kPlain)];
+    json         += '"' + std::string(s) + '"';
+    tokens.push_back({type, s});
+}
+
+void AppendValue(std::mt19937_64& rng, std::string& json, std::vector<ExpectedToken>& tokens, int depth)
+{
+    static constexpr const char* kNumbers[] = {"0", "-1", "42", "3.25", "-0.5e-3", "6.02E+23", "1e9"};
+    const Size kind                         = depth > 3 ? rng() % 5 : rng() % 7;
+    switch (kind) {
+    case 0 : AppendString(rng, json, tokens, JsonTokenType::String); break;
+    case 1 :
+        tokens.push_back({JsonTokenType::Number, kNumbers[rng() % std::size(kNumbers)]});
+        json += tokens.back().text;
+        break;
+    case 2 :
+        json += "true";
+        tokens.push_back({JsonTokenType::True, "true"});
+        break;
+    case 3 :
+        json += "false";
+        tokens.push_back({JsonTokenType::False, "false"});
+        break;
+    case 4 :
+        json += "null";
+        tokens.push_back({JsonTokenType::Null, "null"});
+        break;
+    case 5 :
+        json += "[";
+        tokens.push_back({JsonTokenType::BeginArray, "["});
+        for (Size n = rng() % 4, i = 0; i < n; ++i) {
+            json += i ? ", " : "";
+            AppendValue(rng, json, tokens, depth + 1);
+        }
+        json += "]";
+        tokens.push_back({JsonTokenType::EndArray, "]"});
+        break;
+    default :
+        json += "{";
+        tokens.push_back({JsonTokenType::BeginObject, "{"});
+        for (Size n = rng() % 4, i = 0; i < n; ++i) {
+            json += i ? "," : "";
+            AppendString(rng, json, tokens, JsonTokenType::Key);
+            json += ": ";
+            AppendValue(rng, json, tokens, depth + 1);
+        }
+        json += "}";
+        tokens.push_back({JsonTokenType::EndObject, "}"});
+        break;
+    }
+}
+
+bool ReadsCleanly(StringView json)
+{
+    JsonReader reader(json);
+    for (;;) {
+        auto more = reader.next();
+        if (!more)
+            return false;
+        if (!*more)
+            return true;
+    }
+}
+
+void TestJson()
+{
+    std::mt19937_64 rng(49);
+    std::string text;
+    std::vector<ExpectedToken> expected;
+    for (Size i = 0; i < kJsonRecords; ++i) {
+        text += "{\"seq\": ";
+        text += std::to_string(i);
+        expected.push_back({JsonTokenType::BeginObject, "{"});
+        expected.push_back({JsonTokenType::Key, "seq"});
+        expected.push_back({JsonTokenType::Number, std::to_string(i)});
+        text += ", \"data\": ";
+        expected.push_back({JsonTokenType::Key, "data"});
+        AppendValue(rng, text, expected, 1);
+        text += "}\n";
+        expected.push_back({JsonTokenType::EndObject, "}"});
+    }
+
+    const auto path = WriteTemp("SLibMappedText.jsonl", text);
+    auto file       = MappedFile::Open(path);
+    Check(file.has_value() && file->size() == text.size(), "map json");
+    if (!file)
+        return;
+
+    Size count = 0;
+    String buffer;
+    JsonReader reader(file->view());
+    double elapsed = Seconds([&] {
+        for (;;) {
+            auto more = reader.next();
+            if (!more || !*more) {
+                Check(more.has_value(), "json parse");
+                break;
+            }
+            const auto& token = reader.token();
+            auto decoded      = JsonUnescape(token.text, buffer);
+            const bool same   = count < expected.size() && token.type == expected[count].type && decoded && View(*decoded) == expected[count].text;
+            if (!same && gErrors++ < 20)
+                std::printf("json token %zu differs: %s\n", count, View(token.text).c_str());
+            ++count;
+        }
+    });
+    Check(count == expected.size() && reader.depth() == 0, "json token count");
+    std::printf("%-24s%10.1f MB/s\n", "json lines, sequential", static_cast<double>(text.size()) / elapsed / 1e6);
+
+    const auto chunks = SplitJsonLines(file->view(), kParts);
+    std::vector<Size> counts(chunks.size());
+    elapsed = Seconds([&] {
+        ParallelFor(0, chunks.size(), [&](Size i) {
+            JsonReader part(chunks[i]);
+            while (part.next().value_or(false))
+                ++counts[i];
+        });
+    });
+    Size total = 0;
+    for (const Size c : counts)
+        total += c;
+    Check(total == expected.size() && chunks.size() > 1, "json parallel");
+    std::printf("%-24s%10.1f MB/s (%zu chunks)\n", "json lines, parallel", static_cast<double>(text.size()) / elapsed / 1e6, chunks.size());
+
+    for (const char* good : {"", " ", "[]", "{}", "[1,[2,{\"a\":null}]]", "\"\\\\\"", "-0", "1.5e+10", "0 1 \"x\"", "{\"a\\\"b\":[true,false]}"})
+        Check(ReadsCleanly(good), good);
+    for (const char* bad : {"[", "]", "{\"a\"}", "{\"a\":}", "{,}", "[1,]", "[1 2]", "{\"a\":1,}", "\"abc", "\"a\\qb\"", "\"a\x01\"",
+                            "01", "1.", "-", ".5", "1e", "tru", "nul", "[true false]", "{\"a\" 1}", "{1:2}", "[\"a\":1]", "\\"})
+        Check(!ReadsCleanly(bad), bad);
+
+    Check(!JsonUnescape("\\ud800", buffer).has_value() && !JsonUnescape("\\u12G4", buffer).has_value(), "json bad unicode");
+}
+
+} // namespace
+
+int main()
+{
+    TestCsv();
+    TestJson();
+
+    auto missing = MappedFile::Open((std::filesystem::temp_directory_path() / "SLibMissing.csv").string());
+    Check(!missing && missing.error().type() == FailureType::NotFound, "missing file");
+
+    if (gErrors)
+        std::printf("%d errors\n", gErrors);
+    return gErrors == 0 ? 0 : 1;
+}
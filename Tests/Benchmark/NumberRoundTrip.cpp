@@ -0,0 +1,147 @@
+﻿/**
+ * @File NumberRoundTrip.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include <SLib/String/Number.hpp>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kRandomValues = Size(1) << 21;
+
+int gErrors = 0;
+
+/**
+ * @brief 与 std::to_chars 的输出逐字节比较，再解析回来比较位模式.
+ */
+template<typename T>
+void CheckValue(T value)
+{
+    char ours[kMaxNumberLength];
+    char expected[64];
+    const char* end      = FormatNumber(ours, value);
+    const auto reference = std::to_chars(expected, expected + sizeof(expected), value);
+    const StringView text(ours, static_cast<Size>(end - ours));
+
+    if (text.size() != static_cast<Size>(reference.ptr - expected) || std::memcmp(ours, expected, text.size()) != 0) {
+        if (gErrors++ < 10)
+            std::printf("format mismatch: %.*s vs %.*s\n", static_cast<int>(text.size()), ours, static_cast<int>(reference.ptr - expected), expected);
+        return;
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(value))
+            return;
+    }
+    const auto parsed = ParseNumber<T>(text);
+    bool same         = parsed.has_value();
+    if constexpr (std::is_floating_point_v<T>)
+        same = same && std::memcmp(&*parsed, &value, sizeof(T)) == 0;
+    else
+        same = same && *parsed == value;
+    if (!same && gErrors++ < 10)
+        std::printf("round trip failed: %.*s\n", static_cast<int>(text.size()), ours);
+}
+
+/**
+ * @brief 与 std::from_chars 比较结果、消耗的长度与错误类型.
+ */
+template<typename T>
+void CheckParse(std::string_view text)
+{
+    T expected{};
+    const auto reference = std::from_chars(text.data(), text.data() + text.size(), expected);
+    const auto parsed    = ParseNumberPrefix<T>(StringView(text.data(), text.size()));
+
+    bool same = parsed.has_value() == (reference.ec == std::errc());
+    if (same && parsed)
+        same = std::memcmp(&parsed->value, &expected, sizeof(T)) == 0 && parsed->length == static_cast<Size>(reference.ptr - text.data());
+    else if (same)
+        same = (parsed.error().type() == FailureType::OutOfRange) == (reference.ec == std::errc::result_out_of_range);
+    if (!same && gErrors++ < 10)
+        std::printf("parse mismatch (%zu bytes): \"%.*s\"\n", sizeof(T), static_cast<int>(text.size()), text.data());
+}
+
+template<typename... Ts>
+void CheckParseAll(std::string_view text)
+{
+    (CheckParse<Ts>(text), ...);
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 rng(0x5EED);
+
+    // 任意位模式，包括次正规数、无穷与 NaN
+    for (Size i = 0; i < kRandomValues; ++i) {
+        CheckValue(std::bit_cast<f64>(rng()));
+        CheckValue(std::bit_cast<f32>(static_cast<u32>(rng())));
+        const u64 bits = rng() >> (rng() % 64);
+        CheckValue(bits);
+        CheckValue(static_cast<i64>(bits) * (rng() & 1 ? 1 : -1));
+        CheckValue(static_cast<i32>(bits));
+        CheckValue(static_cast<u16>(bits));
+    }
+
+    // 2 的幂附近与最小的次正规数
+    for (int e = -1080; e < 1030; ++e) {
+        const u64 bits = std::bit_cast<u64>(std::ldexp(1.0, e));
+        for (u64 d = 0; d < 4; ++d)
+            CheckValue(std::bit_cast<f64>(bits + d - 2));
+    }
+    for (u32 t = 0; t < 4096; ++t) {
+        CheckValue(std::bit_cast<f64>(u64(t)));
+        CheckValue(std::bit_cast<f32>(t));
+    }
+    for (i64 v : {i64(0), i64(-1), numeric_limits<i64>::min(), numeric_limits<i64>::max(), i64(99999999), i64(100000000), i64(4294967295), i64(4294967296)})
+        CheckValue(v);
+    CheckValue(numeric_limits<u64>::max());
+
+    // 随机的十进制文本: 长尾数、前导零、小数点位置与指数都在变化，覆盖快速路径与回退路径
+    for (Size i = 0; i < kRandomValues / 4; ++i) {
+        std::string text;
+        if (rng() & 1)
+            text += '-';
+        const Size digits = 1 + rng() % 24;
+        for (Size d = 0; d < digits; ++d)
+            text += static_cast<char>('0' + rng() % 10);
+        if (rng() % 3)
+            text.insert(text.size() - rng() % (digits + 1), ".");
+        if (rng() & 1)
+            text += "e" + std::to_string(static_cast<int>(rng() % 700) - 350);
+        CheckParseAll<f64, f32>(text);
+    }
+
+    constexpr const char* kEdgeCases[] = {
+        "", "-", "+1", " 1", "0", "-0", "007", ".5", "5.", ".", "-.e1", "1e", "1e+", "1e-5x", "1E5", "0e999999999", "1e99999999999",
+        "1e-99999999999", "inf", "-Infinity", "nan", "NaN(1)", "infx", "0x10", "12abc",
+        "4.9e-324", "2.4703282292062327e-324", "2.4703282292062328e-324", "2.2250738585072011e-308", "1.7976931348623157e308",
+        "1.7976931348623158e308", "1.7976931348623159e308", "9007199254740993", "9007199254740993.0000000000000000001",
+        "1e-45", "7e-46", "3.4028235e38", "3.4028236e38", "0.000000000000000000000000000000000000001234",
+        "18446744073709551615", "18446744073709551616", "28446744073709551615", "99999999999999999999", "100000000000000000000",
+        "000000000000000000000000018446744073709551615", "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+        "-9223372036854775809", "255", "256", "-128", "-129", "4294967295", "4294967296", "-2147483648", "-2147483649", "12345678x",
+    };
+    for (const char* text : kEdgeCases)
+        CheckParseAll<f64, f32, u64, i64, u32, i32, u16, i16, u8, i8>(text);
+
+    if (gErrors)
+        std::printf("%d errors\n", gErrors);
+    else
+        std::printf("number round trip: ok\n");
+    return gErrors == 0 ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+﻿/**
+ * @File ProfilerOverhead.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SLib/Profile/Profiler.hpp>
+
+using namespace slib;
+
+namespace {
+
+// 每批的区间数小于线程缓冲容量，批次之间等待后台线程排空，测得的是不丢弃时的开销
+constexpr Size kBatch   = Profiler::kThreadBufferEvents / 2;
+constexpr Size kBatches = 32;
+constexpr u32 kInterval = 5;
+constexpr Size kThreads = 4;
+
+thread_local volatile u64 tSink = 0;
+
+SLIB_NO_INLINE void Plain(Size n)
+{
+    for (Size i = 0; i < n; ++i)
+        tSink = tSink + i;
+}
+
+SLIB_NO_INLINE void Zoned(Size n)
+{
+    for (Size i = 0; i < n; ++i) {
+        SLIB_PROFILE_SCOPE("zone");
+        tSink = tSink + i;
+    }
+}
+
+/**
+ * @brief 取所有批次中最快的一次，返回每次迭代的纳秒数.
+ */
+template<typename F>
+double NanosPerIteration(F&& f, bool waitFlush)
+{
+    double best = 1e300;
+    for (Size b = 0; b < kBatches; ++b) {
+        const auto t0 = std::chrono::steady_clock::now();
+        f(kBatch);
+        const auto t1 = std::chrono::steady_clock::now();
+        best          = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / kBatch);
+        if (waitFlush)
+            std::this_thread::sleep_for(std::chrono::milliseconds(kInterval * 3));
+    }
+    return best;
+}
+
+} // namespace
+
+int main()
+{
+    int errors       = 0;
+    const auto trace = (std::filesystem::temp_directory_path() / "SLibProfilerOverhead.json").string();
+
+    const double plain    = NanosPerIteration(Plain, false);
+    const double inactive = NanosPerIteration(Zoned, false);
+
+    if (!Profiler::Start({.path = trace.c_str(), .flushIntervalMs = kInterval})) {
+        std::printf("cannot start profiler\n");
+        return 1;
+    }
+    SLIB_PROFILE_THREAD("main");
+    errors += static_cast<bool>(Profiler::Start({.path = trace.c_str()})); // 重复开始应当失败
+
+    const double active = NanosPerIteration(Zoned, true);
+
+    // 多线程同时记录，线程退出后缓冲由后台线程回收
+    std::vector<std::thread> threads;
+    for (Size t = 0; t < kThreads; ++t) {
+        threads.emplace_back([] {
+            SLIB_PROFILE_THREAD("worker");
+            SLIB_PROFILE_FUNCTION();
+            Zoned(kBatch / 4);
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    const u64 dropped = Profiler::DroppedEvents();
+    const u64 written = Profiler::Stop();
+    const u64 minimum = kBatch * kBatches + kThreads * (kBatch / 4 + 1);
+    errors += written + dropped < minimum;
+
+    std::ifstream file(trace);
+    const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    errors += !json.starts_with("{\"displayTimeUnit\"") || !json.ends_with("]}\n") || json.find("\"worker\"") == std::string::npos;
+
+    std::printf("%-24s%10.2fns\n", "loop body", plain);
+    std::printf("%-24s%10.2fns\n", "zone, profiler stopped", inactive - plain);
+    std::printf("%-24s%10.2fns%s\n", "zone, profiler running", active - plain, active - plain <= 20.0 ? "" : "  (over 20ns budget)");
+    std::printf("%-24s%10llu written, %llu dropped -> %s\n", "events", static_cast<unsigned long long>(written),
+                static_cast<unsigned long long>(dropped), trace.c_str());
+
+    if (errors)
+        std::printf("%d errors\n", errors);
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+﻿/**
+ * @File QueueBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <SLib/Concurrency/MPMCQueue.hpp>
+#include <SLib/Concurrency/MPSCQueue.hpp>
+#include <SLib/Concurrency/SPSCQueue.hpp>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kItems    = Size(1) << 21;
+constexpr Size kCapacity = 1024;
+constexpr Size kPingPong = Size(1) << 15;
+constexpr Size kRepeats  = 3;
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief 基线: std::mutex 保护的 std::deque，接口与无锁队列一致.
+ */
+template<typename T>
+class MutexQueue
+{
+public:
+    explicit MutexQueue(Size) { }
+
+    bool tryPush(T value)
+    {
+        std::lock_guard lock(_mutex);
+        _items.push_back(std::move(value));
+        return true;
+    }
+
+    Opt<T> tryPop()
+    {
+        std::lock_guard lock(_mutex);
+        if (_items.empty())
+            return std::nullopt;
+        T value = std::move(_items.front());
+        _items.pop_front();
+        return value;
+    }
+
+private:
+    std::mutex _mutex;
+    std::deque<T> _items;
+};
+
+/**
+ * @brief 忙等时先自旋，再让出时间片; 线程数多于核数时仍能推进.
+ */
+class Backoff
+{
+public:
+    void operator()()
+    {
+        if (++_count < 64)
+            return;
+        _count = 0;
+        std::this_thread::yield();
+    }
+
+private:
+    u32 _count = 0;
+};
+
+struct Timing
+{
+    double ms    = 1e300;
+    bool correct = true;
+};
+
+/**
+ * @brief producers 个生产者各推入 kItems / producers 个值，consumers 个消费者取完全部，检查总和.
+ */
+template<typename Queue>
+Timing Throughput(Size producers, Size consumers)
+{
+    const Size perProducer = kItems / producers;
+    const Size total       = perProducer * producers;
+    const u64 expected     = static_cast<u64>(total) * (total - 1) / 2;
+
+    Timing timing;
+    for (Size r = 0; r < kRepeats; ++r) {
+        Queue queue(kCapacity);
+        std::atomic<Size> remaining{total};
+        std::atomic<u64> sum{0};
+
+        std::vector<std::thread> threads;
+        const auto t0 = Clock::now();
+        for (Size p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                Backoff backoff;
+                for (Size i = p * perProducer, e = i + perProducer; i < e; ++i) {
+                    while (!queue.tryPush(static_cast<u64>(i)))
+                        backoff();
+                }
+            });
+        }
+        for (Size c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                Backoff backoff;
+                u64 local = 0;
+                while (remaining.load(std::memory_order_relaxed) > 0) {
+                    if (auto v = queue.tryPop()) {
+                        local += *v;
+                        remaining.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                    else {
+                        backoff();
+                    }
+                }
+                sum.fetch_add(local, std::memory_order_relaxed);
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+        const auto t1 = Clock::now();
+
+        timing.ms      = std::min(timing.ms, std::chrono::duration<double, std::milli>(t1 - t0).count());
+        timing.correct = timing.correct && sum.load() == expected;
+    }
+    return timing;
+}
+
+struct Message : MPSCNode
+{
+    u64 value = 0;
+};
+
+/**
+ * @brief 侵入式 MPSC 队列: 节点预先分配，入队无需内存分配.
+ */
+Timing IntrusiveThroughput(Size producers)
+{
+    const Size perProducer = kItems / producers;
+    const Size total       = perProducer * producers;
+    const u64 expected     = static_cast<u64>(total) * (total - 1) / 2;
+
+    std::vector<Message> messages(total);
+    for (Size i = 0; i < total; ++i)
+        messages[i].value = i;
+
+    Timing timing;
+    for (Size r = 0; r < kRepeats; ++r) {
+        MPSCQueue<Message> queue;
+        u64 sum = 0;
+
+        std::vector<std::thread> threads;
+        const auto t0 = Clock::now();
+        for (Size p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (Size i = p * perProducer, e = i + perProducer; i < e; ++i)
+                    queue.push(&messages[i]);
+            });
+        }
+
+        Backoff backoff;
+        for (Size n = 0; n < total;) {
+            if (Message* m = queue.tryPop()) {
+                sum += m->value;
+                ++n;
+            }
+            else {
+                backoff();
+            }
+        }
+        for (auto& t : threads)
+            t.join();
+        const auto t1 = Clock::now();
+
+        timing.ms      = std::min(timing.ms, std::chrono::duration<double, std::milli>(t1 - t0).count());
+        timing.correct = timing.correct && sum == expected && queue.empty();
+    }
+    return timing;
+}
+
+/**
+ * @brief 两个线程经由一对队列来回传递一个值，返回单次往返的平均纳秒数.
+ */
+template<typename Queue>
+Timing RoundTrip()
+{
+    Timing timing;
+    for (Size r = 0; r < kRepeats; ++r) {
+        Queue ping(kCapacity);
+        Queue pong(kCapacity);
+
+        std::thread echo([&] {
+            Backoff backoff;
+            for (Size i = 0; i < kPingPong; ++i) {
+                Opt<u64> v;
+                while (!(v = ping.tryPop()))
+                    backoff();
+                while (!pong.tryPush(*v + 1))
+                    backoff();
+            }
+        });
+
+        bool correct = true;
+        Backoff backoff;
+        const auto t0 = Clock::now();
+        for (Size i = 0; i < kPingPong; ++i) {
+            while (!ping.tryPush(static_cast<u64>(i)))
+                backoff();
+            Opt<u64> v;
+            while (!(v = pong.tryPop()))
+                backoff();
+            correct = correct && *v == i + 1;
+        }
+        const auto t1 = Clock::now();
+        echo.join();
+
+        timing.ms      = std::min(timing.ms, std::chrono::duration<double, std::nano>(t1 - t0).count() / kPingPong);
+        timing.correct = timing.correct && correct;
+    }
+    return timing;
+}
+
+int errors = 0;
+
+void Report(const char* name, const Timing& timing, const Timing& baseline)
+{
+    std::printf("%-28s%10.2fms%10.1f Mops/s%9.2fx\n", name, timing.ms, static_cast<double>(kItems) / timing.ms * 1e-3, baseline.ms / timing.ms);
+    errors += !timing.correct;
+}
+
+void ReportLatency(const char* name, const Timing& timing, const Timing& baseline)
+{
+    std::printf("%-28s%10.0fns%20s%9.2fx\n", name, timing.ms, "", baseline.ms / timing.ms);
+    errors += !timing.correct;
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%-28s%12s%17s%10s\n", "throughput", "time", "rate", "vs mutex");
+
+    const Timing spscBase = Throughput<MutexQueue<u64>>(1, 1);
+    Report("1P1C mutex+deque", spscBase, spscBase);
+    Report("1P1C SPSCQueue", Throughput<SPSCQueue<u64>>(1, 1), spscBase);
+    Report("1P1C MPMCQueue", Throughput<MPMCQueue<u64>>(1, 1), spscBase);
+
+    for (Size n : {2, 4}) {
+        char name[64];
+        const Timing base = Throughput<MutexQueue<u64>>(n, n);
+        std::snprintf(name, sizeof(name), "%zuP%zuC mutex+deque", n, n);
+        Report(name, base, base);
+        std::snprintf(name, sizeof(name), "%zuP%zuC MPMCQueue", n, n);
+        Report(name, Throughput<MPMCQueue<u64>>(n, n), base);
+    }
+
+    for (Size n : {1, 4}) {
+        char name[64];
+        const Timing base = Throughput<MutexQueue<u64>>(n, 1);
+        std::snprintf(name, sizeof(name), "%zuP1C mutex+deque", n);
+        Report(name, base, base);
+        std::snprintf(name, sizeof(name), "%zuP1C MPSCQueue (intrusive)", n);
+        Report(name, IntrusiveThroughput(n), base);
+    }
+
+    std::printf("\n%-28s%12s%27s\n", "round trip", "latency", "vs mutex");
+    const Timing latencyBase = RoundTrip<MutexQueue<u64>>();
+    ReportLatency("mutex+deque", latencyBase, latencyBase);
+    ReportLatency("SPSCQueue", RoundTrip<SPSCQueue<u64>>(), latencyBase);
+    ReportLatency("MPMCQueue", RoundTrip<MPMCQueue<u64>>(), latencyBase);
+
+    if (errors)
+        std::printf("%d errors\n", errors);
+    return errors == 0 ? 0 : 1;
+}
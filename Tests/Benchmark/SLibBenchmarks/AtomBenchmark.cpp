@@ -0,0 +1,128 @@
+﻿/**
+ * @File AtomBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <format>
+#include <string>
+#include <unordered_map>
+
+#include <SLib/String/Atom.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+constexpr Size kKeys = 1024;
+
+std::vector<String> MakeKeys()
+{
+    std::vector<String> keys;
+    for (Size i = 0; i < kKeys; ++i) {
+        const auto key = std::format("metrics/requests/latency/p{}", i);
+        keys.emplace_back(StringView(key.data(), key.size()));
+    }
+    return keys;
+}
+
+void BM_HashBytes(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto size = static_cast<Size>(state.range(0));
+    const std::string text(size, 'x');
+    for (auto _ : state)
+        benchmark::DoNotOptimize(HashBytes(text.data(), text.size()));
+    state.SetBytesProcessed(static_cast<i64>(state.iterations() * size));
+}
+
+/// 已驻留字符串的查找: 哈希与一次无锁探测.
+void BM_AtomInternExisting(benchmark::State& state)
+{
+    const auto keys = MakeKeys();
+    for (const auto& key : keys)
+        Atom::Intern(key);
+
+    BenchmarkCounters counters(state, kKeys);
+    for (auto _ : state) {
+        for (const auto& key : keys)
+            benchmark::DoNotOptimize(Atom::Intern(key));
+    }
+}
+
+void BM_StringEquals(benchmark::State& state)
+{
+    const auto keys = MakeKeys();
+    auto copies     = MakeKeys();
+
+    BenchmarkCounters counters(state, kKeys);
+    for (auto _ : state) {
+        Size equal = 0;
+        for (Size i = 0; i < kKeys; ++i)
+            equal += keys[i] == copies[(i * 7) & (kKeys - 1)];
+        benchmark::DoNotOptimize(equal);
+    }
+}
+
+void BM_AtomEquals(benchmark::State& state)
+{
+    std::vector<Atom> keys;
+    for (const auto& key : MakeKeys())
+        keys.push_back(Atom::Intern(key));
+
+    BenchmarkCounters counters(state, kKeys);
+    for (auto _ : state) {
+        Size equal = 0;
+        for (Size i = 0; i < kKeys; ++i)
+            equal += keys[i] == keys[(i * 7) & (kKeys - 1)];
+        benchmark::DoNotOptimize(equal);
+    }
+}
+
+/// 以字符串为键的表与以 Atom 为键的表.
+void BM_StringKeyedLookup(benchmark::State& state)
+{
+    const auto keys = MakeKeys();
+    std::unordered_map<std::string, Size> table;
+    for (Size i = 0; i < kKeys; ++i)
+        table.emplace(std::string(keys[i].data(), keys[i].size()), i);
+
+    BenchmarkCounters counters(state, kKeys);
+    for (auto _ : state) {
+        Size sum = 0;
+        for (const auto& key : keys)
+            sum += table.find(std::string(key.data(), key.size()))->second;
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void BM_AtomKeyedLookup(benchmark::State& state)
+{
+    std::vector<Atom> keys;
+    for (const auto& key : MakeKeys())
+        keys.push_back(Atom::Intern(key));
+    std::unordered_map<Atom, Size> table;
+    for (Size i = 0; i < kKeys; ++i)
+        table.emplace(keys[i], i);
+
+    BenchmarkCounters counters(state, kKeys);
+    for (auto _ : state) {
+        Size sum = 0;
+        for (const auto key : keys)
+            sum += table.find(key)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_HashBytes)->Arg(8)->Arg(32)->Arg(256)->Arg(4096);
+BENCHMARK(BM_AtomInternExisting)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_StringEquals);
+BENCHMARK(BM_AtomEquals);
+BENCHMARK(BM_StringKeyedLookup);
+BENCHMARK(BM_AtomKeyedLookup);
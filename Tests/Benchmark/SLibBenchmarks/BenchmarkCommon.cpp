@@ -0,0 +1,23 @@
+﻿/**
+ * @File BenchmarkCommon.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+
+namespace {
+
+/**
+ * 在输出的 context 中记录硬件计数器是否可用，避免把缺少的计数列误认为回归.
+ */
+const bool sPerfContext = [] {
+    const PerfCounters counters;
+    benchmark::AddCustomContext("perf_counters", counters.available() ? "enabled" : counters.unavailableReason().c_str());
+    return true;
+}();
+
+} // namespace
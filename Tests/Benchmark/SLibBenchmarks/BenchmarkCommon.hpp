@@ -0,0 +1,100 @@
+﻿/**
+ * @File BenchmarkCommon.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SLib/Math/Common.hpp>
+#include <SLib/Profile/PerfCounters.hpp>
+
+namespace slib::bench {
+
+/// 每次迭代处理的输入个数. 足够小以留在 L1 中，测得的是计算而不是访存.
+constexpr Size kBatch = 4096;
+
+/**
+ * @brief 固定种子的均匀分布输入，保证不同构建之间可比.
+ */
+template<typename T>
+std::vector<T> RandomValues(T lo, T hi, Size n = kBatch, u64 seed = 0x5EED)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<T> values(n);
+    if constexpr (std::is_floating_point_v<T>) {
+        std::uniform_real_distribution<T> dist(lo, hi);
+        for (auto& v : values)
+            v = dist(rng);
+    }
+    else {
+        std::uniform_int_distribution<T> dist(lo, hi);
+        for (auto& v : values)
+            v = dist(rng);
+    }
+    return values;
+}
+
+/**
+ * 在基准循环外包一层硬件计数: 析构时把每次迭代 (或每个元素) 的周期、指令、分支预测失败、缓存未命中与 IPC 写入
+ * state.counters. 计数器不可用时不添加任何列，基准照常运行.
+ */
+class BenchmarkCounters
+{
+public:
+    explicit BenchmarkCounters(benchmark::State& state, Size itemsPerIteration = 1) : _state(state), _items(itemsPerIteration)
+    {
+        _counters.start();
+    }
+
+    ~BenchmarkCounters()
+    {
+        const PerfSample sample = _counters.stop();
+        if (!sample.mask)
+            return;
+
+        const auto perItem = [&](PerfEvent event, const char* name) {
+            if (sample.has(event))
+                _state.counters[name] = benchmark::Counter(static_cast<f64>(sample[event]) / static_cast<f64>(_items),
+                                                           benchmark::Counter::kAvgIterations);
+        };
+        perItem(PerfEvent::Cycles, "cycles");
+        perItem(PerfEvent::Instructions, "instructions");
+        perItem(PerfEvent::BranchMisses, "branch-misses");
+        perItem(PerfEvent::CacheMisses, "cache-misses");
+        if (sample.has(PerfEvent::Cycles) && sample.has(PerfEvent::Instructions))
+            _state.counters["IPC"] = benchmark::Counter(sample.ipc(), benchmark::Counter::kAvgThreads);
+    }
+
+    BenchmarkCounters(const BenchmarkCounters&)            = delete;
+    BenchmarkCounters& operator=(const BenchmarkCounters&) = delete;
+
+private:
+    benchmark::State& _state;
+    Size _items;
+    PerfCounters _counters;
+};
+
+/**
+ * @brief 对每个输入调用 op 并累加结果，防止编译器删去计算.
+ */
+template<typename T, typename Op>
+void RunUnary(benchmark::State& state, const std::vector<T>& values, Op op)
+{
+    BenchmarkCounters counters(state, values.size());
+    for (auto _ : state) {
+        auto acc = decltype(op(values[0])){};
+        for (const T& v : values)
+            acc += op(v);
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(static_cast<i64>(state.iterations()) * static_cast<i64>(values.size()));
+}
+
+} // namespace slib::bench
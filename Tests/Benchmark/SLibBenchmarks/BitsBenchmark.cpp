@@ -0,0 +1,95 @@
+﻿/**
+ * @File BitsBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <bit>
+
+#include <SLib/Math/Bits.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+const auto kU32 = RandomValues<u32>(1, ~u32(0));
+const auto kU64 = RandomValues<u64>(1, ~u64(0));
+
+void BM_CountLeadingZeros32(benchmark::State& state)
+{
+    RunUnary(state, kU32, [](u32 v) { return CountLeadingZeros(v); });
+}
+
+void BM_CountLeadingZeros64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return CountLeadingZeros(v); });
+}
+
+void BM_StdCountLZero64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return std::countl_zero(v); });
+}
+
+void BM_CountTrailingZeros64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return CountTrailingZeros(v); });
+}
+
+void BM_Popcount64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return Popcount(v); });
+}
+
+void BM_FloorLog2_64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return FloorLog2(v); });
+}
+
+void BM_NextPowerOfTwo32(benchmark::State& state)
+{
+    RunUnary(state, kU32, [](u32 v) { return NextPowerOfTwo(v >> 1); });
+}
+
+void BM_ReverseBits32(benchmark::State& state)
+{
+    RunUnary(state, kU32, [](u32 v) { return ReverseBits(v); });
+}
+
+void BM_ReverseBits64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return ReverseBits(v); });
+}
+
+void BM_BitSwap64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return BitSwap(v); });
+}
+
+void BM_RotateLeft64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return RotateLeft(v, static_cast<int>(v & 63)); });
+}
+
+void BM_MulHi64(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return MulHi64(v, 0x9E37'79B9'7F4A'7C15ULL); });
+}
+
+} // namespace
+
+BENCHMARK(BM_CountLeadingZeros32);
+BENCHMARK(BM_CountLeadingZeros64);
+BENCHMARK(BM_StdCountLZero64);
+BENCHMARK(BM_CountTrailingZeros64);
+BENCHMARK(BM_Popcount64);
+BENCHMARK(BM_FloorLog2_64);
+BENCHMARK(BM_NextPowerOfTwo32);
+BENCHMARK(BM_ReverseBits32);
+BENCHMARK(BM_ReverseBits64);
+BENCHMARK(BM_BitSwap64);
+BENCHMARK(BM_RotateLeft64);
+BENCHMARK(BM_MulHi64);
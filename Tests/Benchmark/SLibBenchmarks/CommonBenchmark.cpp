@@ -0,0 +1,88 @@
+﻿/**
+ * @File CommonBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <cmath>
+
+#include <SLib/Math/Common.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+const auto kPositive   = RandomValues<f32>(1e-3f, 1e4f);
+const auto kSigned     = RandomValues<f32>(-1e3f, 1e3f);
+const auto kPositive64 = RandomValues<f64>(1e-3, 1e4);
+
+// ================== 近似函数与标准库的对照
+
+void BM_ApproxSqrt(benchmark::State& state)
+{
+    RunUnary(state, kPositive, [](f32 v) { return ApproxSqrt(v); });
+}
+
+void BM_StdSqrt(benchmark::State& state)
+{
+    RunUnary(state, kPositive, [](f32 v) { return std::sqrt(v); });
+}
+
+void BM_ApproxCbrt(benchmark::State& state)
+{
+    RunUnary(state, kPositive, [](f32 v) { return ApproxCbrt(v); });
+}
+
+void BM_StdCbrt(benchmark::State& state)
+{
+    RunUnary(state, kPositive, [](f32 v) { return std::cbrt(v); });
+}
+
+void BM_RecipSqrtFast32(benchmark::State& state)
+{
+    RunUnary(state, kPositive, [](f32 v) { return RecipSqrtFast(v); });
+}
+
+void BM_RecipSqrtFast64(benchmark::State& state)
+{
+    RunUnary(state, kPositive64, [](f64 v) { return RecipSqrtFast(v); });
+}
+
+void BM_StdRecipSqrt32(benchmark::State& state)
+{
+    RunUnary(state, kPositive, [](f32 v) { return 1.0f / std::sqrt(v); });
+}
+
+// ================== 比较与基本运算
+
+void BM_Approx(benchmark::State& state)
+{
+    RunUnary(state, kSigned, [](f32 v) { return static_cast<int>(Approx(v, 1.0f)); });
+}
+
+void BM_MinMaxAbs(benchmark::State& state)
+{
+    RunUnary(state, kSigned, [](f32 v) { return Max(Min(Abs(v), 100.0f), 1.0f); });
+}
+
+void BM_FMA(benchmark::State& state)
+{
+    RunUnary(state, kSigned, [](f32 v) { return FMA(v, 1.5f, 0.25f); });
+}
+
+} // namespace
+
+BENCHMARK(BM_ApproxSqrt);
+BENCHMARK(BM_StdSqrt);
+BENCHMARK(BM_ApproxCbrt);
+BENCHMARK(BM_StdCbrt);
+BENCHMARK(BM_RecipSqrtFast32);
+BENCHMARK(BM_RecipSqrtFast64);
+BENCHMARK(BM_StdRecipSqrt32);
+BENCHMARK(BM_Approx);
+BENCHMARK(BM_MinMaxAbs);
+BENCHMARK(BM_FMA);
@@ -0,0 +1,180 @@
+﻿/**
+ * @File ErrorBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <format>
+#include <stacktrace>
+#include <stdexcept>
+
+#include <SLib/Error.hpp>
+#include <SLib/Utility/Utility.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+// 失败路径放在不可内联的函数里，避免编译器看穿 throw/catch
+SLIB_NO_INLINE int Fail(int value, int mode)
+{
+    if (mode == 1)
+        SLIB_THROW("value {} rejected", value);
+    if (mode == 2)
+        throw std::runtime_error("value rejected");
+    return value;
+}
+
+/// 抛出时立即符号化并格式化调用栈 (ThrowException 以前的做法)，作为对照.
+SLIB_NO_INLINE int FailEager(int value)
+{
+    auto message = std::format("value {} rejected", value);
+    message += std::format("\n\nStacktrace:\n{}", std::stacktrace::current(1));
+    throw RuntimeError(message);
+}
+
+SLIB_NO_INLINE Result<int> FailResult(int value, bool fail)
+{
+    SLIB_CHECK_RESULT(!fail, FailureType::InvalidArgument, "value {} rejected", value);
+    return value;
+}
+
+/// 只返回错误码，不附加说明，不分配内存.
+SLIB_NO_INLINE Result<int> FailCode(int value, bool fail)
+{
+    SLIB_CHECK_RESULT(!fail, FailureType::InvalidArgument);
+    return value;
+}
+
+SLIB_NO_INLINE Result<int> Propagate(int value)
+{
+    SLIB_TRY_ASSIGN(const int v, FailCode(value, true));
+    return v;
+}
+
+void BM_NoThrow(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(Fail(i++, 0));
+        }
+        catch (...) {
+        }
+    }
+}
+
+void BM_EagerStacktraceThrow(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(FailEager(i++));
+        }
+        catch (const RuntimeError& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+}
+
+/// SLIB_THROW 的抛出成本: 格式化消息、记录帧地址并抛出 RuntimeError，不符号化.
+void BM_SlibThrow(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(Fail(i++, 1));
+        }
+        catch (const RuntimeError& e) {
+            benchmark::DoNotOptimize(e.message());
+        }
+    }
+}
+
+/// 抛出后读取 what()，调用栈在此时符号化; 帧地址的符号已被缓存.
+void BM_SlibThrowWhat(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(Fail(i++, 1));
+        }
+        catch (const RuntimeError& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+}
+
+void BM_StdThrow(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(Fail(i++, 2));
+        }
+        catch (const std::runtime_error& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+}
+
+void BM_ResultFailure(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        auto result = FailResult(i++, true);
+        benchmark::DoNotOptimize(result.has_value());
+    }
+}
+
+void BM_ResultFailureCode(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        auto result = FailCode(i++, true);
+        benchmark::DoNotOptimize(result.has_value());
+    }
+}
+
+void BM_ResultPropagate(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        auto result = Propagate(i++);
+        benchmark::DoNotOptimize(result.has_value());
+    }
+}
+
+void BM_ResultSuccess(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    int i = 0;
+    for (auto _ : state) {
+        auto result = FailResult(i++, false);
+        benchmark::DoNotOptimize(result.has_value());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_NoThrow);
+BENCHMARK(BM_EagerStacktraceThrow);
+BENCHMARK(BM_SlibThrow);
+BENCHMARK(BM_SlibThrowWhat);
+BENCHMARK(BM_StdThrow);
+BENCHMARK(BM_ResultFailure);
+BENCHMARK(BM_ResultFailureCode);
+BENCHMARK(BM_ResultPropagate);
+BENCHMARK(BM_ResultSuccess);
@@ -0,0 +1,53 @@
+﻿/**
+ * @File HashBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <SLib/Math/Hash.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+const auto kU64 = RandomValues<u64>(0, ~u64(0));
+const auto kF32 = RandomValues<f32>(-1e3f, 1e3f);
+
+void BM_HashCombineU64(benchmark::State& state)
+{
+    BenchmarkCounters counters(state, kU64.size());
+    for (auto _ : state) {
+        size_t seed = 0;
+        for (u64 v : kU64)
+            HashCombine(seed, v);
+        benchmark::DoNotOptimize(seed);
+    }
+    state.SetItemsProcessed(static_cast<i64>(state.iterations()) * static_cast<i64>(kU64.size()));
+}
+
+void BM_HashCombineF32(benchmark::State& state)
+{
+    BenchmarkCounters counters(state, kF32.size());
+    for (auto _ : state) {
+        size_t seed = 0;
+        for (f32 v : kF32)
+            HashCombine(seed, v);
+        benchmark::DoNotOptimize(seed);
+    }
+    state.SetItemsProcessed(static_cast<i64>(state.iterations()) * static_cast<i64>(kF32.size()));
+}
+
+void BM_MixBits(benchmark::State& state)
+{
+    RunUnary(state, kU64, [](u64 v) { return MixBits(v); });
+}
+
+} // namespace
+
+BENCHMARK(BM_HashCombineU64);
+BENCHMARK(BM_HashCombineF32);
+BENCHMARK(BM_MixBits);
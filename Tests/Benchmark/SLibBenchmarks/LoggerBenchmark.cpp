@@ -0,0 +1,74 @@
+﻿/**
+ * @File LoggerBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <iostream>
+#include <streambuf>
+
+#include <SLib/Logger.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+/**
+ * 丢弃所有输出的流缓冲，测得的是 Logger 自身 (格式化、计数、输出锁) 的开销而不是终端.
+ */
+class NullBuffer : public std::streambuf
+{
+protected:
+    int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+NullBuffer sNullBuffer;
+std::streambuf* sSavedBuffer = nullptr;
+
+void RedirectOutput(const benchmark::State&)
+{
+    sSavedBuffer = std::cout.rdbuf(&sNullBuffer);
+    Logger::Get().setLevel(Logger::Level::Info);
+}
+
+void RestoreOutput(const benchmark::State&)
+{
+    std::cout.rdbuf(sSavedBuffer);
+}
+
+void BM_LogFiltered(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    for (auto _ : state)
+        LogTrace("filtered message");
+    state.SetItemsProcessed(static_cast<i64>(state.iterations()));
+}
+
+void BM_LogEmitted(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    for (auto _ : state)
+        LogInfo("emitted message");
+    state.SetItemsProcessed(static_cast<i64>(state.iterations()));
+}
+
+void BM_LogFormatted(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    i64 i = 0;
+    for (auto _ : state)
+        LogInfo("thread {} message {}", state.thread_index(), i++);
+    state.SetItemsProcessed(static_cast<i64>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_LogFiltered)->Setup(RedirectOutput)->Teardown(RestoreOutput)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LogEmitted)->Setup(RedirectOutput)->Teardown(RestoreOutput)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LogFormatted)->Setup(RedirectOutput)->Teardown(RestoreOutput)->ThreadRange(1, 8)->UseRealTime();
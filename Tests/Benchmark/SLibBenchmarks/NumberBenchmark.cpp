@@ -0,0 +1,229 @@
+﻿/**
+ * @File NumberBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <charconv>
+#include <format>
+#include <string>
+
+#include <SLib/String/Number.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+/**
+ * @brief 把 values 格式化为以 '\n' 分隔的文本，作为解析的输入.
+ */
+template<typename T>
+std::string NumberText(const std::vector<T>& values)
+{
+    std::string text;
+    char buffer[64];
+    for (const T v : values) {
+        text.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), v).ptr);
+        text += '\n';
+    }
+    return text;
+}
+
+/// 配置文件里常见的小整数与任意 64 位整数.
+const std::vector<i64>& Integers(bool small)
+{
+    static const auto smallValues = RandomValues<i64>(-10000, 10000);
+    static const auto largeValues = RandomValues<i64>(numeric_limits<i64>::min(), numeric_limits<i64>::max());
+    return small ? smallValues : largeValues;
+}
+
+/// 最短表示通常为 15 ~ 17 位有效数字的浮点数.
+const std::vector<f64>& Doubles()
+{
+    static const auto values = RandomValues<f64>(-1e6, 1e6);
+    return values;
+}
+
+template<typename T>
+void SetItems(benchmark::State& state, const std::vector<T>& values)
+{
+    state.SetItemsProcessed(static_cast<i64>(state.iterations() * values.size()));
+}
+
+// ==================
+// 整数
+// ==================
+
+void BM_IntToCharsStd(benchmark::State& state)
+{
+    const auto& values = Integers(state.range(0) == 0);
+    BenchmarkCounters counters(state, values.size());
+    char buffer[kMaxNumberLength];
+    for (auto _ : state) {
+        for (const i64 v : values) {
+            benchmark::DoNotOptimize(std::to_chars(buffer, buffer + sizeof(buffer), v).ptr);
+            benchmark::ClobberMemory();
+        }
+    }
+    SetItems(state, values);
+}
+
+void BM_IntFormatNumber(benchmark::State& state)
+{
+    const auto& values = Integers(state.range(0) == 0);
+    BenchmarkCounters counters(state, values.size());
+    char buffer[kMaxNumberLength];
+    for (auto _ : state) {
+        for (const i64 v : values) {
+            benchmark::DoNotOptimize(FormatNumber(buffer, v));
+            benchmark::ClobberMemory();
+        }
+    }
+    SetItems(state, values);
+}
+
+void BM_IntStdFormat(benchmark::State& state)
+{
+    const auto& values = Integers(state.range(0) == 0);
+    BenchmarkCounters counters(state, values.size());
+    char buffer[kMaxNumberLength];
+    for (auto _ : state) {
+        for (const i64 v : values) {
+            benchmark::DoNotOptimize(std::format_to(buffer, "{}", v));
+            benchmark::ClobberMemory();
+        }
+    }
+    SetItems(state, values);
+}
+
+void BM_IntFromCharsStd(benchmark::State& state)
+{
+    const auto& values = Integers(state.range(0) == 0);
+    const auto text    = NumberText(values);
+    BenchmarkCounters counters(state, values.size());
+    for (auto _ : state) {
+        i64 sum = 0;
+        for (const char *p = text.data(), *end = p + text.size(); p < end; ++p) {
+            i64 v = 0;
+            p     = std::from_chars(p, end, v).ptr;
+            sum  += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetItems(state, values);
+}
+
+void BM_IntParseNumber(benchmark::State& state)
+{
+    const auto& values = Integers(state.range(0) == 0);
+    const auto text    = NumberText(values);
+    BenchmarkCounters counters(state, values.size());
+    for (auto _ : state) {
+        i64 sum = 0;
+        for (Size i = 0; i < text.size(); ++i) {
+            const auto parsed = ParseNumberPrefix<i64>(StringView(text.data() + i, text.size() - i));
+            sum              += parsed->value;
+            i                += parsed->length;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetItems(state, values);
+}
+
+// ==================
+// 浮点数
+// ==================
+
+void BM_DoubleToCharsStd(benchmark::State& state)
+{
+    const auto& values = Doubles();
+    BenchmarkCounters counters(state, values.size());
+    char buffer[kMaxNumberLength];
+    for (auto _ : state) {
+        for (const f64 v : values) {
+            benchmark::DoNotOptimize(std::to_chars(buffer, buffer + sizeof(buffer), v).ptr);
+            benchmark::ClobberMemory();
+        }
+    }
+    SetItems(state, values);
+}
+
+void BM_DoubleFormatNumber(benchmark::State& state)
+{
+    const auto& values = Doubles();
+    BenchmarkCounters counters(state, values.size());
+    char buffer[kMaxNumberLength];
+    for (auto _ : state) {
+        for (const f64 v : values) {
+            benchmark::DoNotOptimize(FormatNumber(buffer, v));
+            benchmark::ClobberMemory();
+        }
+    }
+    SetItems(state, values);
+}
+
+void BM_DoubleStdFormat(benchmark::State& state)
+{
+    const auto& values = Doubles();
+    BenchmarkCounters counters(state, values.size());
+    char buffer[kMaxNumberLength];
+    for (auto _ : state) {
+        for (const f64 v : values) {
+            benchmark::DoNotOptimize(std::format_to(buffer, "{}", v));
+            benchmark::ClobberMemory();
+        }
+    }
+    SetItems(state, values);
+}
+
+void BM_DoubleFromCharsStd(benchmark::State& state)
+{
+    const auto& values = Doubles();
+    const auto text    = NumberText(values);
+    BenchmarkCounters counters(state, values.size());
+    for (auto _ : state) {
+        f64 sum = 0;
+        for (const char *p = text.data(), *end = p + text.size(); p < end; ++p) {
+            f64 v = 0;
+            p     = std::from_chars(p, end, v).ptr;
+            sum  += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetItems(state, values);
+}
+
+void BM_DoubleParseNumber(benchmark::State& state)
+{
+    const auto& values = Doubles();
+    const auto text    = NumberText(values);
+    BenchmarkCounters counters(state, values.size());
+    for (auto _ : state) {
+        f64 sum = 0;
+        for (Size i = 0; i < text.size(); ++i) {
+            const auto parsed = ParseNumberPrefix<f64>(StringView(text.data() + i, text.size() - i));
+            sum              += parsed->value;
+            i                += parsed->length;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetItems(state, values);
+}
+
+} // namespace
+
+// 参数 0 为小整数，1 为任意 64 位整数
+BENCHMARK(BM_IntToCharsStd)->Arg(0)->Arg(1);
+BENCHMARK(BM_IntFormatNumber)->Arg(0)->Arg(1);
+BENCHMARK(BM_IntStdFormat)->Arg(0)->Arg(1);
+BENCHMARK(BM_IntFromCharsStd)->Arg(0)->Arg(1);
+BENCHMARK(BM_IntParseNumber)->Arg(0)->Arg(1);
+BENCHMARK(BM_DoubleToCharsStd);
+BENCHMARK(BM_DoubleFormatNumber);
+BENCHMARK(BM_DoubleStdFormat);
+BENCHMARK(BM_DoubleFromCharsStd);
+BENCHMARK(BM_DoubleParseNumber);
@@ -0,0 +1,48 @@
+﻿/**
+ * @File PolynomialBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <cmath>
+
+#include <SLib/Math/Polynomial.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+const auto kUnit   = RandomValues<f32>(-1.0f, 1.0f);
+const auto kUnit64 = RandomValues<f64>(-1.0, 1.0);
+
+void BM_EvaluatePolynomial3(benchmark::State& state)
+{
+    RunUnary(state, kUnit, [](f32 t) { return EvaluatePolynomial(t, 1.0f, 0.5f, 0.25f); });
+}
+
+void BM_EvaluatePolynomial6(benchmark::State& state)
+{
+    RunUnary(state, kUnit, [](f32 t) { return EvaluatePolynomial(t, 1.0f, -1.0f / 6, 1.0f / 120, -1.0f / 5040, 1.0f / 362880, -1.0f / 39916800); });
+}
+
+void BM_EvaluatePolynomial6_64(benchmark::State& state)
+{
+    RunUnary(state, kUnit64, [](f64 t) { return EvaluatePolynomial(t, 1.0, -1.0 / 6, 1.0 / 120, -1.0 / 5040, 1.0 / 362880, -1.0 / 39916800); });
+}
+
+// 与 Sampling 中 sin(x)/x 的多项式对照
+void BM_StdSin(benchmark::State& state)
+{
+    RunUnary(state, kUnit, [](f32 t) { return std::sin(t); });
+}
+
+} // namespace
+
+BENCHMARK(BM_EvaluatePolynomial3);
+BENCHMARK(BM_EvaluatePolynomial6);
+BENCHMARK(BM_EvaluatePolynomial6_64);
+BENCHMARK(BM_StdSin);
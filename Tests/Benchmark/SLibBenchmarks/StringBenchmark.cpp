@@ -0,0 +1,67 @@
+﻿/**
+ * @File StringBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <format>
+#include <string>
+
+#include <SLib/String/StringBuilder.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+constexpr const char kText[] = "worker-thread/queue";
+
+/// 以前的做法: std::format 生成 std::string，再复制为 String.
+void BM_StdFormatToString(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const StringView name(kText, 6);
+    int i = 0;
+    for (auto _ : state) {
+        const auto s = std::format("[{}] task {} took {:.2f}ms", std::string_view(name.data(), name.size()), i++, 1.25);
+        String result(StringView(s.data(), s.size()));
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+
+/// 写入栈上缓冲，不产生中间字符串.
+void BM_StringBuilderFormat(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const StringView name(kText, 6);
+    int i = 0;
+    for (auto _ : state) {
+        StringBuilder builder;
+        builder.format("[{}] task {} took {:.2f}ms", name, i++, 1.25);
+        benchmark::DoNotOptimize(builder.data());
+    }
+}
+
+/// 超出对象内缓冲后 release() 移出堆存储.
+void BM_StringBuilderRelease(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto count = static_cast<Size>(state.range(0));
+    for (auto _ : state) {
+        StringBuilder builder;
+        for (Size i = 0; i < count; ++i)
+            builder.append(StringView(kText, sizeof(kText) - 1)).append(',');
+        String result = builder.release();
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(static_cast<i64>(state.iterations() * count * sizeof(kText)));
+}
+
+} // namespace
+
+BENCHMARK(BM_StdFormatToString);
+BENCHMARK(BM_StringBuilderFormat);
+BENCHMARK(BM_StringBuilderRelease)->Arg(8)->Arg(256);
@@ -0,0 +1,243 @@
+﻿/**
+ * @File TextBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <array>
+#include <format>
+#include <string>
+
+#include <SLib/String/Text.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+using namespace slib;
+using namespace slib::bench;
+
+namespace {
+
+/// 输入大小. 留在 L2 中，测得的是扫描本身而不是内存带宽.
+constexpr Size kTextBytes = 256 * 1024;
+
+/**
+ * @brief 类似日志的文本: 每行一个时间戳、级别与若干个由空格分隔的字段.
+ */
+const std::string& LogText()
+{
+    static const std::string text = [] {
+        constexpr std::array kLevels = {"INFO", "WARN", "DEBUG", "ERROR"};
+        constexpr std::array kWords  = {"request", "served", "cache", "miss", "user=42", "latency_ms=17", "path=/api/v1/items", "ok"};
+
+        std::mt19937_64 rng(0x5EED);
+        std::string out;
+        while (out.size() < kTextBytes) {
+            out += std::format("2026-10-19T12:{:02}:{:02} {} ", rng() % 60, rng() % 60, kLevels[rng() % kLevels.size()]);
+            for (Size w = 0, n = 3 + rng() % 6; w < n; ++w) {
+                out += kWords[rng() % kWords.size()];
+                out += ' ';
+            }
+            out += '\n';
+        }
+        out.resize(kTextBytes);
+        return out;
+    }();
+    return text;
+}
+
+StringView LogView()
+{
+    return StringView(LogText().data(), LogText().size());
+}
+
+void SetBytes(benchmark::State& state, Size bytes)
+{
+    state.SetBytesProcessed(static_cast<i64>(state.iterations() * bytes));
+}
+
+// ==================
+// 切分
+// ==================
+
+/// 以前解析器的做法: 逐字节寻找换行.
+void BM_SplitLinesByteLoop(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    for (auto _ : state) {
+        Size lines = 0;
+        Size begin = 0;
+        for (Size i = 0; i < text.size(); ++i) {
+            if (text[i] == '\n') {
+                lines += i > begin;
+                begin  = i + 1;
+            }
+        }
+        benchmark::DoNotOptimize(lines);
+    }
+    SetBytes(state, kTextBytes);
+}
+
+void BM_SplitLines(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    for (auto _ : state) {
+        Size lines = 0;
+        for (const auto line : Split(text, '\n'))
+            lines += !line.empty();
+        benchmark::DoNotOptimize(lines);
+    }
+    SetBytes(state, kTextBytes);
+}
+
+void BM_TokenizeByteLoop(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    for (auto _ : state) {
+        Size tokens = 0;
+        for (Size i = 0; i < text.size();) {
+            while (i < text.size() && IsAsciiSpace(text[i]))
+                ++i;
+            const Size begin = i;
+            while (i < text.size() && !IsAsciiSpace(text[i]))
+                ++i;
+            tokens += i > begin;
+        }
+        benchmark::DoNotOptimize(tokens);
+    }
+    SetBytes(state, kTextBytes);
+}
+
+void BM_Tokenize(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    for (auto _ : state) {
+        Size tokens = 0;
+        for (const auto token : Tokenize(text))
+            tokens += token.size() != 0;
+        benchmark::DoNotOptimize(tokens);
+    }
+    SetBytes(state, kTextBytes);
+}
+
+// ==================
+// 分类
+// ==================
+
+void BM_CountOf(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    const CharSet set("=/_");
+    for (auto _ : state)
+        benchmark::DoNotOptimize(CountOf(text, set));
+    SetBytes(state, kTextBytes);
+}
+
+/// 整段文本中找不到的字节，测得的是 FindFirstOf 的峰值吞吐.
+void BM_FindFirstOfMiss(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    const CharSet set("\"{}");
+    for (auto _ : state)
+        benchmark::DoNotOptimize(FindFirstOf(text, set));
+    SetBytes(state, kTextBytes);
+}
+
+void BM_IsAscii(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(IsAscii(text));
+    SetBytes(state, kTextBytes);
+}
+
+void BM_TrimLines(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    for (auto _ : state) {
+        Size bytes = 0;
+        for (const auto line : Split(text, '\n'))
+            bytes += Trim(line).size();
+        benchmark::DoNotOptimize(bytes);
+    }
+    SetBytes(state, kTextBytes);
+}
+
+void BM_EqualsIgnoreAsciiCase(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    std::string upper(text.size(), '\0');
+    ToAsciiUpper(text, upper.data());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(EqualsIgnoreAsciiCase(text, StringView(upper.data(), upper.size())));
+    SetBytes(state, kTextBytes);
+}
+
+void BM_ToAsciiLower(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    std::string lower(text.size(), '\0');
+    for (auto _ : state) {
+        ToAsciiLower(text, lower.data());
+        benchmark::DoNotOptimize(lower.data());
+    }
+    SetBytes(state, kTextBytes);
+}
+
+// ==================
+// 多模式查找
+// ==================
+
+constexpr std::array<StringView, 4> kNeedles = {StringView("ERROR", 5), StringView("WARN", 4), StringView("miss", 4), StringView("timeout", 7)};
+
+/// 对照: 每个模式串各扫描一遍.
+void BM_MultiFindNaive(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const std::string_view text(LogText());
+    for (auto _ : state) {
+        Size matches = 0;
+        for (const auto needle : kNeedles) {
+            const std::string_view n(needle.data(), needle.size());
+            for (Size pos = text.find(n); pos != std::string_view::npos; pos = text.find(n, pos + n.size()))
+                ++matches;
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+    SetBytes(state, kTextBytes);
+}
+
+void BM_MultiFinder(benchmark::State& state)
+{
+    BenchmarkCounters counters(state);
+    const auto text = LogView();
+    const MultiFinder finder(kNeedles);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(finder.count(text));
+    SetBytes(state, kTextBytes);
+}
+
+} // namespace
+
+BENCHMARK(BM_SplitLinesByteLoop);
+BENCHMARK(BM_SplitLines);
+BENCHMARK(BM_TokenizeByteLoop);
+BENCHMARK(BM_Tokenize);
+BENCHMARK(BM_CountOf);
+BENCHMARK(BM_FindFirstOfMiss);
+BENCHMARK(BM_IsAscii);
+BENCHMARK(BM_TrimLines);
+BENCHMARK(BM_EqualsIgnoreAsciiCase);
+BENCHMARK(BM_ToAsciiLower);
+BENCHMARK(BM_MultiFindNaive);
+BENCHMARK(BM_MultiFinder);
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Compare two Google Benchmark JSON outputs (--benchmark_out_format=json).
+
+    CompareBenchmarks.py baseline.json contender.json [--threshold 0.05] [--filter REGEX]
+
+For every benchmark present in both files the median time is compared. When a file
+contains repetitions, the "median" aggregate is used if present, otherwise the median
+of the individual runs. Exits with status 1 if any benchmark is slower than the
+baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import re
+import statistics
+import sys
+
+
+def load(path, time_field):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+
+    runs = {}
+    medians = {}
+    for bench in data.get("benchmarks", []):
+        name = bench.get("run_name", bench["name"])
+        if bench.get("error_occurred"):
+            continue
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[name] = bench[time_field]
+            continue
+        runs.setdefault(name, []).append(bench[time_field])
+
+    result = {name: statistics.median(values) for name, values in runs.items()}
+    result.update(medians)
+    unit = next((b.get("time_unit", "ns") for b in data.get("benchmarks", [])), "ns")
+    return result, unit
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two Google Benchmark JSON files.")
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=0.05, help="relative slowdown reported as regression (default 0.05)")
+    parser.add_argument("--filter", default=None, help="only compare benchmarks whose name matches this regex")
+    parser.add_argument("--cpu-time", action="store_true", help="compare cpu_time instead of real_time")
+    args = parser.parse_args()
+
+    field = "cpu_time" if args.cpu_time else "real_time"
+    baseline, unit = load(args.baseline, field)
+    contender, _ = load(args.contender, field)
+
+    pattern = re.compile(args.filter) if args.filter else None
+    names = [n for n in baseline if n in contender and (pattern is None or pattern.search(n))]
+    if not names:
+        print("no common benchmarks to compare")
+        return 1
+
+    width = max(len(n) for n in names)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Contender':>12}  {'Change':>8}")
+    print("-" * (width + 40))
+
+    regressions = []
+    for name in names:
+        old, new = baseline[name], contender[name]
+        change = (new - old) / old if old > 0 else 0.0
+        mark = ""
+        if change > args.threshold:
+            mark = "  SLOWER"
+            regressions.append(name)
+        elif change < -args.threshold:
+            mark = "  faster"
+        print(f"{name:<{width}}  {old:>10.2f}{unit:<2}  {new:>10.2f}{unit:<2}  {change:>+7.1%}{mark}")
+
+    only = sorted(set(baseline) ^ set(contender))
+    if only:
+        print(f"\n{len(only)} benchmark(s) present in only one file: {', '.join(only)}")
+
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) over {args.threshold:.0%}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Performance regression gate for SLibBenchmarks.
+
+    PerfCheck.py --benchmark <SLibBenchmarks> --baseline <baseline.json> [--filter REGEX] [--update]
+
+Runs the benchmark binary pinned to one CPU with interleaved repetitions and compares every
+benchmark against the stored samples in the baseline:
+
+  * Mann-Whitney U test (one-sided: is the new run slower?), normal approximation with tie
+    correction. Robust to the outliers that make mean-based comparisons flaky.
+  * Bootstrap confidence interval for the ratio of medians (new / baseline).
+
+A benchmark counts as a regression when the test is significant at --alpha, the confidence
+interval lies entirely above 1 and the median ratio exceeds 1 + --threshold. With --update the
+run replaces the baseline instead. Exit status: 0 pass, 1 regression, 77 no baseline (skipped).
+"""
+
+import argparse
+import json
+import math
+import os
+import random
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+
+SKIP = 77
+
+
+# ==================
+# Statistics
+# ==================
+
+def normal_sf(z):
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def mann_whitney_greater(x, y):
+    """One-sided p-value for H1: samples x tend to be larger than samples y."""
+    n1, n2 = len(x), len(y)
+    pooled = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+
+    # 平均秩处理并列值，同时累计并列修正项
+    ranks = [0.0] * len(pooled)
+    ties = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        rank = (i + j) / 2.0 + 1.0
+        for k in range(i, j + 1):
+            ranks[k] = rank
+        t = j - i + 1
+        ties += t ** 3 - t
+        i = j + 1
+
+    r1 = sum(r for r, (_, group) in zip(ranks, pooled) if group == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    mean = n1 * n2 / 2.0
+    var = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if var <= 0:
+        return 1.0
+    z = (u1 - mean - 0.5) / math.sqrt(var)
+    return normal_sf(z)
+
+
+def bootstrap_ratio_ci(new, old, confidence, resamples=2000, seed=0x5EED):
+    """Percentile bootstrap CI for median(new) / median(old)."""
+    rng = random.Random(seed)
+    ratios = []
+    for _ in range(resamples):
+        a = statistics.median(rng.choices(new, k=len(new)))
+        b = statistics.median(rng.choices(old, k=len(old)))
+        ratios.append(a / b if b > 0 else 1.0)
+    ratios.sort()
+    lo = ratios[int((1.0 - confidence) / 2.0 * resamples)]
+    hi = ratios[min(resamples - 1, int((1.0 + confidence) / 2.0 * resamples))]
+    return lo, hi
+
+
+# ==================
+# Benchmark runs
+# ==================
+
+def pin_cpu(cpu):
+    if not hasattr(os, "sched_setaffinity"):
+        return None
+    available = sorted(os.sched_getaffinity(0))
+    if cpu is None:
+        cpu = available[-1]  # 最后一个核心通常不处理系统中断
+    if cpu not in available:
+        return None
+    os.sched_setaffinity(0, {cpu})  # 子进程继承亲和性
+    return cpu
+
+
+def run_benchmarks(binary, pattern, repetitions, min_time):
+    with tempfile.TemporaryDirectory() as tmp:
+        out = os.path.join(tmp, "run.json")
+        command = [
+            binary,
+            f"--benchmark_filter={pattern}",
+            f"--benchmark_repetitions={repetitions}",
+            f"--benchmark_min_time={min_time}",
+            "--benchmark_enable_random_interleaving=true",
+            f"--benchmark_out={out}",
+            "--benchmark_out_format=json",
+        ]
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+        with open(out, encoding="utf-8") as f:
+            data = json.load(f)
+
+    samples = {}
+    unit = "ns"
+    for bench in data.get("benchmarks", []):
+        if bench.get("run_type") == "aggregate" or bench.get("error_occurred"):
+            continue
+        samples.setdefault(bench.get("run_name", bench["name"]), []).append(round(bench["real_time"], 3))
+        unit = bench.get("time_unit", unit)
+
+    context = data.get("context", {})
+    keep = ("host_name", "num_cpus", "mhz_per_cpu", "library_build_type")
+    return {
+        "context": {k: context[k] for k in keep if k in context},
+        "time_unit": unit,
+        "benchmarks": samples,
+    }
+
+
+def write_baseline(path, run):
+    # 每个基准的样本占一行，便于审阅基线的 diff
+    lines = [f"    {json.dumps(name)}: {json.dumps(values)}" for name, values in sorted(run["benchmarks"].items())]
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("{\n")
+        f.write(f'  "context": {json.dumps(run["context"])},\n')
+        f.write(f'  "time_unit": {json.dumps(run["time_unit"])},\n')
+        f.write('  "benchmarks": {\n' + ",\n".join(lines) + "\n  }\n}\n")
+
+
+# ==================
+# Report
+# ==================
+
+def compare(baseline, current, args):
+    names = sorted(n for n in current["benchmarks"] if n in baseline["benchmarks"])
+    missing = sorted(n for n in current["benchmarks"] if n not in baseline["benchmarks"])
+    unit = current["time_unit"]
+
+    rows, regressions = [], []
+    for name in names:
+        old = baseline["benchmarks"][name]
+        new = current["benchmarks"][name]
+        ratio = statistics.median(new) / statistics.median(old)
+        p = mann_whitney_greater(new, old)
+        lo, hi = bootstrap_ratio_ci(new, old, args.confidence)
+        regressed = p < args.alpha and lo > 1.0 and ratio > 1.0 + args.threshold
+        if regressed:
+            regressions.append(name)
+        rows.append((name, statistics.median(old), statistics.median(new), ratio, lo, hi, p, regressed))
+
+    width = max([len(r[0]) for r in rows] + [9])
+    ci = f"{args.confidence:.0%} CI"
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}  {ci:>17}  {'p':>7}")
+    print("-" * (width + 68))
+    for name, old, new, ratio, lo, hi, p, regressed in rows:
+        mark = "  REGRESSION" if regressed else ""
+        print(f"{name:<{width}}  {old:>10.2f}{unit:<2}  {new:>10.2f}{unit:<2}  {ratio - 1:>+7.1%}  "
+              f"[{lo - 1:>+6.1%}, {hi - 1:>+6.1%}]  {p:>7.4f}{mark}")
+
+    if missing:
+        print(f"\nNo baseline for {len(missing)} benchmark(s): {', '.join(missing)}")
+
+    base_ctx, cur_ctx = baseline.get("context", {}), current["context"]
+    if base_ctx.get("host_name") != cur_ctx.get("host_name"):
+        print(f"\nNote: baseline was recorded on '{base_ctx.get('host_name')}', this run is on '{cur_ctx.get('host_name')}'.")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower than baseline by more than {args.threshold:.0%} "
+              f"(Mann-Whitney p < {args.alpha}, {ci} above 1):")
+        for name in regressions:
+            print(f"  {name}")
+        print("If the slowdown is intended, refresh the baseline with --update.")
+        return 1
+
+    print(f"\n{len(rows)} benchmark(s) within {args.threshold:.0%} of baseline.")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare SLibBenchmarks against a stored baseline.")
+    parser.add_argument("--benchmark", required=True, help="path to the SLibBenchmarks executable")
+    parser.add_argument("--baseline", required=True, help="baseline JSON file")
+    parser.add_argument("--filter", default=".", help="benchmark filter regex")
+    parser.add_argument("--repetitions", type=int, default=12)
+    parser.add_argument("--min-time", type=float, default=0.05, help="seconds per repetition")
+    parser.add_argument("--cpu", type=int, default=None, help="CPU to pin to (default: last available)")
+    parser.add_argument("--threshold", type=float, default=0.10, help="tolerated relative slowdown (default 0.10)")
+    parser.add_argument("--alpha", type=float, default=0.01, help="significance level (default 0.01)")
+    parser.add_argument("--confidence", type=float, default=0.95, help="confidence level of the interval (default 0.95)")
+    parser.add_argument("--update", action="store_true", help="record a new baseline instead of comparing")
+    args = parser.parse_args()
+
+    re.compile(args.filter)
+    if not args.update and not os.path.exists(args.baseline):
+        print(f"baseline '{args.baseline}' not found, run with --update to record one")
+        return SKIP
+
+    cpu = pin_cpu(args.cpu)
+    print(f"Running {os.path.basename(args.benchmark)} x{args.repetitions}" + (f" on CPU {cpu}" if cpu is not None else ""), flush=True)
+    current = run_benchmarks(args.benchmark, args.filter, args.repetitions, args.min_time)
+
+    if args.update:
+        write_baseline(args.baseline, current)
+        print(f"wrote {len(current['benchmarks'])} benchmark(s) to {args.baseline}")
+        return 0
+
+    with open(args.baseline, encoding="utf-8") as f:
+        baseline = json.load(f)
+    return compare(baseline, current, args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,87 @@
+﻿/**
+ * @File ShardedCounterBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include <SLib/Concurrency/ShardedCounter.hpp>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kOpsPerThread = Size(1) << 20;
+constexpr Size kRepeats      = 3;
+
+/**
+ * @brief threads 个线程各执行 kOpsPerThread 次 op，返回单个核心上每次操作的平均耗时 (纳秒).
+ */
+template<typename Op>
+double NanosPerOp(Size threads, Op&& op)
+{
+    double best = 1e300;
+    for (Size r = 0; r < kRepeats; ++r) {
+        std::barrier start(static_cast<std::ptrdiff_t>(threads + 1));
+        std::vector<std::thread> workers;
+        for (Size t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                start.arrive_and_wait();
+                for (Size i = 0; i < kOpsPerThread; ++i)
+                    op(t, i);
+            });
+        }
+
+        start.arrive_and_wait();
+        const auto t0 = std::chrono::steady_clock::now();
+        for (auto& w : workers)
+            w.join();
+        const auto t1 = std::chrono::steady_clock::now();
+
+        // 线程数超过核数时，只有 cores 个线程在同时递增
+        const double ns    = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        const double cores = static_cast<double>(std::clamp<Size>(std::thread::hardware_concurrency(), 1, threads));
+        best               = std::min(best, ns * cores / static_cast<double>(threads * kOpsPerThread));
+    }
+    return best;
+}
+
+} // namespace
+
+int main()
+{
+    int errors = 0;
+
+    std::printf("%-8s%16s%16s%16s%16s%16s\n", "threads", "std::atomic", "ShardedCounter", "speedup", "Histogram", "MaxGauge");
+    for (Size threads = 1; threads <= 64; threads *= 2) {
+        alignas(SLIB_CACHE_LINE_SIZE) std::atomic<i64> single{0};
+        ShardedCounter sharded;
+        ShardedHistogram histogram;
+        MaxGauge gauge;
+
+        const double atomicNs  = NanosPerOp(threads, [&](Size, Size) { single.fetch_add(1, std::memory_order_relaxed); });
+        const double shardedNs = NanosPerOp(threads, [&](Size, Size) { sharded.increment(); });
+        const double histNs    = NanosPerOp(threads, [&](Size, Size i) { histogram.record(i); });
+        const double gaugeNs   = NanosPerOp(threads, [&](Size t, Size i) { gauge.update(static_cast<i64>(t * kOpsPerThread + i)); });
+
+        const auto expected = static_cast<i64>(threads * kOpsPerThread * kRepeats);
+        errors += single.load() != expected;
+        errors += sharded.value() != expected;
+        errors += histogram.count() != static_cast<u64>(expected);
+        errors += gauge.value() != static_cast<i64>(threads * kOpsPerThread - 1);
+
+        std::printf("%-8zu%14.2fns%14.2fns%15.2fx%14.2fns%14.2fns\n", threads, atomicNs, shardedNs, atomicNs / shardedNs, histNs, gaugeNs);
+    }
+
+    if (errors)
+        std::printf("%d errors\n", errors);
+    return errors == 0 ? 0 : 1;
+}
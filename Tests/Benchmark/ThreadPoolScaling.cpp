@@ -0,0 +1,175 @@
+﻿/**
+ * @File ThreadPoolScaling.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of SLib.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <SLib/Concurrency/ThreadPool.hpp>
+
+using namespace slib;
+
+namespace {
+
+constexpr Size kRepeats = 5;
+constexpr Size kLoopN   = Size(1) << 22;
+constexpr int kFibN     = 32;
+constexpr int kFibCut   = 12;
+
+/**
+ * @brief 取 kRepeats 次中最快的一次 (毫秒).
+ */
+template<typename F>
+double BestOf(F&& f)
+{
+    double best = 1e300;
+    for (Size r = 0; r < kRepeats; ++r) {
+        const auto t0 = std::chrono::steady_clock::now();
+        f();
+        const auto t1 = std::chrono::steady_clock::now();
+        best          = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+f64 Work(Size i)
+{
+    const f64 x = static_cast<f64>(i) * 1e-6;
+    return std::sin(x) * std::exp(-x) + std::sqrt(x + 1.0);
+}
+
+int FibSerial(int n)
+{
+    return n < 2 ? n : FibSerial(n - 1) + FibSerial(n - 2);
+}
+
+/**
+ * @brief 细粒度 fork-join，主要衡量任务提交、窃取与等待的开销.
+ */
+int FibParallel(ThreadPool& pool, int n)
+{
+    if (n < kFibCut)
+        return FibSerial(n);
+
+    int left = 0;
+    TaskHandle task([&pool, &left, n] { left = FibParallel(pool, n - 1); });
+    pool.submit(task);
+    const int right = FibParallel(pool, n - 2);
+    pool.wait(task);
+    return left + right;
+}
+
+struct Workload
+{
+    const char* name;
+    double serial;
+    std::vector<double> times;
+};
+
+} // namespace
+
+int main()
+{
+    // 单核机器上也至少跑一次 2 线程配置，以便检查结果与异常传播
+    const Size hardware = Max<Size>(std::thread::hardware_concurrency(), 2);
+
+    std::vector<Size> cores;
+    for (Size c = 1; c < hardware; c *= 2)
+        cores.push_back(c);
+    cores.push_back(hardware);
+
+    int errors = 0;
+    std::vector<f64> out(kLoopN);
+
+    // 单核基线: 不经过线程池
+    f64 serialSum = 0;
+    Workload loop{"ParallelFor", BestOf([&] {
+                      for (Size i = 0; i < kLoopN; ++i)
+                          out[i] = Work(i);
+                  }),
+                  {}};
+    Workload reduce{"ParallelReduce", BestOf([&] {
+                        serialSum = 0;
+                        for (Size i = 0; i < kLoopN; ++i)
+                            serialSum += Work(i);
+                    }),
+                    {}};
+    Workload fib{"Fork-join fib", BestOf([&] { (void)FibSerial(kFibN); }), {}};
+    const int fibExpected = FibSerial(kFibN);
+
+    for (Size c : cores) {
+        if (c == 1) {
+            loop.times.push_back(loop.serial);
+            reduce.times.push_back(reduce.serial);
+            fib.times.push_back(fib.serial);
+            continue;
+        }
+
+        // 调用线程在等待时也会执行任务，因此 c 个核对应 c - 1 个工作线程
+        ThreadPool pool({.threads = c - 1, .pinThreads = true});
+
+        loop.times.push_back(BestOf([&] { ParallelFor(pool, 0, kLoopN, [&](Size i) { out[i] = Work(i); }); }));
+        for (Size i = 0; i < kLoopN; i += 4099)
+            errors += out[i] != Work(i);
+
+        f64 sum = 0;
+        reduce.times.push_back(BestOf([&] {
+            sum = ParallelReduce(
+                pool, 0, kLoopN, 0.0,
+                [](Size b, Size e) {
+                    f64 s = 0;
+                    for (Size i = b; i < e; ++i)
+                        s += Work(i);
+                    return s;
+                },
+                [](f64 a, f64 b) { return a + b; });
+        }));
+        errors += std::abs(sum - serialSum) > 1e-9 * std::abs(serialSum);
+
+        int fibResult = 0;
+        fib.times.push_back(BestOf([&] {
+            TaskHandle root([&] { fibResult = FibParallel(pool, kFibN); });
+            pool.submit(root);
+            pool.wait(root);
+        }));
+        errors += fibResult != fibExpected;
+
+        // 异常应传播到等待方，而不是终止进程
+        bool caught = false;
+        try {
+            ParallelFor(pool, 0, 1 << 16, [](Size i) {
+                if (i == 12345)
+                    throw std::runtime_error("expected");
+            });
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        errors += !caught;
+    }
+
+    std::printf("%-16s", "cores");
+    for (Size c : cores)
+        std::printf("%12zu", c);
+    std::printf("\n");
+
+    for (const Workload* w : {&loop, &reduce, &fib}) {
+        std::printf("%-16s", w->name);
+        for (double t : w->times)
+            std::printf("%10.2fms", t);
+        std::printf("\n%-16s", "  speedup");
+        for (double t : w->times)
+            std::printf("%11.2fx", w->serial / t);
+        std::printf("\n");
+    }
+
+    if (errors)
+        std::printf("%d errors\n", errors);
+    return errors == 0 ? 0 : 1;
+}